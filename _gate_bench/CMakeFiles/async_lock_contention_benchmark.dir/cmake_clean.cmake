@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/async_lock_contention_benchmark.dir/source/async_lock_contention_benchmark.cpp.o"
+  "CMakeFiles/async_lock_contention_benchmark.dir/source/async_lock_contention_benchmark.cpp.o.d"
+  "bin/async_lock_contention_benchmark"
+  "bin/async_lock_contention_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_lock_contention_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/source/async_shared_mutex_benchmark.cpp" "CMakeFiles/async_shared_mutex_benchmark.dir/source/async_shared_mutex_benchmark.cpp.o" "gcc" "CMakeFiles/async_shared_mutex_benchmark.dir/source/async_shared_mutex_benchmark.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_bench/_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
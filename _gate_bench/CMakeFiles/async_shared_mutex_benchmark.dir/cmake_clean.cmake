@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/async_shared_mutex_benchmark.dir/source/async_shared_mutex_benchmark.cpp.o"
+  "CMakeFiles/async_shared_mutex_benchmark.dir/source/async_shared_mutex_benchmark.cpp.o.d"
+  "bin/async_shared_mutex_benchmark"
+  "bin/async_shared_mutex_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_shared_mutex_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/channel_benchmark.dir/source/channel_benchmark.cpp.o"
+  "CMakeFiles/channel_benchmark.dir/source/channel_benchmark.cpp.o.d"
+  "bin/channel_benchmark"
+  "bin/channel_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/channel_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
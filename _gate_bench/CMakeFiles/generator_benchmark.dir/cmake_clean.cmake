@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generator_benchmark.dir/source/generator_benchmark.cpp.o"
+  "CMakeFiles/generator_benchmark.dir/source/generator_benchmark.cpp.o.d"
+  "bin/generator_benchmark"
+  "bin/generator_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generator_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inline_executor_recursion_benchmark.dir/source/inline_executor_recursion_benchmark.cpp.o"
+  "CMakeFiles/inline_executor_recursion_benchmark.dir/source/inline_executor_recursion_benchmark.cpp.o.d"
+  "bin/inline_executor_recursion_benchmark"
+  "bin/inline_executor_recursion_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inline_executor_recursion_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
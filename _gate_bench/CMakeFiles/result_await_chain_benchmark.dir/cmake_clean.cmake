@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_await_chain_benchmark.dir/source/result_await_chain_benchmark.cpp.o"
+  "CMakeFiles/result_await_chain_benchmark.dir/source/result_await_chain_benchmark.cpp.o.d"
+  "bin/result_await_chain_benchmark"
+  "bin/result_await_chain_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_await_chain_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shared_result_fan_out_benchmark.dir/source/shared_result_fan_out_benchmark.cpp.o"
+  "CMakeFiles/shared_result_fan_out_benchmark.dir/source/shared_result_fan_out_benchmark.cpp.o.d"
+  "bin/shared_result_fan_out_benchmark"
+  "bin/shared_result_fan_out_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_result_fan_out_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
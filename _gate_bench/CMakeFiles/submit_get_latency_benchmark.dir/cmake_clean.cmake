@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/submit_get_latency_benchmark.dir/source/submit_get_latency_benchmark.cpp.o"
+  "CMakeFiles/submit_get_latency_benchmark.dir/source/submit_get_latency_benchmark.cpp.o.d"
+  "bin/submit_get_latency_benchmark"
+  "bin/submit_get_latency_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/submit_get_latency_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
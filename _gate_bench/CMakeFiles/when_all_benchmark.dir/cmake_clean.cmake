@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/when_all_benchmark.dir/source/when_all_benchmark.cpp.o"
+  "CMakeFiles/when_all_benchmark.dir/source/when_all_benchmark.cpp.o.d"
+  "bin/when_all_benchmark"
+  "bin/when_all_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/when_all_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/concurrencpp.dir/source/executors/executor.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/executors/executor.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/executors/inline_executor.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/executors/inline_executor.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/executors/manual_executor.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/executors/manual_executor.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/executors/thread_executor.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/executors/thread_executor.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/executors/thread_pool_executor.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/executors/thread_pool_executor.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/executors/worker_thread_executor.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/executors/worker_thread_executor.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/results/impl/consumer_context.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/results/impl/consumer_context.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/results/impl/result_state.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/results/impl/result_state.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/results/impl/shared_result_state.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/results/impl/shared_result_state.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/runtime/runtime.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/runtime/runtime.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/task.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/task.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_barrier.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_barrier.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_condition_variable.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_condition_variable.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_latch.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_latch.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_lock.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_lock.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_semaphore.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_semaphore.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_shared_mutex.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_shared_mutex.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_waiter.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/async_waiter.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/spin_wait.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/spin_wait.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/threads/thread.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/threads/thread.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/timers/timer.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/timers/timer.cpp.o.d"
+  "CMakeFiles/concurrencpp.dir/source/timers/timer_queue.cpp.o"
+  "CMakeFiles/concurrencpp.dir/source/timers/timer_queue.cpp.o.d"
+  "libconcurrencpp.a"
+  "libconcurrencpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrencpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,100 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/coroutineOptions.cmake"
+  "/root/repo/test/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMinorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent/CMakeLists.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "_deps/concurrencpp-subbuild/CMakeLists.txt"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/concurrencpp-build/concurrencppConfigVersion.cmake"
+  "_deps/concurrencpp-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/concurrencpp_test_infra.dir/DependInfo.cmake"
+  "CMakeFiles/task_tests.dir/DependInfo.cmake"
+  "CMakeFiles/runtime_tests.dir/DependInfo.cmake"
+  "CMakeFiles/inline_executor_tests.dir/DependInfo.cmake"
+  "CMakeFiles/manual_executor_tests.dir/DependInfo.cmake"
+  "CMakeFiles/thread_executor_tests.dir/DependInfo.cmake"
+  "CMakeFiles/thread_pool_executor_tests.dir/DependInfo.cmake"
+  "CMakeFiles/worker_thread_executor_tests.dir/DependInfo.cmake"
+  "CMakeFiles/result_tests.dir/DependInfo.cmake"
+  "CMakeFiles/result_resolve_await_tests.dir/DependInfo.cmake"
+  "CMakeFiles/lazy_result_tests.dir/DependInfo.cmake"
+  "CMakeFiles/shared_result_tests.dir/DependInfo.cmake"
+  "CMakeFiles/shared_result_resolving_tests.dir/DependInfo.cmake"
+  "CMakeFiles/shared_result_awaiting_tests.dir/DependInfo.cmake"
+  "CMakeFiles/make_result_tests.dir/DependInfo.cmake"
+  "CMakeFiles/result_promise_tests.dir/DependInfo.cmake"
+  "CMakeFiles/when_all_tests.dir/DependInfo.cmake"
+  "CMakeFiles/when_any_tests.dir/DependInfo.cmake"
+  "CMakeFiles/when_n_tests.dir/DependInfo.cmake"
+  "CMakeFiles/with_timeout_tests.dir/DependInfo.cmake"
+  "CMakeFiles/concurrent_algorithms_tests.dir/DependInfo.cmake"
+  "CMakeFiles/resume_on_tests.dir/DependInfo.cmake"
+  "CMakeFiles/generator_tests.dir/DependInfo.cmake"
+  "CMakeFiles/async_generator_tests.dir/DependInfo.cmake"
+  "CMakeFiles/coroutine_promise_tests.dir/DependInfo.cmake"
+  "CMakeFiles/coroutine_tests.dir/DependInfo.cmake"
+  "CMakeFiles/async_lock_tests.dir/DependInfo.cmake"
+  "CMakeFiles/scoped_async_lock_tests.dir/DependInfo.cmake"
+  "CMakeFiles/async_condition_variable_tests.dir/DependInfo.cmake"
+  "CMakeFiles/async_shared_mutex_tests.dir/DependInfo.cmake"
+  "CMakeFiles/async_semaphore_tests.dir/DependInfo.cmake"
+  "CMakeFiles/async_latch_tests.dir/DependInfo.cmake"
+  "CMakeFiles/async_barrier_tests.dir/DependInfo.cmake"
+  "CMakeFiles/channel_tests.dir/DependInfo.cmake"
+  "CMakeFiles/timer_queue_tests.dir/DependInfo.cmake"
+  "CMakeFiles/timer_queue_backend_tests.dir/DependInfo.cmake"
+  "CMakeFiles/timer_tests.dir/DependInfo.cmake"
+  "CMakeFiles/io_timer_tests.dir/DependInfo.cmake"
+  "CMakeFiles/workflow_executor_tests.dir/DependInfo.cmake"
+  "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/async_barrier_tests.dir/source/tests/async_barrier_tests.cpp.o"
+  "CMakeFiles/async_barrier_tests.dir/source/tests/async_barrier_tests.cpp.o.d"
+  "bin/async_barrier_tests"
+  "bin/async_barrier_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_barrier_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
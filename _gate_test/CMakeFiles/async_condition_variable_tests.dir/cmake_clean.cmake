@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/async_condition_variable_tests.dir/source/tests/async_condition_variable_tests.cpp.o"
+  "CMakeFiles/async_condition_variable_tests.dir/source/tests/async_condition_variable_tests.cpp.o.d"
+  "bin/async_condition_variable_tests"
+  "bin/async_condition_variable_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_condition_variable_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
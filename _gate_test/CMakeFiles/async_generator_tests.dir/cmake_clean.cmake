@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/async_generator_tests.dir/source/tests/result_tests/async_generator_tests.cpp.o"
+  "CMakeFiles/async_generator_tests.dir/source/tests/result_tests/async_generator_tests.cpp.o.d"
+  "bin/async_generator_tests"
+  "bin/async_generator_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_generator_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/async_latch_tests.dir/source/tests/async_latch_tests.cpp.o"
+  "CMakeFiles/async_latch_tests.dir/source/tests/async_latch_tests.cpp.o.d"
+  "bin/async_latch_tests"
+  "bin/async_latch_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_latch_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
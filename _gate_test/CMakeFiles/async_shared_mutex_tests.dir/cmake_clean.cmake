@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/async_shared_mutex_tests.dir/source/tests/async_shared_mutex_tests.cpp.o"
+  "CMakeFiles/async_shared_mutex_tests.dir/source/tests/async_shared_mutex_tests.cpp.o.d"
+  "bin/async_shared_mutex_tests"
+  "bin/async_shared_mutex_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_shared_mutex_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
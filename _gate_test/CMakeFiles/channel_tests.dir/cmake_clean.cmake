@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/channel_tests.dir/source/tests/channel_tests.cpp.o"
+  "CMakeFiles/channel_tests.dir/source/tests/channel_tests.cpp.o.d"
+  "bin/channel_tests"
+  "bin/channel_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/channel_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/source/infra/assertions.cpp" "CMakeFiles/concurrencpp_test_infra.dir/source/infra/assertions.cpp.o" "gcc" "CMakeFiles/concurrencpp_test_infra.dir/source/infra/assertions.cpp.o.d"
+  "/root/repo/test/source/infra/tester.cpp" "CMakeFiles/concurrencpp_test_infra.dir/source/infra/tester.cpp.o" "gcc" "CMakeFiles/concurrencpp_test_infra.dir/source/infra/tester.cpp.o.d"
+  "/root/repo/test/source/utils/object_observer.cpp" "CMakeFiles/concurrencpp_test_infra.dir/source/utils/object_observer.cpp.o" "gcc" "CMakeFiles/concurrencpp_test_infra.dir/source/utils/object_observer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_test/_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/concurrencpp_test_infra.dir/source/infra/assertions.cpp.o"
+  "CMakeFiles/concurrencpp_test_infra.dir/source/infra/assertions.cpp.o.d"
+  "CMakeFiles/concurrencpp_test_infra.dir/source/infra/tester.cpp.o"
+  "CMakeFiles/concurrencpp_test_infra.dir/source/infra/tester.cpp.o.d"
+  "CMakeFiles/concurrencpp_test_infra.dir/source/utils/object_observer.cpp.o"
+  "CMakeFiles/concurrencpp_test_infra.dir/source/utils/object_observer.cpp.o.d"
+  "libconcurrencpp_test_infra.a"
+  "libconcurrencpp_test_infra.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrencpp_test_infra.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libconcurrencpp_test_infra.a"
+)
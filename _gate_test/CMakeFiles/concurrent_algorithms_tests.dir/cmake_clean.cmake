@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/concurrent_algorithms_tests.dir/source/tests/result_tests/concurrent_algorithms_tests.cpp.o"
+  "CMakeFiles/concurrent_algorithms_tests.dir/source/tests/result_tests/concurrent_algorithms_tests.cpp.o.d"
+  "bin/concurrent_algorithms_tests"
+  "bin/concurrent_algorithms_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrent_algorithms_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/coroutine_promise_tests.dir/source/tests/coroutine_tests/coroutine_promise_tests.cpp.o"
+  "CMakeFiles/coroutine_promise_tests.dir/source/tests/coroutine_tests/coroutine_promise_tests.cpp.o.d"
+  "bin/coroutine_promise_tests"
+  "bin/coroutine_promise_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/coroutine_promise_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
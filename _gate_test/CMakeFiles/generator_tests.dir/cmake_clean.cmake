@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generator_tests.dir/source/tests/result_tests/generator_tests.cpp.o"
+  "CMakeFiles/generator_tests.dir/source/tests/result_tests/generator_tests.cpp.o.d"
+  "bin/generator_tests"
+  "bin/generator_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generator_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
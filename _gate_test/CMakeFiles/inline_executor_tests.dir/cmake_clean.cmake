@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inline_executor_tests.dir/source/tests/executor_tests/inline_executor_tests.cpp.o"
+  "CMakeFiles/inline_executor_tests.dir/source/tests/executor_tests/inline_executor_tests.cpp.o.d"
+  "bin/inline_executor_tests"
+  "bin/inline_executor_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inline_executor_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_timer_tests.dir/source/tests/timer_tests/io_timer_tests.cpp.o"
+  "CMakeFiles/io_timer_tests.dir/source/tests/timer_tests/io_timer_tests.cpp.o.d"
+  "bin/io_timer_tests"
+  "bin/io_timer_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_timer_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lazy_result_tests.dir/source/tests/result_tests/lazy_result_tests.cpp.o"
+  "CMakeFiles/lazy_result_tests.dir/source/tests/result_tests/lazy_result_tests.cpp.o.d"
+  "bin/lazy_result_tests"
+  "bin/lazy_result_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lazy_result_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/make_result_tests.dir/source/tests/result_tests/make_result_tests.cpp.o"
+  "CMakeFiles/make_result_tests.dir/source/tests/result_tests/make_result_tests.cpp.o.d"
+  "bin/make_result_tests"
+  "bin/make_result_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/make_result_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/manual_executor_tests.dir/source/tests/executor_tests/manual_executor_tests.cpp.o"
+  "CMakeFiles/manual_executor_tests.dir/source/tests/executor_tests/manual_executor_tests.cpp.o.d"
+  "bin/manual_executor_tests"
+  "bin/manual_executor_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/manual_executor_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
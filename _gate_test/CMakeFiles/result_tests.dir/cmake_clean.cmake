@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_tests.dir/source/tests/result_tests/result_tests.cpp.o"
+  "CMakeFiles/result_tests.dir/source/tests/result_tests/result_tests.cpp.o.d"
+  "bin/result_tests"
+  "bin/result_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
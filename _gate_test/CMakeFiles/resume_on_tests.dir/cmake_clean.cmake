@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/resume_on_tests.dir/source/tests/result_tests/resume_on_tests.cpp.o"
+  "CMakeFiles/resume_on_tests.dir/source/tests/result_tests/resume_on_tests.cpp.o.d"
+  "bin/resume_on_tests"
+  "bin/resume_on_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resume_on_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runtime_tests.dir/source/tests/runtime_tests.cpp.o"
+  "CMakeFiles/runtime_tests.dir/source/tests/runtime_tests.cpp.o.d"
+  "bin/runtime_tests"
+  "bin/runtime_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runtime_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scoped_async_lock_tests.dir/source/tests/scoped_async_lock_tests.cpp.o"
+  "CMakeFiles/scoped_async_lock_tests.dir/source/tests/scoped_async_lock_tests.cpp.o.d"
+  "bin/scoped_async_lock_tests"
+  "bin/scoped_async_lock_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scoped_async_lock_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
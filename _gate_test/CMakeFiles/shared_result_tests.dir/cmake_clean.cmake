@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shared_result_tests.dir/source/tests/result_tests/shared_result_tests.cpp.o"
+  "CMakeFiles/shared_result_tests.dir/source/tests/result_tests/shared_result_tests.cpp.o.d"
+  "bin/shared_result_tests"
+  "bin/shared_result_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_result_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
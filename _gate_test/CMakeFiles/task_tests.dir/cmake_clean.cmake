@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/task_tests.dir/source/tests/task_tests.cpp.o"
+  "CMakeFiles/task_tests.dir/source/tests/task_tests.cpp.o.d"
+  "bin/task_tests"
+  "bin/task_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
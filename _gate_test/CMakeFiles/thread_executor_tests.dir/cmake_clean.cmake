@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thread_executor_tests.dir/source/tests/executor_tests/thread_executor_tests.cpp.o"
+  "CMakeFiles/thread_executor_tests.dir/source/tests/executor_tests/thread_executor_tests.cpp.o.d"
+  "bin/thread_executor_tests"
+  "bin/thread_executor_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread_executor_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
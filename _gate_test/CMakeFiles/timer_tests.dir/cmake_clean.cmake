@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timer_tests.dir/source/tests/timer_tests/timer_tests.cpp.o"
+  "CMakeFiles/timer_tests.dir/source/tests/timer_tests/timer_tests.cpp.o.d"
+  "bin/timer_tests"
+  "bin/timer_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timer_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/when_all_tests.dir/source/tests/result_tests/when_all_tests.cpp.o"
+  "CMakeFiles/when_all_tests.dir/source/tests/result_tests/when_all_tests.cpp.o.d"
+  "bin/when_all_tests"
+  "bin/when_all_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/when_all_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
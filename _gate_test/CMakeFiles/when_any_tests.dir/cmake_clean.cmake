@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/when_any_tests.dir/source/tests/result_tests/when_any_tests.cpp.o"
+  "CMakeFiles/when_any_tests.dir/source/tests/result_tests/when_any_tests.cpp.o.d"
+  "bin/when_any_tests"
+  "bin/when_any_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/when_any_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
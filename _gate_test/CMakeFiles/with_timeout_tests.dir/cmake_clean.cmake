@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/with_timeout_tests.dir/source/tests/result_tests/with_timeout_tests.cpp.o"
+  "CMakeFiles/with_timeout_tests.dir/source/tests/result_tests/with_timeout_tests.cpp.o.d"
+  "bin/with_timeout_tests"
+  "bin/with_timeout_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/with_timeout_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/worker_thread_executor_tests.dir/source/tests/executor_tests/worker_thread_executor_tests.cpp.o"
+  "CMakeFiles/worker_thread_executor_tests.dir/source/tests/executor_tests/worker_thread_executor_tests.cpp.o.d"
+  "bin/worker_thread_executor_tests"
+  "bin/worker_thread_executor_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/worker_thread_executor_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
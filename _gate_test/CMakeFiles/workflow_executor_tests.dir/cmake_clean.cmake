@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/workflow_executor_tests.dir/source/tests/workflow_executor_tests.cpp.o"
+  "CMakeFiles/workflow_executor_tests.dir/source/tests/workflow_executor_tests.cpp.o.d"
+  "bin/workflow_executor_tests"
+  "bin/workflow_executor_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/workflow_executor_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
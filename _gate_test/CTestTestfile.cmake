@@ -0,0 +1,83 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_gate_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[task_tests]=] "/root/repo/_gate_test/bin/task_tests")
+set_tests_properties([=[task_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;105;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[runtime_tests]=] "/root/repo/_gate_test/bin/runtime_tests")
+set_tests_properties([=[runtime_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;106;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[inline_executor_tests]=] "/root/repo/_gate_test/bin/inline_executor_tests")
+set_tests_properties([=[inline_executor_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;108;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[manual_executor_tests]=] "/root/repo/_gate_test/bin/manual_executor_tests")
+set_tests_properties([=[manual_executor_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;109;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[thread_executor_tests]=] "/root/repo/_gate_test/bin/thread_executor_tests")
+set_tests_properties([=[thread_executor_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;110;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[thread_pool_executor_tests]=] "/root/repo/_gate_test/bin/thread_pool_executor_tests")
+set_tests_properties([=[thread_pool_executor_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;111;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[worker_thread_executor_tests]=] "/root/repo/_gate_test/bin/worker_thread_executor_tests")
+set_tests_properties([=[worker_thread_executor_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;112;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[result_tests]=] "/root/repo/_gate_test/bin/result_tests")
+set_tests_properties([=[result_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;114;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[result_resolve_await_tests]=] "/root/repo/_gate_test/bin/result_resolve_await_tests")
+set_tests_properties([=[result_resolve_await_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;115;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[lazy_result_tests]=] "/root/repo/_gate_test/bin/lazy_result_tests")
+set_tests_properties([=[lazy_result_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;117;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[shared_result_tests]=] "/root/repo/_gate_test/bin/shared_result_tests")
+set_tests_properties([=[shared_result_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;119;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[shared_result_resolving_tests]=] "/root/repo/_gate_test/bin/shared_result_resolving_tests")
+set_tests_properties([=[shared_result_resolving_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;120;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[shared_result_awaiting_tests]=] "/root/repo/_gate_test/bin/shared_result_awaiting_tests")
+set_tests_properties([=[shared_result_awaiting_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;121;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[make_result_tests]=] "/root/repo/_gate_test/bin/make_result_tests")
+set_tests_properties([=[make_result_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;123;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[result_promise_tests]=] "/root/repo/_gate_test/bin/result_promise_tests")
+set_tests_properties([=[result_promise_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;124;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[when_all_tests]=] "/root/repo/_gate_test/bin/when_all_tests")
+set_tests_properties([=[when_all_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;125;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[when_any_tests]=] "/root/repo/_gate_test/bin/when_any_tests")
+set_tests_properties([=[when_any_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;126;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[when_n_tests]=] "/root/repo/_gate_test/bin/when_n_tests")
+set_tests_properties([=[when_n_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;127;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[with_timeout_tests]=] "/root/repo/_gate_test/bin/with_timeout_tests")
+set_tests_properties([=[with_timeout_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;128;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[concurrent_algorithms_tests]=] "/root/repo/_gate_test/bin/concurrent_algorithms_tests")
+set_tests_properties([=[concurrent_algorithms_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[resume_on_tests]=] "/root/repo/_gate_test/bin/resume_on_tests")
+set_tests_properties([=[resume_on_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;130;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[generator_tests]=] "/root/repo/_gate_test/bin/generator_tests")
+set_tests_properties([=[generator_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;132;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[async_generator_tests]=] "/root/repo/_gate_test/bin/async_generator_tests")
+set_tests_properties([=[async_generator_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;133;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[coroutine_promise_tests]=] "/root/repo/_gate_test/bin/coroutine_promise_tests")
+set_tests_properties([=[coroutine_promise_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;135;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[coroutine_tests]=] "/root/repo/_gate_test/bin/coroutine_tests")
+set_tests_properties([=[coroutine_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;136;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[async_lock_tests]=] "/root/repo/_gate_test/bin/async_lock_tests")
+set_tests_properties([=[async_lock_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;138;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[scoped_async_lock_tests]=] "/root/repo/_gate_test/bin/scoped_async_lock_tests")
+set_tests_properties([=[scoped_async_lock_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;139;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[async_condition_variable_tests]=] "/root/repo/_gate_test/bin/async_condition_variable_tests")
+set_tests_properties([=[async_condition_variable_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;140;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[async_shared_mutex_tests]=] "/root/repo/_gate_test/bin/async_shared_mutex_tests")
+set_tests_properties([=[async_shared_mutex_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;141;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[async_semaphore_tests]=] "/root/repo/_gate_test/bin/async_semaphore_tests")
+set_tests_properties([=[async_semaphore_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;142;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[async_latch_tests]=] "/root/repo/_gate_test/bin/async_latch_tests")
+set_tests_properties([=[async_latch_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;143;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[async_barrier_tests]=] "/root/repo/_gate_test/bin/async_barrier_tests")
+set_tests_properties([=[async_barrier_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;144;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[channel_tests]=] "/root/repo/_gate_test/bin/channel_tests")
+set_tests_properties([=[channel_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;145;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[timer_queue_tests]=] "/root/repo/_gate_test/bin/timer_queue_tests")
+set_tests_properties([=[timer_queue_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;147;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[timer_queue_backend_tests]=] "/root/repo/_gate_test/bin/timer_queue_backend_tests")
+set_tests_properties([=[timer_queue_backend_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;148;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[timer_tests]=] "/root/repo/_gate_test/bin/timer_tests")
+set_tests_properties([=[timer_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;149;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[io_timer_tests]=] "/root/repo/_gate_test/bin/io_timer_tests")
+set_tests_properties([=[io_timer_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;150;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[workflow_executor_tests]=] "/root/repo/_gate_test/bin/workflow_executor_tests")
+set_tests_properties([=[workflow_executor_tests]=] PROPERTIES  RUN_SERIAL "YES" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;99;_add_test;/root/repo/test/CMakeLists.txt;153;add_test;/root/repo/test/CMakeLists.txt;0;")
+subdirs("_deps/concurrencpp-build")
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/executors/executor.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/executor.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/executor.cpp.o.d"
+  "/root/repo/source/executors/inline_executor.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/inline_executor.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/inline_executor.cpp.o.d"
+  "/root/repo/source/executors/manual_executor.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/manual_executor.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/manual_executor.cpp.o.d"
+  "/root/repo/source/executors/thread_executor.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/thread_executor.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/thread_executor.cpp.o.d"
+  "/root/repo/source/executors/thread_pool_executor.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/thread_pool_executor.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/thread_pool_executor.cpp.o.d"
+  "/root/repo/source/executors/worker_thread_executor.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/worker_thread_executor.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/executors/worker_thread_executor.cpp.o.d"
+  "/root/repo/source/results/impl/consumer_context.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/results/impl/consumer_context.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/results/impl/consumer_context.cpp.o.d"
+  "/root/repo/source/results/impl/result_state.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/results/impl/result_state.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/results/impl/result_state.cpp.o.d"
+  "/root/repo/source/results/impl/shared_result_state.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/results/impl/shared_result_state.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/results/impl/shared_result_state.cpp.o.d"
+  "/root/repo/source/results/with_timeout.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/results/with_timeout.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/results/with_timeout.cpp.o.d"
+  "/root/repo/source/runtime/runtime.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/runtime/runtime.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/runtime/runtime.cpp.o.d"
+  "/root/repo/source/task.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/task.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/task.cpp.o.d"
+  "/root/repo/source/threads/async_barrier.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_barrier.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_barrier.cpp.o.d"
+  "/root/repo/source/threads/async_condition_variable.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_condition_variable.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_condition_variable.cpp.o.d"
+  "/root/repo/source/threads/async_latch.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_latch.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_latch.cpp.o.d"
+  "/root/repo/source/threads/async_lock.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_lock.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_lock.cpp.o.d"
+  "/root/repo/source/threads/async_semaphore.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_semaphore.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_semaphore.cpp.o.d"
+  "/root/repo/source/threads/async_shared_mutex.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_shared_mutex.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_shared_mutex.cpp.o.d"
+  "/root/repo/source/threads/async_waiter.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_waiter.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/async_waiter.cpp.o.d"
+  "/root/repo/source/threads/spin_wait.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/spin_wait.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/spin_wait.cpp.o.d"
+  "/root/repo/source/threads/thread.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/thread.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/threads/thread.cpp.o.d"
+  "/root/repo/source/timers/local_timer_shard.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/timers/local_timer_shard.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/timers/local_timer_shard.cpp.o.d"
+  "/root/repo/source/timers/timer.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/timers/timer.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/timers/timer.cpp.o.d"
+  "/root/repo/source/timers/timer_queue.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/timers/timer_queue.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/timers/timer_queue.cpp.o.d"
+  "/root/repo/source/timers/timer_queue_internal.cpp" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/timers/timer_queue_internal.cpp.o" "gcc" "_deps/concurrencpp-build/CMakeFiles/concurrencpp.dir/source/timers/timer_queue_internal.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
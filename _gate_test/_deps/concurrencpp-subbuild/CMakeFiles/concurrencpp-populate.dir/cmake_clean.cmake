@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/concurrencpp-populate"
+  "CMakeFiles/concurrencpp-populate-complete"
+  "concurrencpp-populate-prefix/src/concurrencpp-populate-stamp/concurrencpp-populate-build"
+  "concurrencpp-populate-prefix/src/concurrencpp-populate-stamp/concurrencpp-populate-configure"
+  "concurrencpp-populate-prefix/src/concurrencpp-populate-stamp/concurrencpp-populate-download"
+  "concurrencpp-populate-prefix/src/concurrencpp-populate-stamp/concurrencpp-populate-install"
+  "concurrencpp-populate-prefix/src/concurrencpp-populate-stamp/concurrencpp-populate-mkdir"
+  "concurrencpp-populate-prefix/src/concurrencpp-populate-stamp/concurrencpp-populate-patch"
+  "concurrencpp-populate-prefix/src/concurrencpp-populate-stamp/concurrencpp-populate-test"
+  "concurrencpp-populate-prefix/src/concurrencpp-populate-stamp/concurrencpp-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/concurrencpp-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
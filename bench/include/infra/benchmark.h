@@ -0,0 +1,65 @@
+#ifndef CONCURRENCPP_BENCHMARK_H
+#define CONCURRENCPP_BENCHMARK_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <string_view>
+
+namespace concurrencpp::benchmarks {
+    class stopwatch {
+
+       private:
+        std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+
+       public:
+        void reset() noexcept {
+            m_start = std::chrono::steady_clock::now();
+        }
+
+        double elapsed_ms() const noexcept {
+            const auto diff = std::chrono::steady_clock::now() - m_start;
+            return std::chrono::duration<double, std::milli>(diff).count();
+        }
+
+        double elapsed_ns() const noexcept {
+            const auto diff = std::chrono::steady_clock::now() - m_start;
+            return std::chrono::duration<double, std::nano>(diff).count();
+        }
+    };
+
+    // tracks the deepest stack address observed, used to report stack usage of recursive continuations.
+    class stack_probe {
+
+       private:
+        std::uintptr_t m_top = 0;
+        std::uintptr_t m_lowest = 0;
+
+        static std::uintptr_t current_address() noexcept {
+            volatile char marker = 0;
+            return reinterpret_cast<std::uintptr_t>(&marker);
+        }
+
+       public:
+        void start() noexcept {
+            m_top = m_lowest = current_address();
+        }
+
+        void sample() noexcept {
+            const auto address = current_address();
+            if (address < m_lowest) {
+                m_lowest = address;
+            }
+        }
+
+        std::size_t max_depth_bytes() const noexcept {
+            return static_cast<std::size_t>(m_top - m_lowest);
+        }
+    };
+
+    inline void print_header(std::string_view benchmark_name) {
+        std::printf("\n== %.*s ==\n", static_cast<int>(benchmark_name.size()), benchmark_name.data());
+    }
+}  // namespace concurrencpp::benchmarks
+
+#endif
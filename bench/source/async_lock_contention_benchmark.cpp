@@ -0,0 +1,68 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+/*
+    Measures async_lock throughput with 1 to 64 coroutines contending for the same lock inside a thread pool,
+    once with direct handoff (the default) and once in barging mode.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    constexpr size_t k_total_acquisitions = 200'000;
+
+    result<void> contend(executor_tag, std::shared_ptr<thread_pool_executor> executor, async_lock& lock, size_t& counter, size_t cycles) {
+        for (size_t i = 0; i < cycles; i++) {
+            auto guard = co_await lock.lock(executor);
+            ++counter;
+        }
+    }
+
+    void run_contention(std::shared_ptr<thread_pool_executor> executor, bool barging, size_t contenders) {
+        async_lock lock(barging);
+        size_t counter = 0;
+        const auto cycles = k_total_acquisitions / contenders;
+
+        std::vector<result<void>> results;
+        results.reserve(contenders);
+
+        stopwatch sw;
+        for (size_t i = 0; i < contenders; i++) {
+            results.emplace_back(contend({}, executor, lock, counter, cycles));
+        }
+
+        for (auto& result : results) {
+            result.get();
+        }
+
+        const auto elapsed = sw.elapsed_ns();
+        std::printf("%-8s contenders=%-4zu %.1f ns/acquisition  (%zu acquisitions)\n",
+                    barging ? "barging" : "handoff",
+                    contenders,
+                    elapsed / static_cast<double>(counter),
+                    counter);
+    }
+}  // namespace
+
+int main() {
+    print_header("async_lock contention");
+
+    // at least 4 workers, so the lock is contended by preempted threads even on machines with few cores.
+    const auto worker_count = std::max(std::thread::hardware_concurrency(), 4u);
+    const auto executor = std::make_shared<thread_pool_executor>("async_lock benchmark", worker_count, std::chrono::seconds(10));
+    std::printf("thread pool workers: %d\n", executor->max_concurrency_level());
+
+    for (const size_t contenders : {1, 2, 4, 8, 16, 32, 64}) {
+        run_contention(executor, false, contenders);
+        run_contention(executor, true, contenders);
+    }
+
+    executor->shutdown();
+    return 0;
+}
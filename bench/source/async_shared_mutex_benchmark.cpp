@@ -0,0 +1,113 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+/*
+    Measures the throughput of a 95% read / 5% write workload with 1 to 64 coroutines inside a thread pool,
+    once protecting the data with an async_lock and once with an async_shared_mutex.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    constexpr size_t k_total_operations = 200'000;
+    constexpr size_t k_write_period = 20;  // one write every 20 operations
+    constexpr size_t k_data_size = 64;
+
+    struct shared_data {
+        std::vector<size_t> values = std::vector<size_t>(k_data_size);
+        size_t checksum = 0;
+    };
+
+    size_t read_data(const shared_data& data) noexcept {
+        return std::accumulate(data.values.begin(), data.values.end(), size_t(0));
+    }
+
+    void write_data(shared_data& data, size_t i) noexcept {
+        data.values[i % k_data_size] += 1;
+    }
+
+    result<void> use_lock(executor_tag, std::shared_ptr<thread_pool_executor> executor, async_lock& lock, shared_data& data, size_t cycles) {
+        size_t checksum = 0;
+        for (size_t i = 0; i < cycles; i++) {
+            auto guard = co_await lock.lock(executor);
+            if (i % k_write_period == 0) {
+                write_data(data, i);
+            } else {
+                checksum += read_data(data);
+            }
+        }
+
+        auto guard = co_await lock.lock(executor);
+        data.checksum += checksum;
+    }
+
+    result<void> use_shared_mutex(executor_tag,
+                                  std::shared_ptr<thread_pool_executor> executor,
+                                  async_shared_mutex& mutex,
+                                  shared_data& data,
+                                  size_t cycles) {
+        size_t checksum = 0;
+        for (size_t i = 0; i < cycles; i++) {
+            if (i % k_write_period == 0) {
+                auto guard = co_await mutex.lock(executor);
+                write_data(data, i);
+            } else {
+                auto guard = co_await mutex.lock_shared(executor);
+                checksum += read_data(data);
+            }
+        }
+
+        auto guard = co_await mutex.lock(executor);
+        data.checksum += checksum;
+    }
+
+    template<class lock_type, class coroutine_type>
+    void run_workload(const char* name, std::shared_ptr<thread_pool_executor> executor, coroutine_type coroutine, size_t contenders) {
+        lock_type lock;
+        shared_data data;
+        const auto cycles = k_total_operations / contenders;
+
+        std::vector<result<void>> results;
+        results.reserve(contenders);
+
+        stopwatch sw;
+        for (size_t i = 0; i < contenders; i++) {
+            results.emplace_back(coroutine({}, executor, lock, data, cycles));
+        }
+
+        for (auto& result : results) {
+            result.get();
+        }
+
+        const auto elapsed = sw.elapsed_ns();
+        const auto operations = cycles * contenders;
+        std::printf("%-18s contenders=%-4zu %.1f ns/operation  (%zu operations)\n",
+                    name,
+                    contenders,
+                    elapsed / static_cast<double>(operations),
+                    operations);
+    }
+}  // namespace
+
+int main() {
+    print_header("async_shared_mutex 95/5 read/write");
+
+    const auto worker_count = std::max(std::thread::hardware_concurrency(), 4u);
+    const auto executor = std::make_shared<thread_pool_executor>("async_shared_mutex benchmark", worker_count, std::chrono::seconds(10));
+    std::printf("thread pool workers: %d\n", executor->max_concurrency_level());
+
+    for (const size_t contenders : {1, 2, 4, 8, 16, 32, 64}) {
+        run_workload<async_lock>("async_lock", executor, use_lock, contenders);
+        run_workload<async_shared_mutex>("async_shared_mutex", executor, use_shared_mutex, contenders);
+    }
+
+    executor->shutdown();
+    return 0;
+}
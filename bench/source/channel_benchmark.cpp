@@ -0,0 +1,190 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <deque>
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+/*
+    Measures message throughput between producer and consumer coroutines inside a thread pool, once through a
+    bounded channel and once through a std::deque guarded by an async_lock and an async_condition_variable.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    constexpr size_t k_total_messages = 400'000;
+    constexpr size_t k_capacity = 256;
+
+    struct locked_queue {
+        async_lock lock;
+        async_condition_variable not_empty;
+        async_condition_variable not_full;
+        std::deque<size_t> queue;
+        bool closed = false;
+    };
+
+    result<void> locked_produce(executor_tag, std::shared_ptr<executor> ex, locked_queue& q, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            auto guard = co_await q.lock.lock(ex);
+            co_await q.not_full.await(ex, guard, [&q] {
+                return q.queue.size() < k_capacity;
+            });
+
+            q.queue.push_back(i);
+            guard.unlock();
+            q.not_empty.notify_one();
+        }
+    }
+
+    result<size_t> locked_consume(executor_tag, std::shared_ptr<executor> ex, locked_queue& q) {
+        size_t received = 0;
+
+        while (true) {
+            auto guard = co_await q.lock.lock(ex);
+            co_await q.not_empty.await(ex, guard, [&q] {
+                return !q.queue.empty() || q.closed;
+            });
+
+            if (q.queue.empty()) {
+                co_return received;
+            }
+
+            q.queue.pop_front();
+            ++received;
+
+            guard.unlock();
+            q.not_full.notify_one();
+        }
+    }
+
+    template<channel_mode mode>
+    result<void> channel_produce(executor_tag, std::shared_ptr<executor> ex, channel<size_t, mode>& ch, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            co_await ch.send(ex, i);
+        }
+    }
+
+    template<channel_mode mode>
+    result<size_t> channel_consume(executor_tag, std::shared_ptr<executor> ex, channel<size_t, mode>& ch) {
+        size_t received = 0;
+        while (co_await ch.receive(ex)) {
+            ++received;
+        }
+
+        co_return received;
+    }
+
+    template<channel_mode mode>
+    result<size_t> channel_consume_batch(executor_tag, std::shared_ptr<executor> ex, channel<size_t, mode>& ch) {
+        size_t received = 0;
+
+        while (true) {
+            const auto batch = co_await ch.receive_batch(ex, 64);
+            if (batch.empty()) {
+                co_return received;
+            }
+
+            received += batch.size();
+        }
+    }
+
+    void report(const char* name, size_t producers, size_t consumers, double elapsed_ns, size_t messages) {
+        std::printf("%-22s %zux%-4zu %.1f ns/message  (%.2f M messages/s)\n",
+                    name,
+                    producers,
+                    consumers,
+                    elapsed_ns / static_cast<double>(messages),
+                    messages / elapsed_ns * 1'000.0);
+    }
+
+    void run_locked(std::shared_ptr<executor> ex, size_t producers, size_t consumers) {
+        locked_queue q;
+        const auto per_producer = k_total_messages / producers;
+
+        stopwatch sw;
+        std::vector<result<size_t>> consumer_results;
+        for (size_t i = 0; i < consumers; i++) {
+            consumer_results.emplace_back(locked_consume({}, ex, q));
+        }
+
+        std::vector<result<void>> producer_results;
+        for (size_t i = 0; i < producers; i++) {
+            producer_results.emplace_back(locked_produce({}, ex, q, per_producer));
+        }
+
+        for (auto& result : producer_results) {
+            result.get();
+        }
+
+        {
+            auto guard = q.lock.lock(ex).run().get();
+            q.closed = true;
+        }
+
+        q.not_empty.notify_all();
+
+        size_t received = 0;
+        for (auto& result : consumer_results) {
+            received += result.get();
+        }
+
+        report("async_lock + cv", producers, consumers, sw.elapsed_ns(), received);
+    }
+
+    template<channel_mode mode>
+    void run_channel(const char* name, std::shared_ptr<executor> ex, size_t producers, size_t consumers, bool batch) {
+        channel<size_t, mode> ch(k_capacity);
+        const auto per_producer = k_total_messages / producers;
+
+        stopwatch sw;
+        std::vector<result<size_t>> consumer_results;
+        for (size_t i = 0; i < consumers; i++) {
+            consumer_results.emplace_back(batch ? channel_consume_batch<mode>({}, ex, ch) : channel_consume<mode>({}, ex, ch));
+        }
+
+        std::vector<result<void>> producer_results;
+        for (size_t i = 0; i < producers; i++) {
+            producer_results.emplace_back(channel_produce<mode>({}, ex, ch, per_producer));
+        }
+
+        for (auto& result : producer_results) {
+            result.get();
+        }
+
+        ch.close();
+
+        size_t received = 0;
+        for (auto& result : consumer_results) {
+            received += result.get();
+        }
+
+        report(name, producers, consumers, sw.elapsed_ns(), received);
+    }
+}  // namespace
+
+int main() {
+    print_header("channel throughput");
+
+    const auto worker_count = std::max(std::thread::hardware_concurrency(), 4u);
+    const auto executor = std::make_shared<thread_pool_executor>("channel benchmark", worker_count, std::chrono::seconds(10));
+    std::printf("thread pool workers: %d, capacity: %zu\n", executor->max_concurrency_level(), k_capacity);
+
+    run_locked(executor, 1, 1);
+    run_channel<channel_mode::spsc>("channel spsc", executor, 1, 1, false);
+    run_channel<channel_mode::spsc>("channel spsc batch", executor, 1, 1, true);
+
+    run_locked(executor, 4, 1);
+    run_channel<channel_mode::mpsc>("channel mpsc", executor, 4, 1, false);
+    run_channel<channel_mode::mpsc>("channel mpsc batch", executor, 4, 1, true);
+
+    run_locked(executor, 4, 4);
+    run_channel<channel_mode::mpmc>("channel mpmc", executor, 4, 4, false);
+    run_channel<channel_mode::mpmc>("channel mpmc batch", executor, 4, 4, true);
+
+    executor->shutdown();
+    return 0;
+}
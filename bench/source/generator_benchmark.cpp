@@ -0,0 +1,132 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <span>
+#include <cstdio>
+#include <ranges>
+#include <vector>
+
+/*
+    Measures the per-element cost of consuming a generator, once with a co_yield per element and once with
+    batches yielded as std::span, against a plain loop over the same values.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    constexpr size_t k_element_count = 20'000'000;
+
+    generator<size_t> single_values(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            co_yield i;
+        }
+    }
+
+    generator<size_t> batched_values(size_t count, size_t batch_size) {
+        std::vector<size_t> batch(batch_size);
+
+        for (size_t i = 0; i < count; i += batch_size) {
+            const auto size = std::min(batch_size, count - i);
+            for (size_t j = 0; j < size; j++) {
+                batch[j] = i + j;
+            }
+
+            co_yield std::span<size_t>(batch.data(), size);
+        }
+    }
+
+    async_generator<size_t> async_single_values(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            co_yield i;
+        }
+    }
+
+    result<size_t> consume_async(size_t count) {
+        auto gen = async_single_values(count);
+        size_t sum = 0;
+        while (const auto value = co_await gen.next()) {
+            sum += *value;
+        }
+
+        co_return sum;
+    }
+
+    void report(const char* name, double elapsed_ns, size_t sum) {
+        std::printf("%-32s %6.2f ns/element  (checksum %zu)\n", name, elapsed_ns / k_element_count, sum);
+    }
+
+    void run_plain_loop() {
+        std::vector<size_t> values(k_element_count);
+        for (size_t i = 0; i < k_element_count; i++) {
+            values[i] = i;
+        }
+
+        stopwatch sw;
+        size_t sum = 0;
+        for (const auto value : values) {
+            sum += value;
+        }
+
+        report("plain loop (vector)", sw.elapsed_ns(), sum);
+    }
+
+    void run_single_values() {
+        stopwatch sw;
+        size_t sum = 0;
+        for (const auto value : single_values(k_element_count)) {
+            sum += value;
+        }
+
+        report("generator, co_yield value", sw.elapsed_ns(), sum);
+    }
+
+    void run_batched_values(size_t batch_size) {
+        stopwatch sw;
+        size_t sum = 0;
+        for (const auto value : batched_values(k_element_count, batch_size)) {
+            sum += value;
+        }
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "generator, co_yield span(%zu)", batch_size);
+        report(name, sw.elapsed_ns(), sum);
+    }
+
+    void run_batched_values_with_views() {
+        stopwatch sw;
+        size_t sum = 0;
+        for (const auto value : batched_values(k_element_count, 1024) | std::views::filter([](size_t i) {
+                                    return i % 2 == 0;
+                                }) | std::views::transform([](size_t i) {
+                                    return i / 2;
+                                })) {
+            sum += value;
+        }
+
+        report("span(1024) | filter | transform", sw.elapsed_ns(), sum);
+    }
+
+    void run_async_single_values() {
+        stopwatch sw;
+        const auto sum = consume_async(k_element_count).get();
+        report("async_generator, co_yield value", sw.elapsed_ns(), sum);
+    }
+}  // namespace
+
+int main() {
+    print_header("generator per-element overhead");
+    std::printf("elements: %zu\n", k_element_count);
+
+    run_plain_loop();
+    run_single_values();
+
+    for (const size_t batch_size : {16, 64, 256, 1024}) {
+        run_batched_values(batch_size);
+    }
+
+    run_batched_values_with_views();
+    run_async_single_values();
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+
+/*
+    Measures the stack usage and the per-hop cost of chains of inline continuations,
+    once with a direct inline_executor and once with a trampolined one.
+    The direct executor nests one call frame per hop, so its chains are kept short enough not to overflow the stack.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    struct chain_context {
+        std::shared_ptr<inline_executor> executor;
+        stack_probe probe;
+        size_t counter = 0;
+        size_t depth = 0;
+    };
+
+    struct recursive_poster {
+        chain_context& ctx;
+
+        void operator()() const {
+            ctx.probe.sample();
+            if (++ctx.counter == ctx.depth) {
+                return;
+            }
+
+            ctx.executor->post(*this);
+        }
+    };
+
+    result<void> resume_on_chain(chain_context& ctx) {
+        for (size_t i = 0; i < ctx.depth; i++) {
+            co_await resume_on(*ctx.executor);
+            ctx.probe.sample();
+            ++ctx.counter;
+        }
+    }
+
+    void run_post_chain(bool trampolined, size_t depth) {
+        chain_context ctx;
+        ctx.executor = std::make_shared<inline_executor>(trampolined);
+        ctx.depth = depth;
+
+        ctx.probe.start();
+        stopwatch sw;
+        ctx.executor->post(recursive_poster {ctx});
+        const auto elapsed = sw.elapsed_ns();
+
+        std::printf("%-12s post chain       depth=%-9zu stack=%-10zu bytes  %.1f ns/hop\n",
+                    trampolined ? "trampolined" : "direct",
+                    ctx.counter,
+                    ctx.probe.max_depth_bytes(),
+                    elapsed / static_cast<double>(ctx.counter));
+    }
+
+    void run_resume_on_chain(bool trampolined, size_t depth) {
+        chain_context ctx;
+        ctx.executor = std::make_shared<inline_executor>(trampolined);
+        ctx.depth = depth;
+
+        ctx.probe.start();
+        stopwatch sw;
+        resume_on_chain(ctx).get();
+        const auto elapsed = sw.elapsed_ns();
+
+        std::printf("%-12s resume_on chain  depth=%-9zu stack=%-10zu bytes  %.1f ns/hop\n",
+                    trampolined ? "trampolined" : "direct",
+                    ctx.counter,
+                    ctx.probe.max_depth_bytes(),
+                    elapsed / static_cast<double>(ctx.counter));
+    }
+}  // namespace
+
+int main() {
+    print_header("inline_executor recursion depth");
+
+    for (const size_t depth : {1'000, 10'000}) {
+        run_post_chain(false, depth);
+        run_post_chain(true, depth);
+    }
+
+    run_post_chain(true, 10'000'000);
+
+    for (const size_t depth : {1'000, 10'000}) {
+        run_resume_on_chain(false, depth);
+        run_resume_on_chain(true, depth);
+    }
+
+    run_resume_on_chain(true, 10'000'000);
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+
+/*
+    Measures the stack usage and the per-link cost of resuming a deep chain of coroutines,
+    each one co_awaiting the result of the previous one.
+    The chain is built while every link is suspended, then the first link is completed and the whole chain unwinds.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    stack_probe s_probe;
+
+    result<size_t> await_chain_link(result<size_t> inner_result) {
+        const auto value = co_await inner_result;
+        s_probe.sample();
+        co_return value + 1;
+    }
+
+    void run_await_chain(size_t depth) {
+        result_promise<size_t> rp;
+        auto chain = rp.get_result();
+
+        stopwatch build_sw;
+        for (size_t i = 0; i < depth; i++) {
+            chain = await_chain_link(std::move(chain));
+        }
+        const auto build_elapsed = build_sw.elapsed_ns();
+
+        s_probe.start();
+        stopwatch resume_sw;
+        rp.set_result(0);
+        const auto resume_elapsed = resume_sw.elapsed_ns();
+
+        const auto links = chain.get();
+
+        std::printf("await chain  depth=%-9zu stack=%-10zu bytes  build %.1f ns/link  resume %.1f ns/link\n",
+                    links,
+                    s_probe.max_depth_bytes(),
+                    build_elapsed / static_cast<double>(depth),
+                    resume_elapsed / static_cast<double>(depth));
+    }
+}  // namespace
+
+int main() {
+    print_header("result<T> deep await chain");
+
+    for (const size_t depth : {1'000, 10'000, 1'000'000}) {
+        run_await_chain(depth);
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+#include <vector>
+
+/*
+    Measures the latency between setting the value of a shared_result and the last of its awaiters finishing,
+    once with the awaiters resumed inline by the producer and once with them resumed by a thread pool.
+    Each awaiter does a small, fixed amount of work after it is resumed, like a cache consumer would.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    constexpr size_t k_continuation_work = 256;
+
+    struct fan_out_context {
+        std::atomic_size_t pending {0};
+        std::atomic_size_t checksum {0};
+    };
+
+    void busy_work(size_t value, fan_out_context& ctx) {
+        size_t hash = value;
+        for (size_t i = 0; i < k_continuation_work; i++) {
+            hash = hash * 31 + i;
+        }
+
+        ctx.checksum.fetch_add(hash, std::memory_order_relaxed);
+    }
+
+    result<void> await_shared(shared_result<size_t> sr, fan_out_context& ctx) {
+        const auto value = co_await sr;
+        busy_work(value, ctx);
+
+        if (ctx.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            ctx.pending.notify_one();
+        }
+    }
+
+    void run_fan_out(const char* name, std::shared_ptr<thread_pool_executor> resume_executor, size_t awaiter_count) {
+        fan_out_context ctx;
+        ctx.pending.store(awaiter_count);
+
+        result_promise<size_t> rp;
+        shared_result<size_t> sr = static_cast<bool>(resume_executor) ? shared_result<size_t>(rp.get_result(), resume_executor) :
+                                                                         shared_result<size_t>(rp.get_result());
+
+        std::vector<result<void>> awaiters;
+        awaiters.reserve(awaiter_count);
+
+        for (size_t i = 0; i < awaiter_count; i++) {
+            awaiters.emplace_back(await_shared(sr, ctx));
+        }
+
+        stopwatch sw;
+        rp.set_result(7);
+        const auto producer_elapsed = sw.elapsed_ns();
+
+        for (auto pending = ctx.pending.load(std::memory_order_acquire); pending != 0; pending = ctx.pending.load(std::memory_order_acquire)) {
+            ctx.pending.wait(pending, std::memory_order_acquire);
+        }
+
+        const auto elapsed = sw.elapsed_ns();
+
+        for (auto& awaiter : awaiters) {
+            awaiter.get();
+        }
+
+        std::printf("%-10s awaiters=%-8zu fan-out=%-12.1f us  producer blocked=%-12.1f us  %.1f ns/awaiter\n",
+                    name,
+                    awaiter_count,
+                    elapsed / 1'000.0,
+                    producer_elapsed / 1'000.0,
+                    elapsed / static_cast<double>(awaiter_count));
+    }
+}  // namespace
+
+int main() {
+    print_header("shared_result awaiter fan-out");
+
+    runtime runtime;
+    const auto executor = runtime.thread_pool_executor();
+    std::printf("thread pool workers: %d\n", executor->max_concurrency_level());
+
+    for (const size_t awaiter_count : {1, 1'000, 100'000}) {
+        run_fan_out("inline", {}, awaiter_count);
+        run_fan_out("executor", executor, awaiter_count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/threads/constants.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+/*
+    Measures the round trip latency of submitting a short task from a regular thread and blocking on its result,
+    with the spin phase of result::get disabled and with it enabled.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    size_t short_task(size_t work) noexcept {
+        size_t hash = work;
+        for (size_t i = 0; i < work; i++) {
+            hash = hash * 31 + i;
+        }
+
+        return hash;
+    }
+
+    template<class executor_type>
+    void run_round_trips(const char* executor_name, executor_type& executor, size_t spin_limit, size_t work, size_t rounds) {
+        set_wait_spin_limit(spin_limit);
+
+        std::vector<double> samples;
+        samples.reserve(rounds);
+
+        for (size_t i = 0; i < rounds; i++) {
+            stopwatch sw;
+            executor.submit(short_task, work).get();
+            samples.emplace_back(sw.elapsed_ns());
+        }
+
+        std::sort(samples.begin(), samples.end());
+        std::printf("%-22s spin limit=%-6zu work=%-6zu p50=%-10.1f ns  p99=%-10.1f ns\n",
+                    executor_name,
+                    spin_limit,
+                    work,
+                    samples[samples.size() / 2],
+                    samples[samples.size() * 99 / 100]);
+    }
+}  // namespace
+
+int main() {
+    print_header("submit + get round trip latency");
+    std::printf("hardware threads: %u, default spin limit: %zu\n", std::thread::hardware_concurrency(), wait_spin_limit());
+
+    const auto default_spin_limit = details::consts::k_default_wait_spin_limit;
+
+    runtime runtime;
+    auto worker_thread = runtime.make_worker_thread_executor();
+    auto thread_pool = runtime.thread_pool_executor();
+
+    // make sure the executors' threads are up before measuring.
+    worker_thread->submit([] {}).get();
+    thread_pool->submit([] {}).get();
+
+    for (const size_t work : {0, 1'000}) {
+        for (const size_t spin_limit : {size_t(0), default_spin_limit}) {
+            run_round_trips("worker_thread_executor", *worker_thread, spin_limit, work, 20'000);
+            run_round_trips("thread_pool_executor", *thread_pool, spin_limit, work, 20'000);
+        }
+    }
+
+    return 0;
+}
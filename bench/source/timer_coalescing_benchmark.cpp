@@ -0,0 +1,140 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <mutex>
+#include <atomic>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#ifdef __linux__
+#    include <sys/resource.h>
+#endif
+
+/*
+    Measures how many times the timer_queue thread wakes up to fire 10,000 one-shot timers that are due within one second,
+    with different per-timer slacks and queue coalescing windows.
+    Every wake up hands the expired timers to the executor in one enqueue call, so the number of enqueue calls is the
+    number of wake ups that fired timers. Also reports how late the timers fired and the context switches of the process.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+using namespace std::chrono_literals;
+
+namespace {
+    using clock_type = timer_queue::clock_type;
+
+    // runs the tasks on the timer_queue thread and counts the enqueue calls.
+    class counting_executor final : public executor {
+
+       private:
+        std::atomic_size_t m_enqueue_calls {0};
+
+       public:
+        counting_executor() : executor("counting_executor") {}
+
+        void enqueue(task task) override {
+            ++m_enqueue_calls;
+            task();
+        }
+
+        void enqueue(std::span<task> tasks) override {
+            ++m_enqueue_calls;
+            for (auto& task : tasks) {
+                task();
+            }
+        }
+
+        int max_concurrency_level() const noexcept override {
+            return 1;
+        }
+
+        bool shutdown_requested() const noexcept override {
+            return false;
+        }
+
+        void shutdown() noexcept override {}
+
+        size_t enqueue_calls() const noexcept {
+            return m_enqueue_calls.load();
+        }
+    };
+
+    long context_switches() noexcept {
+#ifdef __linux__
+        rusage usage {};
+        ::getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_nvcsw + usage.ru_nivcsw;
+#else
+        return 0;
+#endif
+    }
+
+    constexpr size_t k_timer_count = 10'000;
+
+    void run(std::chrono::milliseconds slack, std::chrono::milliseconds coalescing_window) {
+        auto queue = std::make_shared<timer_queue>(120s, nullptr, nullptr, timer_queue_backend::ordered_set, coalescing_window);
+        const auto executor = std::make_shared<counting_executor>();
+
+        std::mt19937 engine(1234);
+        std::uniform_int_distribution<size_t> due_times(200, 1'199);
+
+        std::mutex lock;
+        std::vector<double> lateness_ms;
+        lateness_ms.reserve(k_timer_count);
+        std::atomic_size_t fired = 0;
+
+        const auto switches_before = context_switches();
+
+        std::vector<timer> timers;
+        timers.reserve(k_timer_count);
+        for (size_t i = 0; i < k_timer_count; i++) {
+            const auto due_time = std::chrono::milliseconds(due_times(engine));
+            const auto deadline = clock_type::now() + due_time;
+
+            timers.emplace_back(queue->make_one_shot_timer(due_time, slack, executor, [&, deadline] {
+                const auto lateness = std::chrono::duration<double, std::milli>(clock_type::now() - deadline).count();
+
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    lateness_ms.emplace_back(lateness);
+                }
+
+                ++fired;
+            }));
+        }
+
+        while (fired.load() != k_timer_count) {
+            std::this_thread::sleep_for(50ms);
+        }
+
+        const auto switches = context_switches() - switches_before;
+        queue->shutdown();
+
+        std::sort(lateness_ms.begin(), lateness_ms.end());
+        std::printf("slack=%-4lld window=%-4lld wakeups=%-6zu context switches=%-6ld lateness p50=%6.2f ms  p99=%6.2f ms  max=%6.2f ms\n",
+                    static_cast<long long>(slack.count()),
+                    static_cast<long long>(coalescing_window.count()),
+                    executor->enqueue_calls(),
+                    switches,
+                    lateness_ms[lateness_ms.size() / 2],
+                    lateness_ms[lateness_ms.size() * 99 / 100],
+                    lateness_ms.back());
+    }
+}  // namespace
+
+int main() {
+    print_header("timer coalescing, 10000 timers due within 1s");
+
+    run(0ms, 0ms);
+    run(1ms, 0ms);
+    run(5ms, 0ms);
+    run(20ms, 0ms);
+    run(50ms, 0ms);
+    run(0ms, 20ms);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+#ifdef __linux__
+#    include <sys/resource.h>
+#endif
+
+/*
+    Measures how late delay objects resume, with due times of 100us to 1ms and different spin windows of the timer_queue
+    thread. A coroutine awaits 2,000 consecutive delay objects that resume inline on the timer_queue thread, the lateness
+    of every one of them is the time it resumed minus the time it was due.
+    Also reports the cpu time the process used, which shows the cost of spinning.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+using namespace std::chrono_literals;
+
+namespace {
+    using clock_type = timer_queue::clock_type;
+
+    constexpr size_t k_delay_count = 2'000;
+
+    double cpu_time_ms() noexcept {
+#ifdef __linux__
+        rusage usage {};
+        ::getrusage(RUSAGE_SELF, &usage);
+        const auto to_ms = [](const timeval& time) {
+            return time.tv_sec * 1'000.0 + time.tv_usec / 1'000.0;
+        };
+        return to_ms(usage.ru_utime) + to_ms(usage.ru_stime);
+#else
+        return 0;
+#endif
+    }
+
+    result<void> await_delays(std::shared_ptr<timer_queue> queue,
+                              std::shared_ptr<executor> executor,
+                              std::chrono::nanoseconds due_time,
+                              std::vector<double>& lateness_us) {
+        for (size_t i = 0; i < k_delay_count; i++) {
+            const auto deadline = clock_type::now() + due_time;
+            co_await queue->make_delay_object(due_time, executor);
+            lateness_us.emplace_back(std::chrono::duration<double, std::micro>(clock_type::now() - deadline).count());
+        }
+    }
+
+    void run(std::chrono::nanoseconds due_time, std::chrono::microseconds spin_window) {
+        auto queue = std::make_shared<timer_queue>(120s, nullptr, nullptr, timer_queue_backend::ordered_set, 0ms, false, spin_window);
+        const auto executor = std::make_shared<inline_executor>();
+
+        std::vector<double> lateness_us;
+        lateness_us.reserve(k_delay_count);
+
+        const auto cpu_before = cpu_time_ms();
+        stopwatch sw;
+
+        await_delays(queue, executor, due_time, lateness_us).get();
+
+        const auto elapsed_ms = sw.elapsed_ms();
+        const auto cpu_ms = cpu_time_ms() - cpu_before;
+
+        std::sort(lateness_us.begin(), lateness_us.end());
+        std::printf("due=%-5lldus spin window=%-4lldus lateness p50=%8.1f us  p99=%8.1f us  max=%8.1f us  cpu %5.0f%%\n",
+                    static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(due_time).count()),
+                    static_cast<long long>(spin_window.count()),
+                    lateness_us[lateness_us.size() / 2],
+                    lateness_us[lateness_us.size() * 99 / 100],
+                    lateness_us.back(),
+                    cpu_ms * 100.0 / elapsed_ms);
+
+        executor->shutdown();
+        queue->shutdown();
+    }
+}  // namespace
+
+int main() {
+    print_header("timer jitter, 2000 consecutive delay objects");
+
+    for (const auto due_time : {100us, 500us, 1000us}) {
+        for (const auto spin_window : {0us, 50us, 200us}) {
+            run(due_time, spin_window);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <latch>
+#include <cstdio>
+#include <vector>
+#include <cstdlib>
+
+/*
+    Measures the throughput of timer_queue::make_delay_object when the 32 workers of a thread pool create delay objects
+    at the same time, once through the timer_queue thread and once with worker local timers. Every worker creates and
+    starts its delay objects, the main thread waits for all of them. The registration rate is the number of delay objects
+    created per second by all workers, the total time also includes waiting for the delay objects to expire and resume.
+    The number of delay objects per worker can be given as the first argument.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+using namespace std::chrono_literals;
+
+namespace {
+    constexpr size_t k_worker_count = 32;
+
+    void run(bool worker_local_timers, size_t delays_per_worker) {
+        auto queue = std::make_shared<timer_queue>(120s, nullptr, nullptr, timer_queue_backend::timing_wheel, 0ms, worker_local_timers);
+        const auto thread_pool = std::make_shared<thread_pool_executor>("threadpool", k_worker_count, 120s);
+        const auto executor = std::make_shared<inline_executor>();
+
+        std::latch registered_latch(k_worker_count);
+        std::vector<std::vector<result<void>>> delays(k_worker_count);
+        std::vector<result<void>> registrations;
+        registrations.reserve(k_worker_count);
+
+        stopwatch sw;
+
+        // the workers don't wait for their delay objects, a worker that blocks never fires its local timers.
+        for (size_t i = 0; i < k_worker_count; i++) {
+            registrations.emplace_back(thread_pool->submit([&, i] {
+                auto& worker_delays = delays[i];
+                worker_delays.reserve(delays_per_worker);
+
+                for (size_t j = 0; j < delays_per_worker; j++) {
+                    worker_delays.emplace_back(queue->make_delay_object(10ms + std::chrono::milliseconds(j % 10), executor).run());
+                }
+
+                registered_latch.count_down();
+            }));
+        }
+
+        registered_latch.wait();
+        const auto registration_ms = sw.elapsed_ms();
+
+        for (auto& registration : registrations) {
+            registration.get();
+        }
+
+        for (auto& worker_delays : delays) {
+            for (auto& delay : worker_delays) {
+                delay.get();
+            }
+        }
+
+        const auto total_ms = sw.elapsed_ms();
+        const auto delay_count = k_worker_count * delays_per_worker;
+
+        std::printf("%-13s delay objects=%-8zu registration %8.1f ms (%10.0f per second)  total %8.1f ms\n",
+                    worker_local_timers ? "worker local" : "timer thread",
+                    delay_count,
+                    registration_ms,
+                    delay_count / (registration_ms / 1'000.0),
+                    total_ms);
+
+        thread_pool->shutdown();
+        executor->shutdown();
+        queue->shutdown();
+    }
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+    const size_t delays_per_worker = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 20'000;
+
+    print_header("timer_queue worker local timers, make_delay_object from 32 thread pool workers");
+
+    run(false, delays_per_worker);
+    run(true, delays_per_worker);
+
+    return 0;
+}
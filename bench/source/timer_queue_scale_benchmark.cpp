@@ -0,0 +1,114 @@
+#include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/timers/timer_queue_internal.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+#include <random>
+#include <cstdlib>
+
+/*
+    Measures the timer containers of timer_queue (the ordered set and the timing wheel) with 10^3 to 10^7 pending timers:
+    the cost of inserting a timer, of cancelling one and of expiring one, when the timer thread wakes up every millisecond.
+    Cancelling a timer only marks it, the cost of cancelling includes sweeping the cancelled timers out of the container.
+    The containers are driven directly with a simulated clock, so the numbers don't include waiting for deadlines.
+    The largest size needs a few GB of memory, the highest power of ten can be given as the first argument.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+using namespace std::chrono_literals;
+
+namespace {
+    // fired timers post their task here, the task is dropped right away.
+    struct discarding_executor final : public executor {
+        discarding_executor() : executor("discarding_executor") {}
+
+        void enqueue(task) override {}
+        void enqueue(std::span<task>) override {}
+
+        int max_concurrency_level() const noexcept override {
+            return 1;
+        }
+
+        bool shutdown_requested() const noexcept override {
+            return false;
+        }
+
+        void shutdown() noexcept override {}
+    };
+
+    struct noop_callable {
+        void operator()() const noexcept {}
+    };
+
+    using timer_ptr = timer_queue::timer_ptr;
+
+    constexpr size_t k_max_due_time_ms = 60'000;
+
+    void run(timer_queue_backend backend, size_t timer_count) {
+        const auto executor = std::make_shared<discarding_executor>();
+        std::mt19937_64 engine(timer_count);
+        std::uniform_int_distribution<size_t> due_times(1, k_max_due_time_ms);
+
+        auto container = details::timer_queue_internal::make(backend);
+        const auto start = timer_queue::clock_type::now();
+
+        std::vector<timer_ptr> timers;
+        timers.reserve(timer_count);
+        for (size_t i = 0; i < timer_count; i++) {
+            timers.emplace_back(details::make_timer_state<details::timer_state<noop_callable>>(std::chrono::milliseconds(due_times(engine)),
+                                                                                               0ms,
+                                                                                               0ms,
+                                                                                               executor,
+                                                                                               std::weak_ptr<timer_queue> {},
+                                                                                               true,
+                                                                                               noop_callable {}));
+        }
+
+        stopwatch insert_sw;
+        for (const auto& timer : timers) {
+            container->add(timer);
+        }
+        const auto insert_ns = insert_sw.elapsed_ns() / static_cast<double>(timer_count);
+
+        // every other timer is cancelled, in the order they were created.
+        const auto cancel_count = timer_count / 2;
+        stopwatch cancel_sw;
+        for (size_t i = 0; i < timer_count; i += 2) {
+            timers[i]->cancel();
+        }
+        container->remove_cancelled();
+        const auto cancel_ns = cancel_sw.elapsed_ns() / static_cast<double>(cancel_count);
+
+        timers.clear();  // the container holds the last references
+
+        const auto expired_count = container->size();
+        stopwatch expire_sw;
+        for (auto now = start; !container->empty(); now += 1ms) {
+            container->process_expired(now);
+        }
+        const auto expire_ns = expire_sw.elapsed_ns() / static_cast<double>(expired_count);
+
+        std::printf("%-13s timers=%-9zu insert %8.1f ns  cancel %8.1f ns  expire %8.1f ns  (per timer)\n",
+                    backend == timer_queue_backend::ordered_set ? "ordered_set" : "timing_wheel",
+                    timer_count,
+                    insert_ns,
+                    cancel_ns,
+                    expire_ns);
+    }
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+    const auto max_power = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 7;
+
+    print_header("timer_queue containers scale");
+
+    size_t timer_count = 1'000;
+    for (size_t power = 3; power <= max_power; power++, timer_count *= 10) {
+        run(timer_queue_backend::ordered_set, timer_count);
+        run(timer_queue_backend::timing_wheel, timer_count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <new>
+
+/*
+    Measures the heap allocations and the throughput of coroutines that sleep repeatedly, with
+    timer_queue::make_delay_object and with timer_queue::sleep_for. 1 or 64 coroutines await sleeps in a loop and resume
+    inline on the timer_queue thread, so every sleep is a full round trip through the timer_queue. The sleeps have a
+    deadline that already passed, so the millisecond resolution of the timing wheel doesn't hide the cost of a sleep.
+    Allocations are counted by replacing the global operator new.
+*/
+
+namespace {
+    std::atomic_size_t g_allocations = 0;
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+using namespace std::chrono_literals;
+
+namespace {
+    constexpr size_t k_total_sleeps = 200'000;
+    constexpr auto k_due_time = -1s;
+
+    enum class sleep_kind { delay_object, sleep_for };
+
+    result<void> sleeper(std::shared_ptr<timer_queue> queue, std::shared_ptr<executor> executor, sleep_kind kind, size_t sleeps) {
+        for (size_t i = 0; i < sleeps; i++) {
+            if (kind == sleep_kind::delay_object) {
+                co_await queue->make_delay_object(k_due_time, executor);
+            } else {
+                co_await queue->sleep_for(k_due_time, executor);
+            }
+        }
+    }
+
+    void run(timer_queue_backend backend, sleep_kind kind, size_t coroutine_count) {
+        auto queue = std::make_shared<timer_queue>(120s, nullptr, nullptr, backend);
+        const auto executor = std::make_shared<inline_executor>();
+
+        // warms up the timer_queue thread and its containers.
+        sleeper(queue, executor, kind, 1'000).get();
+
+        std::vector<result<void>> sleepers;
+        sleepers.reserve(coroutine_count);
+
+        const auto allocations_before = g_allocations.load();
+        stopwatch sw;
+
+        for (size_t i = 0; i < coroutine_count; i++) {
+            sleepers.emplace_back(sleeper(queue, executor, kind, k_total_sleeps / coroutine_count));
+        }
+
+        for (auto& sleeper : sleepers) {
+            sleeper.get();
+        }
+
+        const auto elapsed_ms = sw.elapsed_ms();
+        const auto allocations = g_allocations.load() - allocations_before;
+
+        std::printf("%-13s %-17s coroutines=%-3zu allocations per sleep %6.2f  %10.0f sleeps per second\n",
+                    backend == timer_queue_backend::ordered_set ? "ordered_set" : "timing_wheel",
+                    kind == sleep_kind::delay_object ? "make_delay_object" : "sleep_for",
+                    coroutine_count,
+                    static_cast<double>(allocations) / k_total_sleeps,
+                    k_total_sleeps / (elapsed_ms / 1'000.0));
+
+        executor->shutdown();
+        queue->shutdown();
+    }
+}  // namespace
+
+int main() {
+    print_header("timer sleep, 200000 sleeps");
+
+    for (const auto backend : {timer_queue_backend::ordered_set, timer_queue_backend::timing_wheel}) {
+        for (const auto kind : {sleep_kind::delay_object, sleep_kind::sleep_for}) {
+            for (const size_t coroutine_count : {1, 64}) {
+                run(backend, kind, coroutine_count);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/timers/timer_queue_internal.h"
+
+#include "infra/benchmark.h"
+
+#include <atomic>
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+/*
+    Measures a timeout storm: 10,000 one-shot timers that share the same deadline and fire on a thread pool of 4 workers.
+    The dispatch latency is the time from the deadline until the last timer callable ran. It is measured when the timer
+    queue hands every executor its expired timers in one bulk enqueue, and when every timer is posted on its own, which is
+    simulated by an executor that forwards a bulk enqueue task by task.
+    The cost of expiring the storm inside the timer containers is measured separately, with a simulated clock.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+using namespace std::chrono_literals;
+
+namespace {
+    using clock_type = timer_queue::clock_type;
+
+    constexpr size_t k_timer_count = 10'000;
+    constexpr size_t k_rounds = 5;
+
+    // posts the tasks of a bulk enqueue one by one, like the timer queue did before batching.
+    class per_task_executor final : public executor {
+
+       private:
+        const std::shared_ptr<executor> m_executor;
+
+       public:
+        per_task_executor(std::shared_ptr<executor> executor) : concurrencpp::executor("per_task_executor"), m_executor(std::move(executor)) {}
+
+        void enqueue(task task) override {
+            m_executor->enqueue(std::move(task));
+        }
+
+        void enqueue(std::span<task> tasks) override {
+            for (auto& task : tasks) {
+                m_executor->enqueue(std::move(task));
+            }
+        }
+
+        int max_concurrency_level() const noexcept override {
+            return m_executor->max_concurrency_level();
+        }
+
+        bool shutdown_requested() const noexcept override {
+            return m_executor->shutdown_requested();
+        }
+
+        void shutdown() noexcept override {}
+    };
+
+    struct discarding_executor final : public executor {
+        discarding_executor() : executor("discarding_executor") {}
+
+        void enqueue(task) override {}
+        void enqueue(std::span<task>) override {}
+
+        int max_concurrency_level() const noexcept override {
+            return 1;
+        }
+
+        bool shutdown_requested() const noexcept override {
+            return false;
+        }
+
+        void shutdown() noexcept override {}
+    };
+
+    struct noop_callable {
+        void operator()() const noexcept {}
+    };
+
+    double storm_latency_ms(timer_queue_backend backend, bool batched) {
+        auto queue = std::make_shared<timer_queue>(120s, nullptr, nullptr, backend);
+        const auto pool = std::make_shared<thread_pool_executor>("storm pool", 4, 10s);
+        const auto executor = batched ? std::shared_ptr<concurrencpp::executor>(pool) : std::make_shared<per_task_executor>(pool);
+
+        std::atomic_size_t remaining = k_timer_count;
+        std::atomic<clock_type::time_point> last_run {};
+
+        const auto deadline = clock_type::now() + 300ms;
+        std::vector<timer> timers;
+        timers.reserve(k_timer_count);
+
+        for (size_t i = 0; i < k_timer_count; i++) {
+            timers.emplace_back(queue->make_one_shot_timer(deadline - clock_type::now(), executor, [&] {
+                if (remaining.fetch_sub(1) == 1) {
+                    last_run = clock_type::now();
+                }
+            }));
+        }
+
+        while (remaining.load() != 0) {
+            std::this_thread::sleep_for(10ms);
+        }
+
+        queue->shutdown();
+        pool->shutdown();
+
+        return std::chrono::duration<double, std::milli>(last_run.load() - deadline).count();
+    }
+
+    double expire_ns_per_timer(timer_queue_backend backend) {
+        const auto executor = std::make_shared<discarding_executor>();
+        auto container = details::timer_queue_internal::make(backend);
+
+        for (size_t i = 0; i < k_timer_count; i++) {
+            container->add(details::make_timer_state<details::timer_state<noop_callable>>(100ms,
+                                                                                          0ms,
+                                                                                          0ms,
+                                                                                          executor,
+                                                                                          std::weak_ptr<timer_queue> {},
+                                                                                          true,
+                                                                                          noop_callable {}));
+        }
+
+        stopwatch sw;
+        container->process_expired(clock_type::now() + 1s);
+        return sw.elapsed_ns() / k_timer_count;
+    }
+
+    const char* backend_name(timer_queue_backend backend) noexcept {
+        return backend == timer_queue_backend::ordered_set ? "ordered_set" : "timing_wheel";
+    }
+}  // namespace
+
+int main() {
+    print_header("timer storm, 10000 timers with the same deadline");
+
+    for (const auto backend : {timer_queue_backend::ordered_set, timer_queue_backend::timing_wheel}) {
+        for (const auto batched : {false, true}) {
+            std::vector<double> latencies;
+            for (size_t i = 0; i < k_rounds; i++) {
+                latencies.emplace_back(storm_latency_ms(backend, batched));
+            }
+
+            std::sort(latencies.begin(), latencies.end());
+            std::printf("%-13s %-16s dispatch latency median %7.2f ms  best %7.2f ms\n",
+                        backend_name(backend),
+                        batched ? "bulk enqueue" : "enqueue per timer",
+                        latencies[latencies.size() / 2],
+                        latencies.front());
+        }
+    }
+
+    for (const auto backend : {timer_queue_backend::ordered_set, timer_queue_backend::timing_wheel}) {
+        std::vector<double> costs;
+        for (size_t i = 0; i < k_rounds; i++) {
+            costs.emplace_back(expire_ns_per_timer(backend));
+        }
+
+        std::sort(costs.begin(), costs.end());
+        std::printf("%-13s expiring the storm %7.1f ns per timer (median)\n", backend_name(backend), costs[costs.size() / 2]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <cstdio>
+#include <vector>
+
+/*
+    Measures the latency of joining a fan-out of tasks submitted to a thread pool,
+    once with when_all and once by co_awaiting each result in turn, the way when_all used to join its inputs.
+*/
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    std::vector<result<size_t>> fan_out(thread_pool_executor& executor, size_t width) {
+        std::vector<result<size_t>> results;
+        results.reserve(width);
+
+        for (size_t i = 0; i < width; i++) {
+            results.emplace_back(executor.submit([i] {
+                return i;
+            }));
+        }
+
+        return results;
+    }
+
+    result<size_t> join_with_when_all(std::shared_ptr<thread_pool_executor> executor, size_t width) {
+        auto inputs = fan_out(*executor, width);
+        auto results = co_await when_all(executor, inputs.begin(), inputs.end());
+
+        size_t sum = 0;
+        for (auto& result : results) {
+            sum += co_await result;
+        }
+
+        co_return sum;
+    }
+
+    result<size_t> join_sequentially(std::shared_ptr<thread_pool_executor> executor, size_t width) {
+        auto results = fan_out(*executor, width);
+
+        size_t sum = 0;
+        for (auto& result : results) {
+            sum += co_await result;
+        }
+
+        co_await resume_on(executor);
+        co_return sum;
+    }
+
+    template<class join_type>
+    void run_join(const char* name, join_type join, std::shared_ptr<thread_pool_executor> executor, size_t width, size_t rounds) {
+        stopwatch sw;
+        for (size_t i = 0; i < rounds; i++) {
+            join(executor, width).get();
+        }
+
+        const auto elapsed = sw.elapsed_ns();
+        std::printf("%-12s width=%-6zu %.2f us/round  %.1f ns/result\n",
+                    name,
+                    width,
+                    elapsed / rounds / 1'000.0,
+                    elapsed / rounds / static_cast<double>(width));
+    }
+}  // namespace
+
+int main() {
+    print_header("when_all fan-out join");
+
+    runtime runtime;
+    const auto executor = runtime.thread_pool_executor();
+
+    for (const size_t width : {16, 1'024, 16'384}) {
+        const auto rounds = 1'000'000 / width;
+        run_join("sequential", join_sequentially, executor, width, rounds);
+        run_join("when_all", join_with_when_all, executor, width, rounds);
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/benchmark.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/*
+    Measures the cost of guarding a result with a timeout when the result wins, which is the common case.
+    A coroutine awaits a pending result, which the benchmark thread then completes, resuming the coroutine inline.
+    The result is awaited directly, with with_timeout, and with when_any against a delay object, which was the way to
+    express a timeout before with_timeout. The delay objects of when_any are never cancelled and stay in the timer_queue
+    until they expire. Allocations are counted by replacing the global operator new.
+*/
+
+namespace {
+    std::atomic_size_t g_allocations = 0;
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+using namespace std::chrono_literals;
+
+namespace {
+    constexpr size_t k_total_awaits = 100'000;
+    constexpr auto k_timeout = 10s;
+
+    enum class await_kind { plain, with_timeout, when_any };
+
+    const char* kind_name(await_kind kind) noexcept {
+        switch (kind) {
+            case await_kind::plain:
+                return "co_await";
+            case await_kind::with_timeout:
+                return "with_timeout";
+            case await_kind::when_any:
+                return "when_any+delay";
+        }
+
+        return "";
+    }
+
+    result<int> consumer(result<int> result, std::shared_ptr<timer_queue> queue, std::shared_ptr<executor> executor, await_kind kind) {
+        switch (kind) {
+            case await_kind::plain: {
+                co_return co_await result;
+            }
+
+            case await_kind::with_timeout: {
+                auto outcome = co_await with_timeout(std::move(result), queue, k_timeout, executor);
+                co_return outcome.get();
+            }
+
+            case await_kind::when_any: {
+                auto any = co_await when_any(executor, std::move(result), queue->make_delay_object(k_timeout, executor).run());
+                co_return std::get<0>(any.results).get();
+            }
+        }
+
+        co_return 0;
+    }
+
+    void run(await_kind kind) {
+        auto queue = std::make_shared<timer_queue>(120s);
+        const auto executor = std::make_shared<inline_executor>();
+
+        const auto allocations_before = g_allocations.load();
+        stopwatch sw;
+
+        for (size_t i = 0; i < k_total_awaits; i++) {
+            result_promise<int> promise;
+            auto awaiting = consumer(promise.get_result(), queue, executor, kind);
+            promise.set_result(static_cast<int>(i));
+            awaiting.get();
+        }
+
+        const auto elapsed_ns = sw.elapsed_ns();
+        const auto allocations = g_allocations.load() - allocations_before;
+
+        std::printf("%-15s %8.1f ns per await  allocations per await %5.2f\n",
+                    kind_name(kind),
+                    static_cast<double>(elapsed_ns) / k_total_awaits,
+                    static_cast<double>(allocations) / k_total_awaits);
+
+        queue->shutdown();
+        executor->shutdown();
+    }
+}  // namespace
+
+int main() {
+    print_header("timeout on the success path, 100000 awaits");
+
+    for (const auto kind : {await_kind::plain, await_kind::with_timeout, await_kind::when_any}) {
+        run(kind);
+    }
+
+    return 0;
+}
@@ -7,6 +7,9 @@ function(target_coroutine_options TARGET)
   elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
     set_target_properties(${TARGET} PROPERTIES CXX_EXTENSIONS NO)
   elseif(CMAKE_CXX_COMPILER_ID MATCHES "GNU")
+    # GCC emits symmetric transfer as a tail call only with sibling call optimization, which is off below -O2.
+    # Without it, every awaited coroutine that completes synchronously grows the stack of its awaiter.
+    target_compile_options(${TARGET} PUBLIC -foptimize-sibling-calls)
   else()
     message(FATAL_ERROR "Compiler not supported: ${CMAKE_CXX_COMPILER_ID}")
   endif()
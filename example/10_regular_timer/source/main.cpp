@@ -12,8 +12,8 @@ int main() {
         std::cout << "timer was invoked for the " << c << "th time" << std::endl;
     });
 
-    std::cout << "timer due time (ms): " << timer.get_due_time().count() << std::endl;
-    std::cout << "timer frequency (ms): " << timer.get_frequency().count() << std::endl;
+    std::cout << "timer due time (ms): " << std::chrono::duration_cast<std::chrono::milliseconds>(timer.get_due_time()).count() << std::endl;
+    std::cout << "timer frequency (ms): " << std::chrono::duration_cast<std::chrono::milliseconds>(timer.get_frequency()).count() << std::endl;
     std::cout << "timer-associated executor : " << timer.get_executor()->name << std::endl;
 
     std::this_thread::sleep_for(20s);
@@ -11,17 +11,27 @@
 #include "concurrencpp/results/lazy_result.h"
 #include "concurrencpp/results/make_result.h"
 #include "concurrencpp/results/when_result.h"
+#include "concurrencpp/results/concurrent_algorithms.h"
 #include "concurrencpp/results/shared_result.h"
 #include "concurrencpp/results/shared_result_awaitable.h"
 #include "concurrencpp/results/promises.h"
 #include "concurrencpp/results/resume_on.h"
+#include "concurrencpp/results/with_timeout.h"
 #include "concurrencpp/results/generator.h"
+#include "concurrencpp/results/async_generator.h"
 #include "concurrencpp/executors/executor_all.h"
 #include "concurrencpp/threads/async_lock.h"
+#include "concurrencpp/threads/async_shared_mutex.h"
 #include "concurrencpp/threads/async_condition_variable.h"
+#include "concurrencpp/threads/async_semaphore.h"
+#include "concurrencpp/threads/async_latch.h"
+#include "concurrencpp/threads/async_barrier.h"
+#include "concurrencpp/threads/channel.h"
+#include "concurrencpp/threads/spin_wait.h"
 
 #include "concurrencpp/net/server.hpp"
 #include "concurrencpp/net/client.hpp"
+#include "concurrencpp/net/io_timer.hpp"
 #include "concurrencpp/net/http/http_server.hpp"
 #include "concurrencpp/net/http/http_client.hpp"
 
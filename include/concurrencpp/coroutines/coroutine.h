@@ -20,6 +20,7 @@ namespace concurrencpp::details {
     using coroutine_handle = CRCPP_COROUTINE_NAMESPACE::coroutine_handle<promise_type>;
     using suspend_never = CRCPP_COROUTINE_NAMESPACE::suspend_never;
     using suspend_always = CRCPP_COROUTINE_NAMESPACE::suspend_always;
+    using CRCPP_COROUTINE_NAMESPACE::noop_coroutine;
 }  // namespace concurrencpp::details
 
 #endif
\ No newline at end of file
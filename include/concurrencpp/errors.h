@@ -44,6 +44,10 @@ namespace concurrencpp::errors {
     struct CRCPP_API result_already_retrieved : public std::runtime_error {
         using runtime_error::runtime_error;
     };
+
+    struct CRCPP_API timeout : public std::runtime_error {
+        using runtime_error::runtime_error;
+    };
 }  // namespace concurrencpp::errors
 
 #endif  // ERRORS_H
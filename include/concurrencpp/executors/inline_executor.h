@@ -9,6 +9,7 @@ namespace concurrencpp {
 
        private:
         std::atomic_bool m_abort;
+        const bool m_trampolined;
 
         void throw_if_aborted() const {
             if (m_abort.load(std::memory_order_relaxed)) {
@@ -16,16 +17,38 @@ namespace concurrencpp {
             }
         }
 
+        static void enqueue_trampolined(concurrencpp::task& task);
+        static void enqueue_trampolined(std::span<concurrencpp::task> tasks);
+
        public:
-        inline_executor() noexcept : executor(details::consts::k_inline_executor_name), m_abort(false) {}
+        inline_executor() noexcept : inline_executor(false) {}
+
+        /*
+            A trampolined inline_executor still executes tasks on the calling thread, but a task that is enqueued
+            while another trampolined task is already running on this thread is deferred to a thread-local queue
+            which is drained by the outermost enqueue call. this bounds the stack depth of long chains of
+            inline continuations.
+        */
+        explicit inline_executor(bool trampolined) noexcept :
+            executor(details::consts::k_inline_executor_name), m_abort(false), m_trampolined(trampolined) {}
 
         void enqueue(concurrencpp::task task) override {
             throw_if_aborted();
+
+            if (m_trampolined) {
+                return enqueue_trampolined(task);
+            }
+
             task();
         }
 
         void enqueue(std::span<concurrencpp::task> tasks) override {
             throw_if_aborted();
+
+            if (m_trampolined) {
+                return enqueue_trampolined(tasks);
+            }
+
             for (auto& task : tasks) {
                 task();
             }
@@ -42,6 +65,10 @@ namespace concurrencpp {
         bool shutdown_requested() const override {
             return m_abort.load(std::memory_order_relaxed);
         }
+
+        bool trampolined() const noexcept {
+            return m_trampolined;
+        }
     };
 }  // namespace concurrencpp
 
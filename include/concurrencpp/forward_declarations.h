@@ -20,6 +20,7 @@ namespace concurrencpp {
 
     class timer_queue;
     class timer;
+    enum class timer_queue_backend;
 
     class executor;
     class inline_executor;
@@ -31,8 +32,15 @@ namespace concurrencpp {
     template<typename type>
     class generator;
 
+    template<typename type>
+    class async_generator;
+
     class async_lock;
+    class async_shared_mutex;
     class async_condition_variable;
+    class async_semaphore;
+    class async_latch;
+    class async_barrier;
 }  // namespace concurrencpp
 
 #endif  // FORWARD_DECLARATIONS_H
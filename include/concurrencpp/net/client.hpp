@@ -4,9 +4,11 @@
 #include <string>
 #include <iostream>
 #include <chrono>
+#include <memory>
 #include "concurrencpp/results/lazy_result.h"
 #include "concurrencpp/net/asio.hpp"
 #include "concurrencpp/net/asio_coro_util.hpp"
+#include "concurrencpp/net/io_timer.hpp"
 #include "concurrencpp/runtime/io_context_pool.hpp"
 
 namespace concurrencpp::net {
@@ -20,17 +22,12 @@ public:
 
     concurrencpp::lazy_result<std::string> call(std::string host, std::string port, std::string message) {
         auto& io_context = pool_->get_client_io_context();
-        tcp::socket socket(io_context);
-
-        asio::steady_timer timer(io_context);
-        constexpr auto timeout = std::chrono::seconds(10);
-        timer.expires_after(timeout);
-        timer.async_wait([&socket](const std::error_code& ec) {
-            if (!ec) {
-                std::error_code ignore_ec;
-                socket.cancel(ignore_ec);
-            }
-        });
+        // shared with the timeout timer, which might expire after this coroutine released the socket.
+        auto shared_socket = std::make_shared<tcp::socket>(io_context);
+        auto& socket = *shared_socket;
+
+        io_timer_queue timers(io_context);
+        auto timeout_timer = timers.make_socket_timeout(shared_socket, std::chrono::seconds(10));
 
         
             auto ec = co_await async_connect(io_context, socket, host, port);
@@ -80,8 +77,7 @@ public:
             }
         }
 
-        std::error_code ignore_timer_ec;
-        timer.cancel();
+        timeout_timer.cancel();
 
         std::error_code ignore_ec;
         socket.shutdown(tcp::socket::shutdown_both, ignore_ec);
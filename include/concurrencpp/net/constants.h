@@ -26,11 +26,6 @@ inline constexpr std::size_t http_max_header_bytes = 64 * 1024;      // 头部
 inline constexpr std::size_t http_max_body_bytes   = 8 * 1024 * 1024;// 正文最大字节数（8MB）
 inline constexpr std::size_t default_max_requests_per_connection = 100; // 每连接最大请求数
 
-// 读写超时（缺省值）
-inline constexpr std::chrono::milliseconds default_header_read_timeout{5000}; // 5s
-inline constexpr std::chrono::milliseconds default_body_read_timeout{20000};   // 20s
-inline constexpr std::chrono::milliseconds default_write_timeout{5000};        // 5s
-
 // Keep-Alive 参数（缺省值）
 inline constexpr std::size_t default_keep_alive_timeout_seconds = 5; // 通常 5s
 
@@ -8,6 +8,8 @@
 #include <iostream>
 #include <system_error>
 #include "concurrencpp/net/asio_coro_util.hpp"
+#include "concurrencpp/net/io_timer.hpp"
+#include "concurrencpp/net/constants.h"
 #include "concurrencpp/net/http/http_request.hpp"
 #include "concurrencpp/net/http/http_response.hpp"
 #include "concurrencpp/results/lazy_result.h"
@@ -17,16 +19,20 @@
 class connection {
 public:
     connection(asio::ip::tcp::socket socket, std::string &&doc_root)
-        : socket_(std::move(socket)), doc_root_(std::move(doc_root)) {}
+        : socket_(std::make_shared<asio::ip::tcp::socket>(std::move(socket))),
+          timers_(concurrencpp::net::io_context_of(*socket_)), doc_root_(std::move(doc_root)) {}
     ~connection() {
         std::error_code ec;
-        socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
-        socket_.close(ec);
+        socket_->shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+        socket_->close(ec);
     }
     concurrencpp::lazy_result<void> start() {
         for (;;) {
+            // timeouts expire on the io thread of the socket and abort the pending operation.
+            auto read_timeout = timers_.make_socket_timeout(socket_, concurrencpp::net::constants::default_header_read_timeout);
             auto [error, bytes_transferred] =
-                co_await concurrencpp::net::async_read_some(socket_, asio::buffer(read_buf_));
+                co_await concurrencpp::net::async_read_some(*socket_, asio::buffer(read_buf_));
+            read_timeout.cancel();
             if (error) {
                 if (error == asio::error::eof || error == asio::error::connection_reset || error == asio::error::operation_aborted) {
 
@@ -44,7 +50,9 @@ public:
                 handle_request(request_, response_);
                 bool keep_alive = is_keep_alive();
                 response_.headers.push_back({"Connection", keep_alive ? "keep-alive" : "close"});
-                auto [write_error, write_bytes] = co_await concurrencpp::net::async_write(socket_, response_.to_buffers());
+                auto write_timeout = timers_.make_socket_timeout(socket_, concurrencpp::net::constants::default_write_timeout);
+                auto [write_error, write_bytes] = co_await concurrencpp::net::async_write(*socket_, response_.to_buffers());
+                write_timeout.cancel();
                 if (write_error) {
                     if (write_error == asio::error::eof || write_error == asio::error::connection_reset || write_error == asio::error::operation_aborted) {
                         break;
@@ -62,7 +70,9 @@ public:
             } else if (result == request_parser::bad) {
                 response_ = build_response(status_type::bad_request);
                 response_.headers.push_back({"Connection", "close"});
-                auto [write_error, write_bytes] = co_await concurrencpp::net::async_write(socket_, response_.to_buffers());
+                auto write_timeout = timers_.make_socket_timeout(socket_, concurrencpp::net::constants::default_write_timeout);
+                auto [write_error, write_bytes] = co_await concurrencpp::net::async_write(*socket_, response_.to_buffers());
+                write_timeout.cancel();
                 if (write_error) {
                     if (write_error == asio::error::eof || write_error == asio::error::connection_reset || write_error == asio::error::operation_aborted) {
                         break;
@@ -161,7 +171,8 @@ private:
     }
 
 private:
-    asio::ip::tcp::socket socket_;
+    std::shared_ptr<asio::ip::tcp::socket> socket_;  // shared with the pending socket timeouts.
+    concurrencpp::net::io_timer_queue timers_;
     char read_buf_[4096];
     request_parser parser_;
     request request_;
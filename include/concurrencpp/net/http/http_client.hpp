@@ -4,6 +4,7 @@
 #include <string>
 #include <iostream>
 #include <chrono>
+#include <memory>
 #include <sstream>
 #include <system_error>
 #include <stdexcept>
@@ -11,6 +12,7 @@
 #include "concurrencpp/results/lazy_result.h"
 #include "concurrencpp/net/asio.hpp"
 #include "concurrencpp/net/asio_coro_util.hpp"
+#include "concurrencpp/net/io_timer.hpp"
 #include "concurrencpp/runtime/io_context_pool.hpp"
 #include <algorithm>
 #include <cctype>
@@ -25,18 +27,13 @@ public:
 
     concurrencpp::lazy_result<void> http_call(std::string url) {
         auto& io_context = pool_->get_client_io_context();
-        tcp::socket socket(io_context);
+        // shared with the timeout timer, which might expire after this coroutine released the socket.
+        auto shared_socket = std::make_shared<tcp::socket>(io_context);
+        auto& socket = *shared_socket;
 
         // 简单 10 秒超时
-        asio::steady_timer timer(io_context);
-        constexpr auto timeout = std::chrono::seconds(10);
-        timer.expires_after(timeout);
-        timer.async_wait([&socket](const std::error_code& ec) {
-            if (!ec) {
-                std::error_code ignore_ec;
-                socket.cancel(ignore_ec);
-            }
-        });
+        io_timer_queue timers(io_context);
+        auto timeout_timer = timers.make_socket_timeout(shared_socket, std::chrono::seconds(10));
 
         auto u = parse_url(url);
         if (u.scheme != "http") {
@@ -129,8 +126,7 @@ public:
         }
 
         // 清理资源
-        std::error_code ignore_timer_ec;
-        timer.cancel();
+        timeout_timer.cancel();
         std::error_code ignore_ec;
         socket.shutdown(tcp::socket::shutdown_both, ignore_ec);
         socket.close(ignore_ec);
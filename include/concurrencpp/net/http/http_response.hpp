@@ -53,7 +53,7 @@ constexpr std::string_view status_line_bad_gateway =
 constexpr std::string_view status_line_service_unavailable =
     "HTTP/1.1 503 Service Unavailable\r\n";
 
-asio::const_buffer status_to_buffer(status_type status) {
+inline asio::const_buffer status_to_buffer(status_type status) {
     switch (status) {
         case status_type::ok:
             return asio::buffer(status_line_ok);
@@ -102,7 +102,7 @@ const std::unordered_map<std::string_view, std::string_view> mime_map = {
     {"jpg", "image/jpeg"},
     {"png", "image/png"}};
 
-std::string_view extension_to_type(std::string_view extension) {
+inline std::string_view extension_to_type(std::string_view extension) {
     if (auto it = mime_map.find(extension); it != mime_map.end()) {
         return it->second;
     }
@@ -222,7 +222,7 @@ constexpr std::string_view response_service_unavailable =
     "<body><h1>503 Service Unavailable</h1></body>"
     "</html>";
 
-std::string_view to_string(status_type status) {
+inline std::string_view to_string(status_type status) {
     switch (status) {
         case status_type::ok:
             return response_ok;
@@ -262,7 +262,7 @@ std::string_view to_string(status_type status) {
 }
 }
 
-response build_response(status_type status) {
+inline response build_response(status_type status) {
     response rep;
     rep.status = status;
     rep.content = response_content::to_string(status);
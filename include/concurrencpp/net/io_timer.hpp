@@ -0,0 +1,217 @@
+#ifndef CONCURRENCPP_NET_IO_TIMER_HPP
+#define CONCURRENCPP_NET_IO_TIMER_HPP
+
+#include <chrono>
+#include <memory>
+#include <coroutine>
+#include <system_error>
+
+#include "concurrencpp/utils/bind.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/net/asio.hpp"
+#include "concurrencpp/net/asio_coro_util.hpp"
+
+namespace concurrencpp::net {
+
+namespace details {
+
+// owns the asio timer of an io_timer. touched only by the thread that runs the io_context, except for the first arming.
+class io_timer_state_base {
+public:
+    explicit io_timer_state_base(asio::io_context& io_context) : io_context_(io_context), timer_(io_context) {}
+    virtual ~io_timer_state_base() = default;
+
+    void cancel() {
+        if (io_context_.get_executor().running_in_this_thread()) {
+            cancel_here();
+            return;
+        }
+
+        asio::post(io_context_, [self = shared_from_base()] {
+            self->cancel_here();
+        });
+    }
+
+protected:
+    asio::io_context& io_context_;
+    asio::steady_timer timer_;
+    bool cancelled_ = false;
+
+    virtual std::shared_ptr<io_timer_state_base> shared_from_base() = 0;
+
+private:
+    void cancel_here() {
+        cancelled_ = true;
+        timer_.cancel();
+    }
+};
+
+template <typename callable_type>
+class io_timer_state final : public io_timer_state_base,
+                             public std::enable_shared_from_this<io_timer_state<callable_type>> {
+public:
+    template <typename given_callable_type>
+    io_timer_state(asio::io_context& io_context, std::chrono::steady_clock::duration frequency, bool is_oneshot,
+                   given_callable_type&& callable)
+        : io_timer_state_base(io_context), frequency_(frequency), is_oneshot_(is_oneshot),
+          callable_(std::forward<given_callable_type>(callable)) {}
+
+    void start(std::chrono::steady_clock::duration due_time) {
+        timer_.expires_after(due_time);
+        arm();
+    }
+
+private:
+    const std::chrono::steady_clock::duration frequency_;
+    const bool is_oneshot_;
+    callable_type callable_;
+
+    std::shared_ptr<io_timer_state_base> shared_from_base() override {
+        return this->shared_from_this();
+    }
+
+    void arm() {
+        // the pending handler keeps the state alive, a cancelled wait releases it.
+        timer_.async_wait([self = this->shared_from_this()](const std::error_code& ec) {
+            if (ec || self->cancelled_) {
+                return;
+            }
+
+            self->callable_();
+
+            if (self->is_oneshot_ || self->cancelled_) {
+                return;
+            }
+
+            self->timer_.expires_at(self->timer_.expiry() + self->frequency_);
+            self->arm();
+        });
+    }
+};
+
+}  // namespace details
+
+// A timer that expires on the thread that runs its io_context. Destroying or cancelling it cancels the timer.
+// Cancelling on the io_context thread is immediate, cancelling on any other thread is posted to the io_context, so the
+// callable might still run once after cancel returns.
+class io_timer {
+public:
+    io_timer() noexcept = default;
+    explicit io_timer(std::shared_ptr<details::io_timer_state_base> state) noexcept : state_(std::move(state)) {}
+
+    io_timer(io_timer&& rhs) noexcept = default;
+    io_timer& operator=(io_timer&& rhs) {
+        if (this == &rhs) {
+            return *this;
+        }
+
+        cancel();
+        state_ = std::move(rhs.state_);
+        return *this;
+    }
+
+    io_timer(const io_timer&) = delete;
+    io_timer& operator=(const io_timer&) = delete;
+
+    ~io_timer() {
+        cancel();
+    }
+
+    void cancel() {
+        if (!state_) {
+            return;
+        }
+
+        auto state = std::move(state_);
+        state->cancel();
+    }
+
+    explicit operator bool() const noexcept {
+        return static_cast<bool>(state_);
+    }
+
+private:
+    std::shared_ptr<details::io_timer_state_base> state_;
+};
+
+/*
+    Timers, delay objects and socket timeouts that are driven by an io_context instead of a timer_queue thread.
+    Callables run and coroutines resume on the thread that runs the io_context, which is the thread that owns the
+    sockets of that io_context, so a network timeout doesn't need an extra thread or a hop between threads.
+    The io_context is expected to be run by a single thread, like the io_contexts of io_context_pool.
+*/
+class io_timer_queue {
+public:
+    using clock_type = std::chrono::steady_clock;
+    using duration = clock_type::duration;
+
+    explicit io_timer_queue(asio::io_context& io_context) noexcept : io_context_(&io_context) {}
+
+    template <typename callable_type, typename... argument_types>
+    io_timer make_timer(duration due_time, duration frequency, callable_type&& callable, argument_types&&... arguments) {
+        return make_timer_impl(due_time, frequency, false,
+                               concurrencpp::details::bind(std::forward<callable_type>(callable),
+                                                           std::forward<argument_types>(arguments)...));
+    }
+
+    template <typename callable_type, typename... argument_types>
+    io_timer make_one_shot_timer(duration due_time, callable_type&& callable, argument_types&&... arguments) {
+        return make_timer_impl(due_time, duration::zero(), true,
+                               concurrencpp::details::bind(std::forward<callable_type>(callable),
+                                                           std::forward<argument_types>(arguments)...));
+    }
+
+    // cancels the pending operations of socket when timeout expires. they complete with asio::error::operation_aborted.
+    // the timer shares the ownership of the socket: a cancel from another thread is only posted to the io_context, so
+    // the timer might still expire after the caller released the socket.
+    template <typename socket_type>
+    io_timer make_socket_timeout(std::shared_ptr<socket_type> socket, duration timeout) {
+        return make_one_shot_timer(timeout, [socket = std::move(socket)] {
+            std::error_code ignore_ec;
+            socket->cancel(ignore_ec);
+        });
+    }
+
+    concurrencpp::lazy_result<void> make_delay_object(duration due_time) {
+        asio::steady_timer timer(*io_context_, due_time);
+
+        const auto error = co_await CallbackAwaiterWithResult<std::error_code>(
+            [&timer](std::coroutine_handle<> handle, auto set_resume_value) {
+                timer.async_wait([handle, set_resume_value = std::move(set_resume_value)](const std::error_code& ec) {
+                    set_resume_value(ec);
+                    handle.resume();
+                });
+            });
+
+        if (error) {
+            throw asio::system_error(error);
+        }
+    }
+
+    asio::io_context& get_io_context() const noexcept {
+        return *io_context_;
+    }
+
+private:
+    asio::io_context* io_context_;
+
+    template <typename callable_type>
+    io_timer make_timer_impl(duration due_time, duration frequency, bool is_oneshot, callable_type&& callable) {
+        using decayed_type = std::decay_t<callable_type>;
+
+        auto state = std::make_shared<details::io_timer_state<decayed_type>>(*io_context_, frequency, is_oneshot,
+                                                                             std::forward<callable_type>(callable));
+        state->start(due_time);
+        return io_timer(std::move(state));
+    }
+};
+
+// the io_context a socket was created with.
+template <typename socket_type>
+asio::io_context& io_context_of(socket_type& socket) {
+    return static_cast<asio::io_context&>(asio::query(socket.get_executor(), asio::execution::context));
+}
+
+}  // namespace concurrencpp::net
+
+#endif
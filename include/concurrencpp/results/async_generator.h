@@ -0,0 +1,72 @@
+#ifndef CONCURRENCPP_ASYNC_GENERATOR_H
+#define CONCURRENCPP_ASYNC_GENERATOR_H
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/results/impl/async_generator_state.h"
+
+namespace concurrencpp {
+    /*
+        A lazy generator that may co_await inside its body. The producer only runs while the consumer awaits
+        the next value, and the two transfer the execution to each other directly. Values are yielded by reference, so
+        besides the coroutine frame nothing is allocated. If the producer co_awaits something that resumes it in another
+        thread of execution, the consumer continues in that thread once the next value is yielded.
+    */
+    template<typename type>
+    class async_generator {
+
+       public:
+        using promise_type = details::async_generator_state<type>;
+        using iterator = details::async_generator_iterator<type>;
+
+        static_assert(!std::is_same_v<type, void>, "concurrencpp::async_generator<type> - <<type>> can not be void.");
+
+       private:
+        details::coroutine_handle<promise_type> m_coro_handle;
+
+       public:
+        async_generator(details::coroutine_handle<promise_type> handle) noexcept : m_coro_handle(handle) {}
+
+        async_generator(async_generator&& rhs) noexcept : m_coro_handle(std::exchange(rhs.m_coro_handle, {})) {}
+
+        ~async_generator() noexcept {
+            if (static_cast<bool>(m_coro_handle)) {
+                m_coro_handle.destroy();
+            }
+        }
+
+        async_generator(const async_generator& rhs) = delete;
+
+        async_generator& operator=(async_generator&& rhs) = delete;
+        async_generator& operator=(const async_generator& rhs) = delete;
+
+        explicit operator bool() const noexcept {
+            return static_cast<bool>(m_coro_handle);
+        }
+
+        // must be co_awaited, returns a pointer to the next value or nullptr once the generator has finished.
+        details::async_generator_next_awaitable<type> next() {
+            if (!static_cast<bool>(m_coro_handle)) {
+                throw errors::empty_generator(details::consts::k_empty_async_generator_next_err_msg);
+            }
+
+            return {m_coro_handle};
+        }
+
+        // must be co_awaited, starts running the generator and returns an iterator.
+        details::async_generator_begin_awaitable<type> begin() {
+            if (!static_cast<bool>(m_coro_handle)) {
+                throw errors::empty_generator(details::consts::k_empty_async_generator_begin_err_msg);
+            }
+
+            assert(!m_coro_handle.done());
+            return {m_coro_handle};
+        }
+
+        static details::async_generator_end_iterator end() noexcept {
+            return {};
+        }
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,527 @@
+#ifndef CONCURRENCPP_CONCURRENT_ALGORITHMS_H
+#define CONCURRENCPP_CONCURRENT_ALGORITHMS_H
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/task.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/results/resume_on.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+
+#include <mutex>
+#include <span>
+#include <vector>
+#include <iterator>
+#include <optional>
+#include <functional>
+#include <type_traits>
+
+namespace concurrencpp {
+    enum class transform_order { completion, input };
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    template<class type>
+    struct awaited_result {
+        using value_type = type;
+        static constexpr bool is_async = false;
+    };
+
+    template<class type>
+    struct awaited_result<result<type>> {
+        using value_type = type;
+        static constexpr bool is_async = true;
+    };
+
+    template<class type>
+    struct awaited_result<lazy_result<type>> {
+        using value_type = type;
+        static constexpr bool is_async = true;
+    };
+
+    /*
+        Hands out the elements of [begin, end) one by one. forward iterators are handed out as is so elements are not
+        copied, single pass iterators are dereferenced and their element is copied before the iterator is advanced.
+    */
+    template<class iterator_type>
+    class concurrent_item_source {
+
+       public:
+        static constexpr bool k_multi_pass = std::forward_iterator<iterator_type>;
+
+        using item_type = std::conditional_t<k_multi_pass, iterator_type, typename std::iterator_traits<iterator_type>::value_type>;
+
+       private:
+        iterator_type m_cursor;
+        const iterator_type m_end;
+        size_t m_next_index = 0;
+
+       public:
+        concurrent_item_source(iterator_type begin, iterator_type end) : m_cursor(std::move(begin)), m_end(std::move(end)) {}
+
+        bool exhausted() const {
+            return m_cursor == m_end;
+        }
+
+        size_t next_index() const noexcept {
+            return m_next_index;
+        }
+
+        item_type take() {
+            assert(!exhausted());
+            ++m_next_index;
+
+            if constexpr (k_multi_pass) {
+                return m_cursor++;
+            } else {
+                item_type item = *m_cursor;
+                ++m_cursor;
+                return item;
+            }
+        }
+
+        static decltype(auto) get(item_type& item) {
+            if constexpr (k_multi_pass) {
+                return *item;
+            } else {
+                return (item);
+            }
+        }
+    };
+
+    enum class concurrent_take_status { taken, exhausted, retry };
+
+    template<class item_type>
+    struct concurrent_take_result {
+        concurrent_take_status status = concurrent_take_status::retry;
+        size_t index = 0;
+        std::optional<item_type> item;
+    };
+
+    template<class iterator_type, class callable_type>
+    class concurrent_for_each_state {
+
+       public:
+        using source_type = concurrent_item_source<iterator_type>;
+        using item_type = typename source_type::item_type;
+        using invoke_result_type = std::invoke_result_t<callable_type&, decltype(source_type::get(std::declval<item_type&>()))>;
+
+       private:
+        std::mutex m_lock;
+        source_type m_source;
+        callable_type m_callable;
+        std::exception_ptr m_error;
+
+       public:
+        concurrent_for_each_state(iterator_type begin, iterator_type end, callable_type callable) :
+            m_source(std::move(begin), std::move(end)), m_callable(std::move(callable)) {}
+
+        std::optional<item_type> take() {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (static_cast<bool>(m_error) || m_source.exhausted()) {
+                return {};
+            }
+
+            return m_source.take();
+        }
+
+        invoke_result_type invoke(item_type& item) {
+            return std::invoke(m_callable, source_type::get(item));
+        }
+
+        void set_exception(std::exception_ptr error) noexcept {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (!static_cast<bool>(m_error)) {
+                m_error = std::move(error);
+            }
+        }
+
+        void rethrow_if_failed() {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (static_cast<bool>(m_error)) {
+                std::rethrow_exception(m_error);
+            }
+        }
+    };
+
+    template<class iterator_type, class callable_type, class output_iterator_type>
+    class concurrent_transform_state {
+
+       public:
+        using source_type = concurrent_item_source<iterator_type>;
+        using item_type = typename source_type::item_type;
+        using invoke_result_type = std::invoke_result_t<callable_type&, decltype(source_type::get(std::declval<item_type&>()))>;
+        using output_type = std::decay_t<typename awaited_result<invoke_result_type>::value_type>;
+        using take_result = concurrent_take_result<item_type>;
+
+        class take_awaitable;
+
+       private:
+        std::mutex m_lock;
+        source_type m_source;
+        callable_type m_callable;
+        output_iterator_type m_output;
+        const transform_order m_order;
+        const size_t m_window;
+        size_t m_next_emit = 0;
+        std::vector<std::optional<output_type>> m_reorder_buffer;
+        take_awaitable* m_parked_workers = nullptr;
+        std::exception_ptr m_error;
+
+        // in input order, an element may only be taken if its output fits in the reorder buffer.
+        bool window_full() const noexcept {
+            return (m_order == transform_order::input) && (m_source.next_index() >= m_next_emit + m_window);
+        }
+
+        bool try_take(take_result& result) {
+            if (static_cast<bool>(m_error) || m_source.exhausted()) {
+                result.status = concurrent_take_status::exhausted;
+                return true;
+            }
+
+            if (window_full()) {
+                return false;
+            }
+
+            result.status = concurrent_take_status::taken;
+            result.index = m_source.next_index();
+            result.item.emplace(m_source.take());
+            return true;
+        }
+
+        take_awaitable* unpark_workers() noexcept {
+            return std::exchange(m_parked_workers, nullptr);
+        }
+
+        static void resume_inline(take_awaitable* parked_workers) noexcept {
+            while (parked_workers != nullptr) {
+                const auto next = parked_workers->m_next_parked;
+                parked_workers->m_coro_handle();
+                parked_workers = next;
+            }
+        }
+
+        static void resume_parked(executor& executor, take_awaitable* parked_workers) noexcept {
+            if (parked_workers == nullptr) {
+                return;
+            }
+
+            std::vector<task> tasks;
+
+            try {
+                for (auto parked_worker = parked_workers; parked_worker != nullptr; parked_worker = parked_worker->m_next_parked) {
+                    tasks.emplace_back();
+                }
+            } catch (...) {
+                return resume_inline(parked_workers);
+            }
+
+            // the awaiter might be destroyed once its coroutine is resumed, so the list is walked before scheduling.
+            auto task_it = tasks.begin();
+            while (parked_workers != nullptr) {
+                const auto next = parked_workers->m_next_parked;
+                *task_it = await_via_functor {parked_workers->m_coro_handle, &parked_workers->m_interrupted};
+                ++task_it;
+                parked_workers = next;
+            }
+
+            try {
+                executor.enqueue(std::span<task> {tasks});
+            } catch (...) {
+                // workers that could not be scheduled are resumed inline as interrupted by ~await_via_functor.
+            }
+        }
+
+       public:
+        class take_awaitable {
+
+            friend class concurrent_transform_state;
+
+           private:
+            concurrent_transform_state& m_state;
+            take_result m_result;
+            coroutine_handle<void> m_coro_handle;
+            take_awaitable* m_next_parked = nullptr;
+            bool m_interrupted = false;
+
+           public:
+            take_awaitable(concurrent_transform_state& state) noexcept : m_state(state) {}
+
+            bool await_ready() {
+                std::unique_lock<std::mutex> lock(m_state.m_lock);
+                return m_state.try_take(m_result);
+            }
+
+            bool await_suspend(coroutine_handle<void> coro_handle) {
+                std::unique_lock<std::mutex> lock(m_state.m_lock);
+                if (m_state.try_take(m_result)) {
+                    return false;
+                }
+
+                m_coro_handle = coro_handle;
+                m_next_parked = std::exchange(m_state.m_parked_workers, this);
+                return true;
+            }
+
+            // a worker that was parked and then resumed gets concurrent_take_status::retry.
+            take_result await_resume() {
+                if (m_interrupted) {
+                    m_state.set_exception(std::make_exception_ptr(errors::broken_task(consts::k_broken_task_exception_error_msg)));
+                    m_result.status = concurrent_take_status::exhausted;
+                }
+
+                return std::move(m_result);
+            }
+        };
+
+        concurrent_transform_state(iterator_type begin,
+                                   iterator_type end,
+                                   callable_type callable,
+                                   output_iterator_type output,
+                                   transform_order order,
+                                   size_t window) :
+            m_source(std::move(begin), std::move(end)),
+            m_callable(std::move(callable)), m_output(std::move(output)), m_order(order), m_window(window) {
+            if (order == transform_order::input) {
+                m_reorder_buffer.resize(window);
+            }
+        }
+
+        take_awaitable take() noexcept {
+            return {*this};
+        }
+
+        invoke_result_type invoke(item_type& item) {
+            return std::invoke(m_callable, source_type::get(item));
+        }
+
+        void publish(executor& executor, size_t index, output_type value) {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (static_cast<bool>(m_error)) {
+                return;
+            }
+
+            if (m_order == transform_order::completion) {
+                *m_output = std::move(value);
+                ++m_output;
+                return;
+            }
+
+            assert(index >= m_next_emit);
+            assert(index < m_next_emit + m_window);
+            m_reorder_buffer[index % m_window].emplace(std::move(value));
+
+            const auto next_emit_0 = m_next_emit;
+            while (true) {
+                auto& head = m_reorder_buffer[m_next_emit % m_window];
+                if (!head.has_value()) {
+                    break;
+                }
+
+                *m_output = std::move(*head);
+                ++m_output;
+                head.reset();
+                ++m_next_emit;
+            }
+
+            if (m_next_emit == next_emit_0) {
+                return;
+            }
+
+            const auto parked_workers = unpark_workers();
+            lock.unlock();
+            resume_parked(executor, parked_workers);
+        }
+
+        void set_exception(executor* executor, std::exception_ptr error) noexcept {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (!static_cast<bool>(m_error)) {
+                m_error = std::move(error);
+            }
+
+            const auto parked_workers = unpark_workers();
+            lock.unlock();
+
+            // parked workers have to observe the error and quit.
+            if (executor != nullptr) {
+                return resume_parked(*executor, parked_workers);
+            }
+
+            resume_inline(parked_workers);
+        }
+
+        void set_exception(std::exception_ptr error) noexcept {
+            set_exception(nullptr, std::move(error));
+        }
+
+        output_iterator_type rethrow_if_failed() {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (static_cast<bool>(m_error)) {
+                std::rethrow_exception(m_error);
+            }
+
+            assert(m_parked_workers == nullptr);
+            return std::move(m_output);
+        }
+    };
+
+    template<class executor_type, class state_type>
+    result<void> concurrent_for_each_worker(executor_tag, std::shared_ptr<executor_type> executor, state_type& state) {
+        while (true) {
+            auto item = state.take();
+            if (!item.has_value()) {
+                co_return;
+            }
+
+            try {
+                if constexpr (awaited_result<typename state_type::invoke_result_type>::is_async) {
+                    co_await state.invoke(*item);
+
+                    // the worker is resumed by whatever completed the result, the next element is invoked inside executor.
+                    co_await resume_on(*executor);
+                } else {
+                    state.invoke(*item);
+                }
+            } catch (...) {
+                state.set_exception(std::current_exception());
+                co_return;
+            }
+        }
+    }
+
+    template<class executor_type, class state_type>
+    result<void> concurrent_transform_worker(executor_tag, std::shared_ptr<executor_type> executor, state_type& state) {
+        while (true) {
+            auto taken = co_await state.take();
+            if (taken.status == concurrent_take_status::exhausted) {
+                co_return;
+            }
+
+            if (taken.status == concurrent_take_status::retry) {
+                continue;
+            }
+
+            try {
+                if constexpr (awaited_result<typename state_type::invoke_result_type>::is_async) {
+                    typename state_type::output_type value = co_await state.invoke(*taken.item);
+                    co_await resume_on(*executor);
+                    state.publish(*executor, taken.index, std::move(value));
+                } else {
+                    state.publish(*executor, taken.index, state.invoke(*taken.item));
+                }
+            } catch (...) {
+                state.set_exception(executor.get(), std::current_exception());
+                co_return;
+            }
+        }
+    }
+
+    template<class executor_type, class state_type, class worker_type>
+    lazy_result<void> run_concurrent_workers(std::shared_ptr<executor_type> executor,
+                                             state_type& state,
+                                             size_t max_concurrency,
+                                             worker_type worker) {
+        std::vector<result<void>> workers;
+        workers.reserve(max_concurrency);
+
+        try {
+            for (size_t i = 0; i < max_concurrency; i++) {
+                workers.emplace_back(worker(executor_tag {}, executor, state));
+            }
+        } catch (...) {
+            state.set_exception(std::current_exception());
+        }
+
+        for (auto& worker_result : workers) {
+            try {
+                co_await worker_result;
+            } catch (...) {
+                state.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    template<class executor_type, class iterator_type, class callable_type>
+    lazy_result<void> concurrent_for_each_impl(std::shared_ptr<executor_type> executor,
+                                               iterator_type begin,
+                                               iterator_type end,
+                                               size_t max_concurrency,
+                                               callable_type callable) {
+        using state_type = concurrent_for_each_state<iterator_type, callable_type>;
+
+        state_type state(std::move(begin), std::move(end), std::move(callable));
+        co_await run_concurrent_workers(executor, state, max_concurrency, concurrent_for_each_worker<executor_type, state_type>);
+        state.rethrow_if_failed();
+    }
+
+    template<class executor_type, class iterator_type, class callable_type, class output_iterator_type>
+    lazy_result<output_iterator_type> concurrent_transform_impl(std::shared_ptr<executor_type> executor,
+                                                                iterator_type begin,
+                                                                iterator_type end,
+                                                                output_iterator_type output,
+                                                                size_t max_concurrency,
+                                                                callable_type callable,
+                                                                transform_order order) {
+        using state_type = concurrent_transform_state<iterator_type, callable_type, output_iterator_type>;
+
+        state_type state(std::move(begin), std::move(end), std::move(callable), std::move(output), order, max_concurrency);
+        co_await run_concurrent_workers(executor, state, max_concurrency, concurrent_transform_worker<executor_type, state_type>);
+        co_return state.rethrow_if_failed();
+    }
+
+    inline void throw_if_invalid_concurrent_arguments(const void* executor, size_t max_concurrency) {
+        if (executor == nullptr) {
+            throw std::invalid_argument(consts::k_concurrent_algorithm_null_executor_error_msg);
+        }
+
+        if (max_concurrency == 0) {
+            throw std::invalid_argument(consts::k_concurrent_algorithm_zero_concurrency_error_msg);
+        }
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Invokes callable on every element of [begin, end) inside executor, with at most max_concurrency invocations
+        in flight. callable may return a result or a lazy_result, in which case it is awaited before the worker moves
+        on to the next element. callable is shared by all workers and must be thread safe.
+        If callable throws, no new elements are processed and the first exception is rethrown once all workers are done.
+    */
+    template<class executor_type, class iterator_type, class callable_type>
+    lazy_result<void> concurrent_for_each(std::shared_ptr<executor_type> executor,
+                                          iterator_type begin,
+                                          iterator_type end,
+                                          size_t max_concurrency,
+                                          callable_type callable) {
+        details::throw_if_invalid_concurrent_arguments(executor.get(), max_concurrency);
+        return details::concurrent_for_each_impl(std::move(executor), std::move(begin), std::move(end), max_concurrency, std::move(callable));
+    }
+
+    /*
+        Like concurrent_for_each, but writes the (awaited) return value of callable to output.
+        with transform_order::completion, values are written as soon as they are produced. with transform_order::input,
+        values are written in the order of their elements, and no more than max_concurrency elements are processed
+        ahead of the first element whose value wasn't written yet.
+        Returns the output iterator past the last written value.
+    */
+    template<class executor_type, class iterator_type, class output_iterator_type, class callable_type>
+    lazy_result<output_iterator_type> concurrent_transform(std::shared_ptr<executor_type> executor,
+                                                           iterator_type begin,
+                                                           iterator_type end,
+                                                           output_iterator_type output,
+                                                           size_t max_concurrency,
+                                                           callable_type callable,
+                                                           transform_order order = transform_order::completion) {
+        details::throw_if_invalid_concurrent_arguments(executor.get(), max_concurrency);
+        return details::concurrent_transform_impl(std::move(executor),
+                                                  std::move(begin),
+                                                  std::move(end),
+                                                  std::move(output),
+                                                  max_concurrency,
+                                                  std::move(callable),
+                                                  order);
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -59,6 +59,35 @@ namespace concurrencpp::details::consts {
 
     inline const char* k_when_any_null_resume_executor_error_msg = "concurrencpp::when_any() - given resume_executor is null.";
 
+    inline const char* k_when_n_empty_result_error_msg = "concurrencpp::when_n() - one of the result objects is empty.";
+
+    inline const char* k_when_n_count_out_of_range_error_msg = "concurrencpp::when_n() - count is larger than the size of the given range.";
+
+    inline const char* k_when_n_null_resume_executor_error_msg = "concurrencpp::when_n() - given resume_executor is null.";
+
+    /*
+     * with_timeout, with_deadline
+     */
+
+    inline const char* k_with_timeout_empty_result_error_msg = "concurrencpp::with_timeout/with_deadline() - given result is empty.";
+
+    inline const char* k_with_timeout_null_timer_queue_error_msg = "concurrencpp::with_timeout/with_deadline() - given timer_queue is null.";
+
+    inline const char* k_with_timeout_null_executor_error_msg = "concurrencpp::with_timeout/with_deadline() - given executor is null.";
+
+    inline const char* k_timeout_result_get_timed_out_error_msg =
+        "concurrencpp::timeout_result::get() - the timeout expired before the result completed.";
+
+    /*
+     * concurrent_for_each, concurrent_transform
+     */
+
+    inline const char* k_concurrent_algorithm_null_executor_error_msg =
+        "concurrencpp::concurrent_for_each/concurrent_transform() - given executor is null.";
+
+    inline const char* k_concurrent_algorithm_zero_concurrency_error_msg =
+        "concurrencpp::concurrent_for_each/concurrent_transform() - max_concurrency must be greater than zero.";
+
     /*
      * shared_result
      */
@@ -77,6 +106,9 @@ namespace concurrencpp::details::consts {
 
     inline const char* k_shared_result_resolve_error_msg = "concurrencpp::shared_result::resolve() - result is empty.";
 
+    inline const char* k_shared_result_null_resume_executor_error_msg =
+        "concurrencpp::shared_result::shared_result() - given resume_executor is null.";
+
     /*
      * lazy_result
      */
@@ -100,6 +132,13 @@ namespace concurrencpp::details::consts {
      */
     inline const char* k_empty_generator_begin_err_msg = "concurrencpp::generator::begin - generator is empty.";
 
+    /*
+     * async_generator
+     */
+    inline const char* k_empty_async_generator_next_err_msg = "concurrencpp::async_generator::next - generator is empty.";
+
+    inline const char* k_empty_async_generator_begin_err_msg = "concurrencpp::async_generator::begin - generator is empty.";
+
     /*
      * parallel-coroutine
      */
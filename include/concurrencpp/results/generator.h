@@ -30,7 +30,20 @@ namespace concurrencpp {
 
         generator(const generator& rhs) = delete;
 
-        generator& operator=(generator&& rhs) = delete;
+        // makes generator movable, so an rvalue generator can be piped to std::views
+        generator& operator=(generator&& rhs) noexcept {
+            if (this == &rhs) {
+                return *this;
+            }
+
+            if (static_cast<bool>(m_coro_handle)) {
+                m_coro_handle.destroy();
+            }
+
+            m_coro_handle = std::exchange(rhs.m_coro_handle, {});
+            return *this;
+        }
+
         generator& operator=(const generator& rhs) = delete;
 
         explicit operator bool() const noexcept {
@@ -0,0 +1,215 @@
+#ifndef CONCURRENCPP_ASYNC_GENERATOR_STATE_H
+#define CONCURRENCPP_ASYNC_GENERATOR_STATE_H
+
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/coroutines/coroutine.h"
+
+#include <exception>
+
+namespace concurrencpp::details {
+    template<typename type>
+    class async_generator_state {
+
+       public:
+        using value_type = std::remove_reference_t<type>;
+
+       private:
+        value_type* m_value = nullptr;
+        std::exception_ptr m_exception;
+        coroutine_handle<void> m_consumer;
+
+        // suspends the producer and transfers the execution back to the consumer that asked for the next value
+        struct yield_awaitable {
+            constexpr bool await_ready() const noexcept {
+                return false;
+            }
+
+            coroutine_handle<void> await_suspend(coroutine_handle<async_generator_state<type>> handle) const noexcept {
+                return handle.promise().m_consumer;
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+       public:
+        async_generator<type> get_return_object() noexcept {
+            return async_generator<type> {coroutine_handle<async_generator_state<type>>::from_promise(*this)};
+        }
+
+        suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        yield_awaitable final_suspend() const noexcept {
+            return {};
+        }
+
+        yield_awaitable yield_value(value_type& ref) noexcept {
+            m_value = std::addressof(ref);
+            return {};
+        }
+
+        yield_awaitable yield_value(value_type&& ref) noexcept {
+            m_value = std::addressof(ref);
+            return {};
+        }
+
+        void unhandled_exception() noexcept {
+            m_exception = std::current_exception();
+        }
+
+        void return_void() const noexcept {}
+
+        void set_consumer(coroutine_handle<void> consumer) noexcept {
+            m_consumer = consumer;
+        }
+
+        value_type& value() const noexcept {
+            assert(m_value != nullptr);
+            assert(reinterpret_cast<std::intptr_t>(m_value) % alignof(value_type) == 0);
+            return *m_value;
+        }
+
+        // an exception is re-thrown once, further calls see a finished generator.
+        void throw_if_exception() {
+            if (static_cast<bool>(m_exception)) {
+                std::rethrow_exception(std::exchange(m_exception, {}));
+            }
+        }
+    };
+
+    /*
+        resumes the producer until it yields the next value or finishes. the consumer is suspended meanwhile, and producer
+        and consumer transfer the execution to each other directly, without growing the stack.
+    */
+    template<typename type>
+    class async_generator_advance_awaitable {
+
+       protected:
+        coroutine_handle<async_generator_state<type>> m_coro_handle;
+
+       public:
+        async_generator_advance_awaitable(coroutine_handle<async_generator_state<type>> handle) noexcept : m_coro_handle(handle) {
+            assert(static_cast<bool>(m_coro_handle));
+        }
+
+        bool await_ready() const noexcept {
+            return m_coro_handle.done();
+        }
+
+        coroutine_handle<void> await_suspend(coroutine_handle<void> consumer) noexcept {
+            m_coro_handle.promise().set_consumer(consumer);
+            return m_coro_handle;
+        }
+    };
+
+    template<typename type>
+    class async_generator_next_awaitable : public async_generator_advance_awaitable<type> {
+
+       public:
+        using async_generator_advance_awaitable<type>::async_generator_advance_awaitable;
+
+        std::remove_reference_t<type>* await_resume() {
+            auto& promise = this->m_coro_handle.promise();
+            if (this->m_coro_handle.done()) {
+                promise.throw_if_exception();
+                return nullptr;
+            }
+
+            return std::addressof(promise.value());
+        }
+    };
+
+    struct async_generator_end_iterator {};
+
+    template<typename type>
+    class async_generator_iterator {
+
+       private:
+        coroutine_handle<async_generator_state<type>> m_coro_handle;
+
+        class increment_awaitable : public async_generator_advance_awaitable<type> {
+
+           private:
+            async_generator_iterator& m_iterator;
+
+           public:
+            increment_awaitable(async_generator_iterator& iterator) noexcept :
+                async_generator_advance_awaitable<type>(iterator.m_coro_handle), m_iterator(iterator) {}
+
+            async_generator_iterator& await_resume() {
+                if (this->m_coro_handle.done()) {
+                    this->m_coro_handle.promise().throw_if_exception();
+                }
+
+                return m_iterator;
+            }
+        };
+
+       public:
+        using value_type = std::remove_reference_t<type>;
+        using reference = value_type&;
+        using pointer = value_type*;
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+
+       public:
+        async_generator_iterator(coroutine_handle<async_generator_state<type>> handle) noexcept : m_coro_handle(handle) {
+            assert(static_cast<bool>(m_coro_handle));
+        }
+
+        // must be co_awaited, resumes the generator until it yields the next value or finishes.
+        increment_awaitable operator++() noexcept {
+            assert(static_cast<bool>(m_coro_handle));
+            assert(!m_coro_handle.done());
+            return {*this};
+        }
+
+        reference operator*() const noexcept {
+            assert(static_cast<bool>(m_coro_handle));
+            return m_coro_handle.promise().value();
+        }
+
+        pointer operator->() const noexcept {
+            assert(static_cast<bool>(m_coro_handle));
+            return std::addressof(operator*());
+        }
+
+        friend bool operator==(const async_generator_iterator& it0, const async_generator_iterator& it1) noexcept {
+            return it0.m_coro_handle == it1.m_coro_handle;
+        }
+
+        friend bool operator==(const async_generator_iterator& it, async_generator_end_iterator) noexcept {
+            return it.m_coro_handle.done();
+        }
+
+        friend bool operator==(async_generator_end_iterator end_it, const async_generator_iterator& it) noexcept {
+            return (it == end_it);
+        }
+
+        friend bool operator!=(const async_generator_iterator& it, async_generator_end_iterator end_it) noexcept {
+            return !(it == end_it);
+        }
+
+        friend bool operator!=(async_generator_end_iterator end_it, const async_generator_iterator& it) noexcept {
+            return it != end_it;
+        }
+    };
+
+    template<typename type>
+    class async_generator_begin_awaitable : public async_generator_advance_awaitable<type> {
+
+       public:
+        using async_generator_advance_awaitable<type>::async_generator_advance_awaitable;
+
+        async_generator_iterator<type> await_resume() {
+            if (this->m_coro_handle.done()) {
+                this->m_coro_handle.promise().throw_if_exception();
+            }
+
+            return {this->m_coro_handle};
+        }
+    };
+}  // namespace concurrencpp::details
+
+#endif
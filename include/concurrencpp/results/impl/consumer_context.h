@@ -26,10 +26,14 @@ namespace concurrencpp::details {
 
        private:
         std::atomic<const result_state_base*> m_status;
+        std::atomic_size_t m_departed_producers;
         coroutine_handle<void> m_coro_handle;
 
         static const result_state_base* k_processing;
         static const result_state_base* k_done_processing;
+        static const result_state_base* k_timed_out;
+
+        coroutine_handle<void> try_complete(const result_state_base* completed_result) noexcept;
 
        public:
         when_any_context(coroutine_handle<void> coro_handle) noexcept;
@@ -38,19 +42,77 @@ namespace concurrencpp::details {
         bool finish_processing() noexcept;
         const result_state_base* completed_result() const noexcept;
 
-        void try_resume(result_state_base& completed_result) noexcept;
+        coroutine_handle<void> try_resume(result_state_base& completed_result) noexcept;
         bool resume_inline(result_state_base& completed_result) noexcept;
+
+        // completes the context on behalf of a timer that races its results, see with_timeout.
+        coroutine_handle<void> try_time_out() noexcept;
+        bool timed_out() const noexcept;
+
+        /*
+            the context lives inside the awaiting coroutine frame. before it can be destroyed, the awaiter has to
+            wait for every producer that could not be unsubscribed to leave try_resume.
+        */
+        void wait_for_producers(size_t producer_count) const noexcept;
+    };
+
+    class CRCPP_API when_all_context {
+
+       private:
+        std::atomic_size_t m_countdown;
+        coroutine_handle<void> m_coro_handle;
+
+       public:
+        when_all_context(size_t result_count) noexcept;
+
+        // returns the awaiting coroutine if the calling producer is the last one to finish, a null handle otherwise.
+        coroutine_handle<void> try_resume() noexcept;
+        bool finish_processing(coroutine_handle<void> coro_handle, size_t ready_results) noexcept;
+    };
+
+    class CRCPP_API when_n_context {
+
+       public:
+        using result_filter = bool (*)(const result_state_base&) noexcept;
+
+       private:
+        enum class status { processing, done_processing, satisfied };
+
+        std::atomic<status> m_status;
+        std::atomic_size_t m_counted_results;
+        std::atomic_size_t m_finished_results;
+        std::atomic_size_t m_departed_producers;
+        const size_t m_required_results;
+        const size_t m_total_results;
+        const result_filter m_filter;
+        coroutine_handle<void> m_coro_handle;
+
+        bool count_result(const result_state_base& finished_result) noexcept;
+        coroutine_handle<void> try_complete(result_state_base& completed_result) noexcept;
+
+       public:
+        // a null filter counts every finished result, otherwise only the results the filter accepts are counted.
+        when_n_context(coroutine_handle<void> coro_handle, size_t required_results, size_t total_results, result_filter filter) noexcept;
+
+        bool satisfied() const noexcept;
+        bool finish_processing() noexcept;
+        bool on_ready_result(const result_state_base& ready_result) noexcept;
+
+        coroutine_handle<void> try_resume(result_state_base& completed_result) noexcept;
+        void wait_for_producers(size_t producer_count) const noexcept;
     };
 
     class CRCPP_API consumer_context {
 
        private:
-        enum class consumer_status { idle, await, wait_for, when_any, shared };
+        enum class consumer_status { idle, await, wait_for, when_any, when_all, when_n, shared };
 
         union storage {
             coroutine_handle<void> caller_handle;
             std::shared_ptr<std::binary_semaphore> wait_for_ctx;
-            std::shared_ptr<when_any_context> when_any_ctx;
+            when_any_context* when_any_ctx;
+            when_all_context* when_all_ctx;
+            when_n_context* when_n_ctx;
             std::weak_ptr<shared_result_state_base> shared_ctx;
 
             storage() noexcept {}
@@ -67,11 +129,14 @@ namespace concurrencpp::details {
         ~consumer_context() noexcept;
 
         void clear() noexcept;
-        void resume_consumer(result_state_base& self) const;
+        // returns the consumer coroutine that has to be resumed by the caller, or a null handle if there is none.
+        coroutine_handle<void> resume_consumer(result_state_base& self) const;
 
         void set_await_handle(coroutine_handle<void> caller_handle) noexcept;
         void set_wait_for_context(const std::shared_ptr<std::binary_semaphore>& wait_ctx) noexcept;
-        void set_when_any_context(const std::shared_ptr<when_any_context>& when_any_ctx) noexcept;
+        void set_when_any_context(when_any_context* when_any_ctx) noexcept;
+        void set_when_all_context(when_all_context* when_all_ctx) noexcept;
+        void set_when_n_context(when_n_context* when_n_ctx) noexcept;
         void set_shared_context(const std::shared_ptr<shared_result_state_base>& shared_ctx) noexcept;
     };
 }  // namespace concurrencpp::details
@@ -4,6 +4,9 @@
 #include "concurrencpp/forward_declarations.h"
 #include "concurrencpp/coroutines/coroutine.h"
 
+#include <span>
+#include <iterator>
+
 namespace concurrencpp::details {
     template<typename type>
     class generator_state {
@@ -12,9 +15,26 @@ namespace concurrencpp::details {
         using value_type = std::remove_reference_t<type>;
 
        private:
+        /*
+            [m_value, m_batch_end) are the values of the latest co_yield that weren't consumed yet. a single value is
+            a batch of one, a std::span batch is consumed without resuming the generator for each value.
+        */
         value_type* m_value = nullptr;
+        value_type* m_batch_end = nullptr;
         std::exception_ptr m_exception;
 
+        // an empty batch has nothing to consume, so the generator continues to run
+        struct yield_awaitable {
+            const bool empty_batch;
+
+            bool await_ready() const noexcept {
+                return empty_batch;
+            }
+
+            constexpr void await_suspend(coroutine_handle<void>) const noexcept {}
+            constexpr void await_resume() const noexcept {}
+        };
+
        public:
         generator<type> get_return_object() noexcept {
             return generator<type> {coroutine_handle<generator_state<type>>::from_promise(*this)};
@@ -28,14 +48,22 @@ namespace concurrencpp::details {
             return {};
         }
 
-        suspend_always yield_value(value_type& ref) noexcept {
+        yield_awaitable yield_value(value_type& ref) noexcept {
             m_value = std::addressof(ref);
-            return {};
+            m_batch_end = m_value + 1;
+            return {false};
         }
 
-        suspend_always yield_value(value_type&& ref) noexcept {
+        yield_awaitable yield_value(value_type&& ref) noexcept {
             m_value = std::addressof(ref);
-            return {};
+            m_batch_end = m_value + 1;
+            return {false};
+        }
+
+        yield_awaitable yield_value(std::span<value_type> batch) noexcept {
+            m_value = batch.data();
+            m_batch_end = batch.data() + batch.size();
+            return {batch.empty()};
         }
 
         void unhandled_exception() noexcept {
@@ -44,6 +72,12 @@ namespace concurrencpp::details {
 
         void return_void() const noexcept {}
 
+        // moves to the next value of the current batch, returns false if the batch is consumed.
+        bool next_in_batch() noexcept {
+            assert(m_value != nullptr);
+            return ++m_value < m_batch_end;
+        }
+
         value_type& value() const noexcept {
             assert(m_value != nullptr);
             assert(reinterpret_cast<std::intptr_t>(m_value) % alignof(value_type) == 0);
@@ -73,6 +107,8 @@ namespace concurrencpp::details {
         using difference_type = std::ptrdiff_t;
 
        public:
+        generator_iterator() noexcept = default;
+
         generator_iterator(coroutine_handle<generator_state<type>> handle) noexcept : m_coro_handle(handle) {
             assert(static_cast<bool>(m_coro_handle));
         }
@@ -80,6 +116,11 @@ namespace concurrencpp::details {
         generator_iterator& operator++() {
             assert(static_cast<bool>(m_coro_handle));
             assert(!m_coro_handle.done());
+
+            if (m_coro_handle.promise().next_in_batch()) {
+                return *this;
+            }
+
             m_coro_handle.resume();
 
             if (m_coro_handle.done()) {
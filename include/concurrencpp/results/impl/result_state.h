@@ -26,11 +26,13 @@ namespace concurrencpp::details {
        public:
         void wait();
         bool await(coroutine_handle<void> caller_handle) noexcept;
-        pc_state when_any(const std::shared_ptr<when_any_context>& when_any_state) noexcept;
+        pc_state when_any(when_any_context& when_any_state) noexcept;
+        pc_state when_all(when_all_context& when_all_state) noexcept;
+        pc_state when_n(when_n_context& when_n_state) noexcept;
 
         void share(const std::shared_ptr<shared_result_state_base>& shared_result_state) noexcept;
 
-        void try_rewind_consumer() noexcept;
+        bool try_rewind_consumer() noexcept;
     };
 
     template<class type>
@@ -178,7 +180,12 @@ namespace concurrencpp::details {
             }
         }
 
-        void complete_producer(coroutine_handle<void> done_handle = {}) {
+        /*
+            Publishes the result and returns the consumer coroutine that should run next, or a null handle.
+            Coroutine producers return it from their final awaiter so the consumer is resumed by symmetric transfer
+            instead of being resumed on top of the producer's stack frames.
+        */
+        coroutine_handle<void> complete_coroutine_producer(coroutine_handle<void> done_handle) {
             m_done_handle = done_handle;
 
             const auto state_before = this->m_pc_state.exchange(pc_state::producer_done, std::memory_order_acq_rel);
@@ -190,15 +197,17 @@ namespace concurrencpp::details {
                 }
 
                 case pc_state::idle: {
-                    return;
+                    return {};
                 }
 
                 case pc_state::consumer_waiting: {
-                    return m_pc_state.notify_one();
+                    m_pc_state.notify_one();
+                    return {};
                 }
 
                 case pc_state::consumer_done: {
-                    return delete_self(this);
+                    delete_self(this);
+                    return {};
                 }
 
                 default: {
@@ -207,6 +216,14 @@ namespace concurrencpp::details {
             }
 
             assert(false);
+            return {};
+        }
+
+        void complete_producer() {
+            const auto consumer_handle = complete_coroutine_producer({});
+            if (static_cast<bool>(consumer_handle)) {
+                consumer_handle();
+            }
         }
 
         void complete_consumer() noexcept {
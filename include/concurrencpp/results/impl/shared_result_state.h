@@ -4,8 +4,9 @@
 #include "concurrencpp/platform_defs.h"
 #include "concurrencpp/results/impl/result_state.h"
 
+#include <mutex>
 #include <atomic>
-#include <semaphore>
+#include <condition_variable>
 
 #include <cassert>
 
@@ -20,6 +21,7 @@ namespace concurrencpp::details {
     struct CRCPP_API shared_await_context {
         shared_await_context* next = nullptr;
         coroutine_handle<void> caller_handle;
+        bool interrupted = false;
     };
 
     class CRCPP_API shared_result_state_base {
@@ -27,10 +29,18 @@ namespace concurrencpp::details {
        protected:
         std::atomic<result_status> m_status {result_status::idle};
         std::atomic<shared_await_context*> m_awaiters {nullptr};
-        std::counting_semaphore<> m_semaphore {0};
+        std::mutex m_timed_wait_lock;
+        std::condition_variable m_timed_wait_condition;
+        std::shared_ptr<executor> m_resume_executor;
 
         static shared_await_context* result_ready_constant() noexcept;
 
+        static void resume_inline(shared_await_context* awaiters) noexcept;
+        void resume_via_executor(shared_await_context* awaiters) noexcept;
+
+        void resume_awaiters() noexcept;
+        void notify_waiters() noexcept;
+
        public:
         virtual ~shared_result_state_base() noexcept = default;
 
@@ -42,19 +52,25 @@ namespace concurrencpp::details {
 
         bool await(shared_await_context& awaiter) noexcept;
 
+        void set_resume_executor(std::shared_ptr<executor> resume_executor) noexcept;
+
         template<class duration_unit, class ratio>
         result_status wait_for(std::chrono::duration<duration_unit, ratio> duration) {
-            const auto time_point = std::chrono::system_clock::now() + duration;
+            const auto time_point = std::chrono::steady_clock::now() + duration;
             return wait_until(time_point);
         }
 
         template<class clock, class duration>
         result_status wait_until(const std::chrono::time_point<clock, duration>& timeout_time) {
-            while ((status() == result_status::idle) && (clock::now() < timeout_time)) {
-                const auto res = m_semaphore.try_acquire_until(timeout_time);
-                (void)res;
+            if (status() != result_status::idle) {
+                return status();
             }
 
+            std::unique_lock<std::mutex> lock(m_timed_wait_lock);
+            m_timed_wait_condition.wait_until(lock, timeout_time, [this] {
+                return status() != result_status::idle;
+            });
+
             return status();
         }
     };
@@ -88,36 +104,9 @@ namespace concurrencpp::details {
 
         void on_result_finished() noexcept override {
             m_status.store(m_result_state->status(), std::memory_order_release);
-            m_status.notify_all();
-
-            /* theoretically buggish, practically there's no way
-               that we'll have more than max(ptrdiff_t) / 2 waiters.
-               on 64 bits, that's 2^62 waiters, on 32 bits thats 2^30 waiters.
-               memory will run out before enough tasks could be created to wait this synchronously
-            */
-            m_semaphore.release(m_semaphore.max() / 2);
-
-            auto k_result_ready = result_ready_constant();
-            auto awaiters = m_awaiters.exchange(k_result_ready, std::memory_order_acq_rel);
-
-            shared_await_context* current = awaiters;
-            shared_await_context *prev = nullptr, *next = nullptr;
-
-            while (current != nullptr) {
-                next = current->next;
-                current->next = prev;
-                prev = current;
-                current = next;
-            }
-
-            awaiters = prev;
+            notify_waiters();
 
-            while (awaiters != nullptr) {
-                assert(static_cast<bool>(awaiters->caller_handle));
-                auto caller_handle = awaiters->caller_handle;
-                awaiters = awaiters->next;
-                caller_handle();
-            }
+            resume_awaiters();
         }
     };
 }  // namespace concurrencpp::details
@@ -96,8 +96,13 @@ namespace concurrencpp::details {
 
     struct result_publisher : public suspend_always {
         template<class promise_type>
-        void await_suspend(coroutine_handle<promise_type> handle) const noexcept {
-            handle.promise().complete_producer(handle);
+        coroutine_handle<void> await_suspend(coroutine_handle<promise_type> handle) const noexcept {
+            const auto consumer_handle = handle.promise().complete_producer(handle);
+            if (static_cast<bool>(consumer_handle)) {
+                return consumer_handle;
+            }
+
+            return noop_coroutine();
         }
     };
 
@@ -121,8 +126,8 @@ namespace concurrencpp::details {
             return {&m_result_state};
         }
 
-        void complete_producer(coroutine_handle<void> done_handle) noexcept {
-            this->m_result_state.complete_producer(done_handle);
+        coroutine_handle<void> complete_producer(coroutine_handle<void> done_handle) noexcept {
+            return this->m_result_state.complete_coroutine_producer(done_handle);
         }
 
         result_publisher final_suspend() const noexcept {
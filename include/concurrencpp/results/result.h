@@ -19,6 +19,7 @@ namespace concurrencpp {
 
         friend class details::when_result_helper;
         friend struct details::shared_result_helper;
+        friend class details::timeout_awaitable<type>;
 
        private:
         details::consumer_result_state_ptr<type> m_state;
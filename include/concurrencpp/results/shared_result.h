@@ -18,6 +18,17 @@ namespace concurrencpp {
             }
         }
 
+        void share_result(result<type> rhs, std::shared_ptr<executor> resume_executor) {
+            if (!static_cast<bool>(rhs)) {
+                return;
+            }
+
+            auto result_state = details::shared_result_helper::get_state(rhs);
+            m_state = std::make_shared<details::shared_result_state<type>>(std::move(result_state));
+            m_state->set_resume_executor(std::move(resume_executor));
+            m_state->share(std::static_pointer_cast<details::shared_result_state_base>(m_state));
+        }
+
        public:
         shared_result() noexcept = default;
         ~shared_result() noexcept = default;
@@ -25,13 +36,16 @@ namespace concurrencpp {
         shared_result(std::shared_ptr<details::shared_result_state<type>> state) noexcept : m_state(std::move(state)) {}
 
         shared_result(result<type> rhs) {
-            if (!static_cast<bool>(rhs)) {
-                return;
+            share_result(std::move(rhs), {});
+        }
+
+        template<class executor_type>
+        shared_result(result<type> rhs, std::shared_ptr<executor_type> resume_executor) {
+            if (!static_cast<bool>(resume_executor)) {
+                throw std::invalid_argument(details::consts::k_shared_result_null_resume_executor_error_msg);
             }
 
-            auto result_state = details::shared_result_helper::get_state(rhs);
-            m_state = std::make_shared<details::shared_result_state<type>>(std::move(result_state));
-            m_state->share(std::static_pointer_cast<details::shared_result_state_base>(m_state));
+            share_result(std::move(rhs), std::move(resume_executor));
         }
 
         shared_result(const shared_result& rhs) noexcept = default;
@@ -1,6 +1,8 @@
 #ifndef CONCURRENCPP_SHARED_RESULT_AWAITABLE_H
 #define CONCURRENCPP_SHARED_RESULT_AWAITABLE_H
 
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
 #include "concurrencpp/results/impl/shared_result_state.h"
 
 namespace concurrencpp::details {
@@ -15,6 +17,12 @@ namespace concurrencpp::details {
 
         shared_awaitable_base(const shared_awaitable_base&) = delete;
         shared_awaitable_base(shared_awaitable_base&&) = delete;
+
+        static void throw_if_interrupted(const shared_await_context& await_ctx) {
+            if (await_ctx.interrupted) {
+                throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+            }
+        }
     };
 }  // namespace concurrencpp::details
 
@@ -36,6 +44,7 @@ namespace concurrencpp {
         }
 
         std::add_lvalue_reference_t<type> await_resume() {
+            this->throw_if_interrupted(m_await_ctx);
             return this->m_state->get();
         }
     };
@@ -57,6 +66,7 @@ namespace concurrencpp {
         }
 
         shared_result<type> await_resume() {
+            this->throw_if_interrupted(m_await_ctx);
             return shared_result<type>(std::move(this->m_state));
         }
     };
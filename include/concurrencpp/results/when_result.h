@@ -8,6 +8,8 @@
 #include <tuple>
 #include <memory>
 #include <vector>
+#include <optional>
+#include <stop_token>
 
 namespace concurrencpp::details {
     class when_result_helper {
@@ -77,20 +79,34 @@ namespace concurrencpp::details {
             }
         }
 
+        template<class result_types>
         class when_all_awaitable {
 
            private:
-            result_state_base& m_state;
+            when_all_context m_context;
+            result_types& m_results;
 
            public:
-            when_all_awaitable(result_state_base& state) noexcept : m_state(state) {}
+            when_all_awaitable(result_types& results) noexcept :
+                m_context(when_result_helper::size(results)), m_results(results) {}
 
             bool await_ready() const noexcept {
                 return false;
             }
 
-            bool await_suspend(details::coroutine_handle<void> coro_handle) noexcept {
-                return m_state.await(coro_handle);
+            bool await_suspend(coroutine_handle<void> coro_handle) noexcept {
+                size_t ready_results = 0;
+
+                const auto range_length = when_result_helper::size(m_results);
+                for (size_t i = 0; i < range_length; i++) {
+                    auto& state_ref = when_result_helper::at(m_results, i);
+                    const auto status = state_ref.when_all(m_context);
+                    if (status == result_state_base::pc_state::producer_done) {
+                        ++ready_results;
+                    }
+                }
+
+                return m_context.finish_processing(coro_handle, ready_results);
             }
 
             void await_resume() const noexcept {}
@@ -100,8 +116,9 @@ namespace concurrencpp::details {
         class when_any_awaitable {
 
            private:
-            std::shared_ptr<when_any_context> m_promise;
+            std::optional<when_any_context> m_context;
             result_types& m_results;
+            size_t m_subscribed_results = 0;
 
            public:
             when_any_awaitable(result_types& results) noexcept : m_results(results) {}
@@ -110,42 +127,130 @@ namespace concurrencpp::details {
                 return false;
             }
 
-            bool await_suspend(coroutine_handle<void> coro_handle) {
-                m_promise = std::make_shared<when_any_context>(coro_handle);
+            bool await_suspend(coroutine_handle<void> coro_handle) noexcept {
+                m_context.emplace(coro_handle);
 
                 const auto range_length = when_result_helper::size(m_results);
                 for (size_t i = 0; i < range_length; i++) {
-                    if (m_promise->any_result_finished()) {
+                    if (m_context->any_result_finished()) {
                         return false;
                     }
 
                     auto& state_ref = when_result_helper::at(m_results, i);
-                    const auto status = state_ref.when_any(m_promise);
+                    const auto status = state_ref.when_any(*m_context);
                     if (status == result_state_base::pc_state::producer_done) {
-                        return m_promise->resume_inline(state_ref);
+                        return m_context->resume_inline(state_ref);
                     }
+
+                    ++m_subscribed_results;
                 }
 
-                return m_promise->finish_processing();
+                return m_context->finish_processing();
             }
 
             size_t await_resume() noexcept {
-                const auto completed_result_state = m_promise->completed_result();
+                const auto completed_result_state = m_context->completed_result();
                 auto completed_result_index = std::numeric_limits<size_t>::max();
+                size_t rewound_results = 0;
 
                 const auto range_length = when_result_helper::size(m_results);
                 for (size_t i = 0; i < range_length; i++) {
                     auto& state_ref = when_result_helper::at(m_results, i);
-                    state_ref.try_rewind_consumer();
+                    if (state_ref.try_rewind_consumer()) {
+                        ++rewound_results;
+                    }
+
                     if (completed_result_state == &state_ref) {
                         completed_result_index = i;
                     }
                 }
 
+                // every subscribed result that could not be rewound was completed, and its producer calls try_resume.
+                m_context->wait_for_producers(m_subscribed_results - rewound_results);
+
                 assert(completed_result_index != std::numeric_limits<size_t>::max());
                 return completed_result_index;
             }
         };
+
+        template<class type>
+        class when_n_awaitable {
+
+           private:
+            std::optional<when_n_context> m_context;
+            std::vector<result<type>>& m_results;
+            const size_t m_required_results;
+            const when_n_context::result_filter m_filter;
+            size_t m_subscribed_results = 0;
+
+            static bool result_succeeded(const result_state_base& state) noexcept {
+                return static_cast<const result_state<type>&>(state).status() == result_status::value;
+            }
+
+           public:
+            when_n_awaitable(std::vector<result<type>>& results, size_t required_results, bool count_only_values) noexcept :
+                m_results(results), m_required_results(required_results),
+                m_filter(count_only_values ? &when_n_awaitable::result_succeeded : nullptr) {}
+
+            bool await_ready() const noexcept {
+                return m_required_results == 0;
+            }
+
+            bool await_suspend(coroutine_handle<void> coro_handle) noexcept {
+                m_context.emplace(coro_handle, m_required_results, m_results.size(), m_filter);
+
+                for (auto& result : m_results) {
+                    if (m_context->satisfied()) {
+                        return false;
+                    }
+
+                    auto& state_ref = get_state_base(result);
+                    const auto status = state_ref.when_n(*m_context);
+                    if (status == result_state_base::pc_state::producer_done) {
+                        if (m_context->on_ready_result(state_ref)) {
+                            return false;
+                        }
+
+                        continue;
+                    }
+
+                    ++m_subscribed_results;
+                }
+
+                return m_context->finish_processing();
+            }
+
+            std::vector<size_t> await_resume() {
+                if (!m_context.has_value()) {
+                    assert(m_required_results == 0);
+                    return {};
+                }
+
+                size_t rewound_results = 0;
+                for (auto& result : m_results) {
+                    if (get_state_base(result).try_rewind_consumer()) {
+                        ++rewound_results;
+                    }
+                }
+
+                // every subscribed result that could not be rewound was completed, and its producer calls try_resume.
+                m_context->wait_for_producers(m_subscribed_results - rewound_results);
+
+                std::vector<size_t> indices;
+                for (size_t i = 0; i < m_results.size(); i++) {
+                    const auto status = m_results[i].status();
+                    if (status == result_status::idle) {
+                        continue;
+                    }
+
+                    if ((m_filter == nullptr) || (status == result_status::value)) {
+                        indices.emplace_back(i);
+                    }
+                }
+
+                return indices;
+            }
+        };
     };
 }  // namespace concurrencpp::details
 
@@ -164,16 +269,20 @@ namespace concurrencpp {
         when_any_result(when_any_result&&) noexcept = default;
         when_any_result& operator=(when_any_result&&) noexcept = default;
     };
+
+    enum class when_n_policy { completed, succeeded };
+
+    template<class sequence_type>
+    struct when_n_result {
+        std::vector<std::size_t> indices;
+        sequence_type results;
+    };
 }  // namespace concurrencpp
 
 namespace concurrencpp::details {
     template<class executor_type, class collection_type>
     lazy_result<collection_type> when_all_impl(std::shared_ptr<executor_type> resume_executor, collection_type collection) {
-        for (size_t i = 0; i < when_result_helper::size(collection); i++) {
-            auto& state_ref = when_result_helper::at(collection, i);
-            co_await when_result_helper::when_all_awaitable {state_ref};
-        }
-
+        co_await when_result_helper::when_all_awaitable<collection_type> {collection};
         co_await resume_on(resume_executor);
         co_return std::move(collection);
     }
@@ -224,16 +333,21 @@ namespace concurrencpp {
 
 namespace concurrencpp::details {
     template<class executor_type, class tuple_type>
-    lazy_result<when_any_result<tuple_type>> when_any_impl(std::shared_ptr<executor_type> resume_executor, tuple_type tuple) {
+    lazy_result<when_any_result<tuple_type>> when_any_impl(std::stop_source stop_source,
+                                                           std::shared_ptr<executor_type> resume_executor,
+                                                           tuple_type tuple) {
         const auto completed_index = co_await when_result_helper::when_any_awaitable<tuple_type> {tuple};
+        stop_source.request_stop();
         co_await resume_on(resume_executor);
         co_return when_any_result<tuple_type> {completed_index, std::move(tuple)};
     }
 
     template<class executor_type, class type>
-    lazy_result<when_any_result<std::vector<type>>> when_any_impl(std::shared_ptr<executor_type> resume_executor,
+    lazy_result<when_any_result<std::vector<type>>> when_any_impl(std::stop_source stop_source,
+                                                                  std::shared_ptr<executor_type> resume_executor,
                                                                   std::vector<type> vector) {
         const auto completed_index = co_await when_result_helper::when_any_awaitable {vector};
+        stop_source.request_stop();
         co_await resume_on(resume_executor);
         co_return when_any_result<std::vector<type>> {completed_index, std::move(vector)};
     }
@@ -251,7 +365,9 @@ namespace concurrencpp {
             throw std::invalid_argument(details::consts::k_when_any_null_resume_executor_error_msg);
         }
 
-        return details::when_any_impl(resume_executor, std::make_tuple(std::forward<result_types>(results)...));
+        return details::when_any_impl(std::stop_source(std::nostopstate),
+                                      resume_executor,
+                                      std::make_tuple(std::forward<result_types>(results)...));
     }
 
     template<class executor_type, class iterator_type>
@@ -269,9 +385,94 @@ namespace concurrencpp {
 
         using type = typename std::iterator_traits<iterator_type>::value_type;
 
-        return details::when_any_impl(resume_executor,
+        return details::when_any_impl(std::stop_source(std::nostopstate),
+                                      resume_executor,
+                                      std::vector<type> {std::make_move_iterator(begin), std::make_move_iterator(end)});
+    }
+
+    /*
+        Overloads. Similar to when_any(resume_executor, ...), but also request stop_source to stop once the first
+        result completes, so producers that observe one of its stop tokens can abandon their work.
+    */
+    template<class executor_type, class... result_types>
+    lazy_result<when_any_result<std::tuple<result_types...>>> when_any(std::stop_source stop_source,
+                                                                       std::shared_ptr<executor_type> resume_executor,
+                                                                       result_types&&... results) {
+        static_assert(sizeof...(result_types) != 0, "concurrencpp::when_any() - the function must accept at least one result object.");
+        details::when_result_helper::throw_if_empty_tuple(details::consts::k_when_any_empty_result_error_msg,
+                                                          std::forward<result_types>(results)...);
+
+        if (!static_cast<bool>(resume_executor)) {
+            throw std::invalid_argument(details::consts::k_when_any_null_resume_executor_error_msg);
+        }
+
+        return details::when_any_impl(std::move(stop_source),
+                                      resume_executor,
+                                      std::make_tuple(std::forward<result_types>(results)...));
+    }
+
+    template<class executor_type, class iterator_type>
+    lazy_result<when_any_result<std::vector<typename std::iterator_traits<iterator_type>::value_type>>>
+    when_any(std::stop_source stop_source, std::shared_ptr<executor_type> resume_executor, iterator_type begin, iterator_type end) {
+        details::when_result_helper::throw_if_empty_range(details::consts::k_when_any_empty_result_error_msg, begin, end);
+
+        if (begin == end) {
+            throw std::invalid_argument(details::consts::k_when_any_empty_range_error_msg);
+        }
+
+        if (!static_cast<bool>(resume_executor)) {
+            throw std::invalid_argument(details::consts::k_when_any_null_resume_executor_error_msg);
+        }
+
+        using type = typename std::iterator_traits<iterator_type>::value_type;
+
+        return details::when_any_impl(std::move(stop_source),
+                                      resume_executor,
                                       std::vector<type> {std::make_move_iterator(begin), std::make_move_iterator(end)});
     }
 }  // namespace concurrencpp
 
+namespace concurrencpp::details {
+    template<class executor_type, class type>
+    lazy_result<when_n_result<std::vector<type>>> when_n_impl(std::shared_ptr<executor_type> resume_executor,
+                                                              size_t count,
+                                                              when_n_policy policy,
+                                                              std::vector<type> vector) {
+        auto indices = co_await when_result_helper::when_n_awaitable {vector, count, policy == when_n_policy::succeeded};
+        co_await resume_on(resume_executor);
+        co_return when_n_result<std::vector<type>> {std::move(indices), std::move(vector)};
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Creates a lazy result that becomes ready once count of the given results are ready, or once all of them are,
+        whichever happens first. with when_n_policy::succeeded, only results that hold a value are counted.
+    */
+    template<class executor_type, class iterator_type>
+    lazy_result<when_n_result<std::vector<typename std::iterator_traits<iterator_type>::value_type>>>
+    when_n(std::shared_ptr<executor_type> resume_executor,
+           size_t count,
+           iterator_type begin,
+           iterator_type end,
+           when_n_policy policy = when_n_policy::completed) {
+        details::when_result_helper::throw_if_empty_range(details::consts::k_when_n_empty_result_error_msg, begin, end);
+
+        if (!static_cast<bool>(resume_executor)) {
+            throw std::invalid_argument(details::consts::k_when_n_null_resume_executor_error_msg);
+        }
+
+        if (count > static_cast<size_t>(std::distance(begin, end))) {
+            throw std::invalid_argument(details::consts::k_when_n_count_out_of_range_error_msg);
+        }
+
+        using type = typename std::iterator_traits<iterator_type>::value_type;
+
+        return details::when_n_impl(resume_executor,
+                                    count,
+                                    policy,
+                                    std::vector<type> {std::make_move_iterator(begin), std::make_move_iterator(end)});
+    }
+}  // namespace concurrencpp
+
 #endif
@@ -0,0 +1,270 @@
+#ifndef CONCURRENCPP_WITH_TIMEOUT_H
+#define CONCURRENCPP_WITH_TIMEOUT_H
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/timers/timer_queue.h"
+
+#include <memory>
+#include <stop_token>
+
+namespace concurrencpp {
+    /*
+        The outcome of awaiting with_timeout or with_deadline. Holds the awaited result, which is ready unless the
+        timeout expired first.
+    */
+    template<class type>
+    class timeout_result {
+
+       private:
+        result<type> m_result;
+        bool m_timed_out;
+
+       public:
+        timeout_result(result<type> result, bool timed_out) noexcept : m_result(std::move(result)), m_timed_out(timed_out) {}
+
+        timeout_result(timeout_result&& rhs) noexcept = default;
+        timeout_result& operator=(timeout_result&& rhs) noexcept = default;
+
+        bool timed_out() const noexcept {
+            return m_timed_out;
+        }
+
+        // true if the result completed before the timeout expired.
+        explicit operator bool() const noexcept {
+            return !m_timed_out;
+        }
+
+        // returns the value of the completed result or rethrows its exception.
+        // throws errors::timeout if the timeout expired first.
+        type get() {
+            if (m_timed_out) {
+                throw errors::timeout(details::consts::k_timeout_result_get_timed_out_error_msg);
+            }
+
+            return m_result.get();
+        }
+
+        // gives the result back. if the timeout expired first, the result is still running and can be awaited again.
+        result<type> release() noexcept {
+            return std::move(m_result);
+        }
+    };
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    class CRCPP_API timeout_awaitable_base : public suspend_always {
+
+       private:
+        const std::shared_ptr<timer_queue> m_timer_queue;
+        const timer_state_base::duration m_timeout;
+        std::shared_ptr<concurrencpp::executor> m_executor;
+        std::stop_source m_stop_source;
+        timer_state_ptr<timeout_timer_state> m_timer;
+        bool m_subscribed = false;
+
+       protected:
+        timeout_awaitable_base(std::shared_ptr<timer_queue> timer_queue,
+                               timer_state_base::duration timeout,
+                               std::shared_ptr<concurrencpp::executor> executor,
+                               std::stop_source stop_source) noexcept;
+
+        bool suspend(result_state_base& result_state, coroutine_handle<void> coro_handle);
+
+        // unsubscribes from the result and cancels the timer if it didn't fire. returns true if the timer won the race.
+        bool unsubscribe(result_state_base& result_state);
+
+        void on_timeout();
+
+       public:
+        timeout_awaitable_base(const timeout_awaitable_base&) = delete;
+        timeout_awaitable_base& operator=(const timeout_awaitable_base&) = delete;
+    };
+
+    /*
+        Returned by with_timeout and with_deadline. A result that is already ready is returned without arming a timer.
+        Otherwise the awaiting coroutine is resumed by whichever of the result and the timer completes first:
+        by the producer of the result, or on the given executor when the timeout expires.
+    */
+    template<class type>
+    class timeout_awaitable : public timeout_awaitable_base {
+
+       private:
+        result<type> m_result;
+
+       public:
+        timeout_awaitable(result<type> result,
+                          std::shared_ptr<timer_queue> timer_queue,
+                          timer_state_base::duration timeout,
+                          std::shared_ptr<concurrencpp::executor> executor,
+                          std::stop_source stop_source) noexcept :
+            timeout_awaitable_base(std::move(timer_queue), timeout, std::move(executor), std::move(stop_source)),
+            m_result(std::move(result)) {}
+
+        bool await_ready() const noexcept {
+            return m_result.m_state->status() != result_status::idle;
+        }
+
+        bool await_suspend(coroutine_handle<void> coro_handle) {
+            return suspend(*m_result.m_state, coro_handle);
+        }
+
+        timeout_result<type> await_resume() {
+            // a result that completed while the timer was firing still counts as completed in time.
+            const auto timed_out = unsubscribe(*m_result.m_state) && (m_result.m_state->status() == result_status::idle);
+            if (timed_out) {
+                on_timeout();
+            }
+
+            return {std::move(m_result), timed_out};
+        }
+    };
+
+    template<class type>
+    result<type> to_result(result<type> result) noexcept {
+        return result;
+    }
+
+    template<class type>
+    result<type> to_result(lazy_result<type> lazy) {
+        return lazy.run();
+    }
+
+    template<template<class> class result_type, class type>
+    timeout_awaitable<type> make_timeout_awaitable(std::stop_source stop_source,
+                                                   result_type<type> result,
+                                                   std::shared_ptr<timer_queue> timer_queue,
+                                                   timer_state_base::duration timeout,
+                                                   std::shared_ptr<concurrencpp::executor> executor) {
+        if (!static_cast<bool>(result)) {
+            throw errors::empty_result(consts::k_with_timeout_empty_result_error_msg);
+        }
+
+        if (!static_cast<bool>(timer_queue)) {
+            throw std::invalid_argument(consts::k_with_timeout_null_timer_queue_error_msg);
+        }
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(consts::k_with_timeout_null_executor_error_msg);
+        }
+
+        return {to_result(std::move(result)), std::move(timer_queue), timeout, std::move(executor), std::move(stop_source)};
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Awaits result for at most timeout and returns a timeout_result. If the timeout expires first, the awaiting
+        coroutine is resumed on executor and the result keeps running, it can be taken back with timeout_result::release.
+        The timer is armed on timer_queue, and is cancelled if the result completes first.
+        Throws errors::runtime_shutdown when awaited if timer_queue was shut down, and errors::broken_task if
+        timer_queue or executor shut down while the result was still running.
+    */
+    template<class type>
+    details::timeout_awaitable<type> with_timeout(result<type> result,
+                                                  std::shared_ptr<timer_queue> timer_queue,
+                                                  std::chrono::nanoseconds timeout,
+                                                  std::shared_ptr<executor> executor) {
+        return details::make_timeout_awaitable(std::stop_source(std::nostopstate),
+                                               std::move(result),
+                                               std::move(timer_queue),
+                                               timeout,
+                                               std::move(executor));
+    }
+
+    template<class type>
+    details::timeout_awaitable<type> with_timeout(lazy_result<type> lazy,
+                                                  std::shared_ptr<timer_queue> timer_queue,
+                                                  std::chrono::nanoseconds timeout,
+                                                  std::shared_ptr<executor> executor) {
+        return details::make_timeout_awaitable(std::stop_source(std::nostopstate),
+                                               std::move(lazy),
+                                               std::move(timer_queue),
+                                               timeout,
+                                               std::move(executor));
+    }
+
+    template<class type>
+    details::timeout_awaitable<type> with_deadline(result<type> result,
+                                                   std::shared_ptr<timer_queue> timer_queue,
+                                                   timer_queue::time_point deadline,
+                                                   std::shared_ptr<executor> executor) {
+        return details::make_timeout_awaitable(std::stop_source(std::nostopstate),
+                                               std::move(result),
+                                               std::move(timer_queue),
+                                               deadline - timer_queue::clock_type::now(),
+                                               std::move(executor));
+    }
+
+    template<class type>
+    details::timeout_awaitable<type> with_deadline(lazy_result<type> lazy,
+                                                   std::shared_ptr<timer_queue> timer_queue,
+                                                   timer_queue::time_point deadline,
+                                                   std::shared_ptr<executor> executor) {
+        return details::make_timeout_awaitable(std::stop_source(std::nostopstate),
+                                               std::move(lazy),
+                                               std::move(timer_queue),
+                                               deadline - timer_queue::clock_type::now(),
+                                               std::move(executor));
+    }
+
+    /*
+        Overloads. Similar to with_timeout(result, ...) and with_deadline(result, ...), but also request stop_source to
+        stop once the timeout expires, so a producer that observes one of its stop tokens can abandon its work.
+    */
+    template<class type>
+    details::timeout_awaitable<type> with_timeout(std::stop_source stop_source,
+                                                  result<type> result,
+                                                  std::shared_ptr<timer_queue> timer_queue,
+                                                  std::chrono::nanoseconds timeout,
+                                                  std::shared_ptr<executor> executor) {
+        return details::make_timeout_awaitable(std::move(stop_source),
+                                               std::move(result),
+                                               std::move(timer_queue),
+                                               timeout,
+                                               std::move(executor));
+    }
+
+    template<class type>
+    details::timeout_awaitable<type> with_timeout(std::stop_source stop_source,
+                                                  lazy_result<type> lazy,
+                                                  std::shared_ptr<timer_queue> timer_queue,
+                                                  std::chrono::nanoseconds timeout,
+                                                  std::shared_ptr<executor> executor) {
+        return details::make_timeout_awaitable(std::move(stop_source),
+                                               std::move(lazy),
+                                               std::move(timer_queue),
+                                               timeout,
+                                               std::move(executor));
+    }
+
+    template<class type>
+    details::timeout_awaitable<type> with_deadline(std::stop_source stop_source,
+                                                   result<type> result,
+                                                   std::shared_ptr<timer_queue> timer_queue,
+                                                   timer_queue::time_point deadline,
+                                                   std::shared_ptr<executor> executor) {
+        return details::make_timeout_awaitable(std::move(stop_source),
+                                               std::move(result),
+                                               std::move(timer_queue),
+                                               deadline - timer_queue::clock_type::now(),
+                                               std::move(executor));
+    }
+
+    template<class type>
+    details::timeout_awaitable<type> with_deadline(std::stop_source stop_source,
+                                                   lazy_result<type> lazy,
+                                                   std::shared_ptr<timer_queue> timer_queue,
+                                                   timer_queue::time_point deadline,
+                                                   std::shared_ptr<executor> executor) {
+        return details::make_timeout_awaitable(std::move(stop_source),
+                                               std::move(lazy),
+                                               std::move(timer_queue),
+                                               deadline - timer_queue::clock_type::now(),
+                                               std::move(executor));
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -35,6 +35,12 @@ namespace concurrencpp {
         std::chrono::milliseconds max_background_executor_waiting_time;
 
         std::chrono::milliseconds max_timer_queue_waiting_time;
+        timer_queue_backend timer_backend;
+        std::chrono::milliseconds timer_coalescing_window;
+        bool worker_local_timers;
+        std::chrono::microseconds timer_spin_window;
+
+        bool trampolined_inline_executor;
 
         // 网络 IO 池线程数（io_context_pool 大小）
         size_t net_io_pool_threads;
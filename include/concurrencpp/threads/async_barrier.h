@@ -0,0 +1,67 @@
+#ifndef CONCURRENCPP_ASYNC_BARRIER_H
+#define CONCURRENCPP_ASYNC_BARRIER_H
+
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/threads/async_waiter.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <atomic>
+#include <functional>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_barrier_awaiter : public async_waiter {
+
+       private:
+        async_barrier& m_parent;
+
+       public:
+        async_barrier_awaiter(async_barrier& parent, executor& resume_executor) noexcept;
+
+        constexpr bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(coroutine_handle<void> handle) noexcept;
+        void await_resume() const;
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Arriving coroutines push themselves to a lock-free stack before they count their arrival, so the last
+        coroutine to arrive finds all the others in the stack. It runs the completion function, starts the
+        next phase and resumes the others in bulk, while it continues synchronously.
+    */
+    class CRCPP_API async_barrier {
+
+        friend class details::async_barrier_awaiter;
+
+       private:
+        std::atomic_size_t m_remaining;
+        std::atomic_size_t m_expected;
+        std::atomic_size_t m_phase {0};
+        std::atomic<details::async_waiter*> m_waiters {nullptr};
+        std::function<void()> m_completion;
+
+        bool arrive() noexcept;
+        void complete_phase(details::async_waiter* self) noexcept;
+
+        lazy_result<void> arrive_and_wait_impl(std::shared_ptr<executor> resume_executor);
+
+       public:
+        async_barrier(size_t expected, std::function<void()> completion = {});
+        ~async_barrier() noexcept;
+
+        async_barrier(const async_barrier&) = delete;
+        async_barrier& operator=(const async_barrier&) = delete;
+
+        lazy_result<void> arrive_and_wait(std::shared_ptr<executor> resume_executor);
+        void arrive_and_drop();
+
+        size_t phase() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
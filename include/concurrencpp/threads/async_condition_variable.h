@@ -3,57 +3,97 @@
 
 #include "concurrencpp/utils/slist.h"
 #include "concurrencpp/threads/async_lock.h"
+#include "concurrencpp/threads/async_waiter.h"
 #include "concurrencpp/results/lazy_result.h"
 #include "concurrencpp/coroutines/coroutine.h"
 #include "concurrencpp/forward_declarations.h"
 
+#include <optional>
+
 namespace concurrencpp::details {
-    class CRCPP_API cv_awaiter {
+    // a type-erased reference to the predicate of a suspended task, evaluated by notify_satisfied.
+    struct cv_predicate {
+        bool (*invoke)(void*) = nullptr;
+        void* context = nullptr;
+    };
+
+    class CRCPP_API cv_awaiter : public async_waiter {
        private:
         async_condition_variable& m_parent;
         scoped_async_lock& m_lock;
-        coroutine_handle<void> m_caller_handle;
 
        public:
-        cv_awaiter* next = nullptr;
+        const std::optional<size_t> key;
+        const cv_predicate pred;
+        async_lock* const mutex;  // the lock that guards the memory pred reads.
 
-        cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock) noexcept;
+        cv_awaiter(async_condition_variable& parent,
+                   scoped_async_lock& lock,
+                   executor& resume_executor,
+                   std::optional<size_t> key,
+                   cv_predicate pred) noexcept;
 
         constexpr bool await_ready() const noexcept {
             return false;
         }
 
         void await_suspend(details::coroutine_handle<void> caller_handle);
-        void await_resume() const noexcept {}
-        void resume() noexcept;
+        void await_resume() const;
+
+        // returns true if this task has no predicate, or if its predicate is satisfied or throws.
+        bool satisfied() const noexcept;
     };
 }  // namespace concurrencpp::details
 
 namespace concurrencpp {
+    /*
+        Suspended tasks are resumed inside their resume executors; all the tasks that are resumed by a single notification
+        and share a resume executor are scheduled with a single executor::enqueue(span) call.
+        Tasks can wait on a key, so notifying one condition doesn't wake up the tasks that wait for other conditions.
+        notify_satisfied evaluates the predicates of the suspended tasks in the notifying task, so tasks whose
+        predicates don't hold are not resumed at all.
+    */
     class CRCPP_API async_condition_variable {
 
         friend details::cv_awaiter;
 
        private:
         template<class predicate_type>
-        lazy_result<void> await_impl(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock, predicate_type pred) {
+        lazy_result<void> await_impl(std::shared_ptr<executor> resume_executor,
+                                     scoped_async_lock& lock,
+                                     std::optional<size_t> key,
+                                     predicate_type pred) {
+            const details::cv_predicate erased_pred {[](void* context) {
+                                                         return static_cast<bool>((*static_cast<predicate_type*>(context))());
+                                                     },
+                                                     &pred};
+
             while (true) {
                 assert(lock.owns_lock());
                 if (pred()) {
                     break;
                 }
 
-                co_await await_impl(resume_executor, lock);
+                co_await await_impl(resume_executor, lock, key, erased_pred);
             }
         }
 
        private:
         std::mutex m_lock;
-        details::slist<details::cv_awaiter> m_awaiters;
+        details::slist<details::async_waiter> m_awaiters;
 
         static void verify_await_params(const std::shared_ptr<executor>& resume_executor, const scoped_async_lock& lock);
 
-        lazy_result<void> await_impl(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock);
+        lazy_result<void> await_impl(std::shared_ptr<executor> resume_executor,
+                                     scoped_async_lock& lock,
+                                     std::optional<size_t> key,
+                                     details::cv_predicate pred);
+
+        template<class filter_type>
+        details::slist<details::async_waiter> take_awaiters_locked(filter_type filter, size_t max_count) noexcept;
+
+        template<class filter_type>
+        void notify_impl(filter_type filter, size_t max_count);
 
        public:
         async_condition_variable() noexcept = default;
@@ -71,11 +111,28 @@ namespace concurrencpp {
                 "concurrencpp::async_condition_variable::await - given predicate isn't invocable with no arguments, or does not return a type which is or convertible to bool.");
 
             verify_await_params(resume_executor, lock);
-            return await_impl(std::move(resume_executor), lock, pred);
+            return await_impl(std::move(resume_executor), lock, std::nullopt, pred);
+        }
+
+        lazy_result<void> await_keyed(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock, size_t key);
+
+        template<class predicate_type>
+        lazy_result<void> await_keyed(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock, size_t key, predicate_type pred) {
+            static_assert(
+                std::is_invocable_r_v<bool, predicate_type>,
+                "concurrencpp::async_condition_variable::await_keyed - given predicate isn't invocable with no arguments, or does not return a type which is or convertible to bool.");
+
+            verify_await_params(resume_executor, lock);
+            return await_impl(std::move(resume_executor), lock, key, pred);
         }
 
         void notify_one();
         void notify_all();
+
+        void notify_one(size_t key);
+        void notify_all(size_t key);
+
+        void notify_satisfied(const scoped_async_lock& lock);
     };
 }  // namespace concurrencpp
 
@@ -0,0 +1,59 @@
+#ifndef CONCURRENCPP_ASYNC_LATCH_H
+#define CONCURRENCPP_ASYNC_LATCH_H
+
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/threads/async_waiter.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <atomic>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_latch_awaiter : public async_waiter {
+
+       private:
+        async_latch& m_parent;
+
+       public:
+        async_latch_awaiter(async_latch& parent, executor& resume_executor) noexcept;
+
+        bool await_ready() const noexcept;
+        bool await_suspend(coroutine_handle<void> handle) noexcept;
+        void await_resume() const;
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Waiting coroutines are pushed to a lock-free stack. The count_down that brings the counter to zero closes
+        the stack and resumes all of its coroutines in bulk.
+    */
+    class CRCPP_API async_latch {
+
+        friend class details::async_latch_awaiter;
+
+       private:
+        std::atomic_size_t m_counter;
+        std::atomic<details::async_waiter*> m_waiters {nullptr};
+
+        static details::async_waiter* released_constant() noexcept;
+
+        lazy_result<void> wait_impl(std::shared_ptr<executor> resume_executor);
+
+       public:
+        explicit async_latch(size_t expected) noexcept;
+        ~async_latch() noexcept;
+
+        async_latch(const async_latch&) = delete;
+        async_latch& operator=(const async_latch&) = delete;
+
+        void count_down(size_t update = 1);
+        bool try_wait() const noexcept;
+
+        lazy_result<void> wait(std::shared_ptr<executor> resume_executor);
+        lazy_result<void> arrive_and_wait(std::shared_ptr<executor> resume_executor, size_t update = 1);
+    };
+}  // namespace concurrencpp
+
+#endif
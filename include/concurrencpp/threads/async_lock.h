@@ -7,59 +7,82 @@
 #include "concurrencpp/results/lazy_result.h"
 #include "concurrencpp/forward_declarations.h"
 
+#include <atomic>
+#include <cstdint>
+
 namespace concurrencpp::details {
-    class async_lock_awaiter {
+    class CRCPP_API async_lock_awaiter {
 
         friend class concurrencpp::async_lock;
 
        private:
         async_lock& m_parent;
-        std::unique_lock<std::mutex> m_lock;
+        executor& m_resume_executor;
         coroutine_handle<void> m_resume_handle;
+        bool m_acquired = false;
+        bool m_interrupted = false;
+
+        void resume(bool acquired) noexcept;
 
        public:
         async_lock_awaiter* next = nullptr;
 
        public:
-        async_lock_awaiter(async_lock& parent, std::unique_lock<std::mutex>& lock) noexcept;
-
-        constexpr bool await_ready() const noexcept {
-            return false;
-        }
-
-        void await_suspend(coroutine_handle<void> handle);
+        async_lock_awaiter(async_lock& parent, executor& resume_executor) noexcept;
 
-        constexpr void await_resume() const noexcept {}
+        bool await_ready() noexcept;
+        bool await_suspend(coroutine_handle<void> handle) noexcept;
 
-        void retry() noexcept;
+        // returns true if the lock is now owned, false if the lock has to be acquired again (barging mode)
+        bool await_resume();
     };
 }  // namespace concurrencpp::details
 
 namespace concurrencpp {
     class scoped_async_lock;
 
+    /*
+        The lock is a single atomic word: the lowest bit marks the lock as owned, the rest of the word points to a
+        lock-free stack of coroutines that parked while the lock was owned. An uncontended lock/unlock is a single CAS each.
+        The owner of the lock also owns m_waiters, the parked coroutines in FIFO order. On unlock, the owner moves the
+        parked stack to m_waiters if needed and hands the lock directly to the first waiter, which is resumed inside its
+        resume executor already owning the lock.
+        In barging mode, unlock releases the lock and wakes the first waiter, which competes for the lock with
+        new arrivals and parks again if it loses. This trades fairness for throughput under heavy contention.
+    */
     class CRCPP_API async_lock {
 
         friend class scoped_async_lock;
         friend class details::async_lock_awaiter;
 
        private:
-        std::mutex m_awaiter_lock;
-        details::slist<details::async_lock_awaiter> m_awaiters;
-        bool m_locked = false;
+        constexpr static std::uintptr_t k_locked = 1;
+        constexpr static std::uintptr_t k_unlocked = 0;
+
+        std::atomic_uintptr_t m_state {k_unlocked};
+        details::slist<details::async_lock_awaiter> m_waiters;
+        const bool m_barging;
 
 #ifdef CRCPP_DEBUG_MODE
         std::atomic_intptr_t m_thread_count_in_critical_section {0};
 #endif
 
+        bool try_acquire() noexcept;
+        bool try_park(details::async_lock_awaiter& awaiter) noexcept;
+        void release() noexcept;
+
         lazy_result<scoped_async_lock> lock_impl(std::shared_ptr<executor> resume_executor, bool with_raii_guard);
 
        public:
+        async_lock() noexcept;
+        explicit async_lock(bool barging) noexcept;
         ~async_lock() noexcept;
 
         lazy_result<scoped_async_lock> lock(std::shared_ptr<executor> resume_executor);
         lazy_result<bool> try_lock();
         void unlock();
+
+        bool barging() const noexcept;
     };
 
     class CRCPP_API scoped_async_lock {
@@ -0,0 +1,71 @@
+#ifndef CONCURRENCPP_ASYNC_SEMAPHORE_H
+#define CONCURRENCPP_ASYNC_SEMAPHORE_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/threads/async_waiter.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <atomic>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_semaphore_awaiter : public async_waiter {
+
+        friend class concurrencpp::async_semaphore;
+
+       private:
+        async_semaphore& m_parent;
+        const size_t m_count;
+
+       public:
+        async_semaphore_awaiter(async_semaphore& parent, executor& resume_executor, size_t count) noexcept;
+
+        bool await_ready() noexcept;
+        void await_suspend(coroutine_handle<void> handle) noexcept;
+        void await_resume();
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Parked coroutines are pushed to a lock-free stack. Granting permits to parked coroutines is done by a single
+        dispatcher at a time: whoever releases permits or parks while no one else dispatches becomes the dispatcher,
+        others just leave a request that the current dispatcher picks up before it returns. The dispatcher owns the
+        FIFO of parked coroutines and grants permits strictly in order, so a large acquire is not starved by small ones.
+        All the coroutines that are granted permits by a single release are resumed in bulk.
+    */
+    class CRCPP_API async_semaphore {
+
+        friend class details::async_semaphore_awaiter;
+
+       private:
+        std::atomic_size_t m_permits;
+        std::atomic_size_t m_waiter_count {0};
+        std::atomic<details::async_waiter*> m_parked {nullptr};
+        std::atomic_size_t m_dispatch_requests {0};
+        details::slist<details::async_waiter> m_waiters;
+
+        bool try_take(size_t count) noexcept;
+        details::async_waiter* grant_waiters() noexcept;
+        void dispatch() noexcept;
+
+        lazy_result<void> acquire_impl(std::shared_ptr<executor> resume_executor, size_t count);
+
+       public:
+        explicit async_semaphore(size_t initial_permits) noexcept;
+        ~async_semaphore() noexcept;
+
+        async_semaphore(const async_semaphore&) = delete;
+        async_semaphore& operator=(const async_semaphore&) = delete;
+
+        lazy_result<void> acquire(std::shared_ptr<executor> resume_executor, size_t count = 1);
+        bool try_acquire(size_t count = 1) noexcept;
+        void release(size_t count = 1);
+
+        size_t available_permits() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef CONCURRENCPP_ASYNC_SHARED_MUTEX_H
+#define CONCURRENCPP_ASYNC_SHARED_MUTEX_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_shared_mutex_awaiter {
+
+        friend class concurrencpp::async_shared_mutex;
+
+       private:
+        async_shared_mutex& m_parent;
+        executor& m_resume_executor;
+        coroutine_handle<void> m_resume_handle;
+        const bool m_shared;
+        bool m_interrupted = false;
+
+        void resume() noexcept;
+
+       public:
+        async_shared_mutex_awaiter* next = nullptr;
+
+       public:
+        async_shared_mutex_awaiter(async_shared_mutex& parent, executor& resume_executor, bool shared) noexcept;
+
+        bool await_ready() noexcept;
+        bool await_suspend(coroutine_handle<void> handle);
+
+        // the mutex is always handed to a parked coroutine before it's resumed
+        void await_resume();
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    class scoped_async_shared_lock;
+    class scoped_async_unique_lock;
+
+    /*
+        The ownership of the mutex is a single atomic word: a writer bit, two bits that mark parked writers and parked
+        readers, and the number of readers that own the mutex. Acquiring and releasing shared ownership while no writer
+        owns or waits for the mutex is a single atomic operation.
+        Once a writer waits, new readers park behind it (writer preference). When a writer releases the mutex, all
+        the readers that parked in the meantime are granted the mutex together, before the next writer, so neither side starves.
+        Parked coroutines are handed the ownership directly and are resumed inside their resume executor.
+    */
+    class CRCPP_API async_shared_mutex {
+
+        friend class details::async_shared_mutex_awaiter;
+
+       private:
+        constexpr static std::uintptr_t k_writer = 1;
+        constexpr static std::uintptr_t k_writers_parked = 2;
+        constexpr static std::uintptr_t k_readers_parked = 4;
+        constexpr static std::uintptr_t k_reader = 8;
+        constexpr static std::uintptr_t k_flags_mask = k_reader - 1;
+
+        std::atomic_uintptr_t m_state {0};
+
+        std::mutex m_lock;
+        details::slist<details::async_shared_mutex_awaiter> m_parked_writers;
+        details::slist<details::async_shared_mutex_awaiter> m_parked_readers;
+
+        static std::uintptr_t reader_count(std::uintptr_t state) noexcept;
+
+        bool try_acquire_shared() noexcept;
+        bool try_acquire() noexcept;
+        bool try_park(details::async_shared_mutex_awaiter& awaiter);
+
+        void release_shared() noexcept;
+        void release() noexcept;
+        void hand_off() noexcept;
+
+        lazy_result<scoped_async_unique_lock> lock_impl(std::shared_ptr<executor> resume_executor);
+        lazy_result<scoped_async_shared_lock> lock_shared_impl(std::shared_ptr<executor> resume_executor);
+
+       public:
+        async_shared_mutex() noexcept = default;
+        ~async_shared_mutex() noexcept;
+
+        async_shared_mutex(const async_shared_mutex&) = delete;
+        async_shared_mutex& operator=(const async_shared_mutex&) = delete;
+
+        lazy_result<scoped_async_unique_lock> lock(std::shared_ptr<executor> resume_executor);
+        lazy_result<bool> try_lock();
+        void unlock();
+
+        lazy_result<scoped_async_shared_lock> lock_shared(std::shared_ptr<executor> resume_executor);
+        lazy_result<bool> try_lock_shared();
+        void unlock_shared();
+    };
+
+    class CRCPP_API scoped_async_unique_lock {
+
+       private:
+        async_shared_mutex* m_mutex = nullptr;
+        bool m_owns = false;
+
+       public:
+        scoped_async_unique_lock() noexcept = default;
+        scoped_async_unique_lock(scoped_async_unique_lock&& rhs) noexcept;
+        scoped_async_unique_lock(async_shared_mutex& mutex, std::adopt_lock_t) noexcept;
+
+        ~scoped_async_unique_lock() noexcept;
+
+        scoped_async_unique_lock& operator=(scoped_async_unique_lock&& rhs) noexcept;
+
+        void unlock();
+
+        bool owns_lock() const noexcept;
+        explicit operator bool() const noexcept;
+
+        void swap(scoped_async_unique_lock& rhs) noexcept;
+        async_shared_mutex* release() noexcept;
+        async_shared_mutex* mutex() const noexcept;
+    };
+
+    class CRCPP_API scoped_async_shared_lock {
+
+       private:
+        async_shared_mutex* m_mutex = nullptr;
+        bool m_owns = false;
+
+       public:
+        scoped_async_shared_lock() noexcept = default;
+        scoped_async_shared_lock(scoped_async_shared_lock&& rhs) noexcept;
+        scoped_async_shared_lock(async_shared_mutex& mutex, std::adopt_lock_t) noexcept;
+
+        ~scoped_async_shared_lock() noexcept;
+
+        scoped_async_shared_lock& operator=(scoped_async_shared_lock&& rhs) noexcept;
+
+        void unlock();
+
+        bool owns_lock() const noexcept;
+        explicit operator bool() const noexcept;
+
+        void swap(scoped_async_shared_lock& rhs) noexcept;
+        async_shared_mutex* release() noexcept;
+        async_shared_mutex* mutex() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef CONCURRENCPP_ASYNC_WAITER_H
+#define CONCURRENCPP_ASYNC_WAITER_H
+
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <atomic>
+
+namespace concurrencpp::details {
+    // a coroutine parked on an async_semaphore, async_latch or async_barrier
+    struct CRCPP_API async_waiter {
+        executor& resume_executor;
+        coroutine_handle<void> handle;
+        bool interrupted = false;
+        async_waiter* next = nullptr;
+
+        async_waiter(executor& resume_executor) noexcept : resume_executor(resume_executor) {}
+
+        // pushes *this to a lock-free stack of waiters. returns false without pushing if the stack was closed with closed_list.
+        bool push_to(std::atomic<async_waiter*>& head, async_waiter* closed_list = nullptr) noexcept;
+
+        // reverses a stack of waiters, so waiters are resumed by the order they came.
+        static async_waiter* reverse(async_waiter* waiters) noexcept;
+
+        /*
+            resumes a list of waiters inside their resume executors. waiters that share a resume executor are
+            scheduled with a single executor::enqueue(span) call.
+        */
+        static void resume_all(async_waiter* waiters) noexcept;
+    };
+}  // namespace concurrencpp::details
+
+#endif
@@ -0,0 +1,669 @@
+#ifndef CONCURRENCPP_CHANNEL_H
+#define CONCURRENCPP_CHANNEL_H
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/threads/async_waiter.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/executors/executor.h"
+
+#include <new>
+#include <span>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace concurrencpp {
+    enum class channel_mode { spsc, mpsc, mpmc };
+
+    template<class type, channel_mode mode = channel_mode::mpmc>
+    class channel;
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    /*
+        A bounded lock-free ring buffer. Every cell carries a sequence number that tells producers and consumers
+        whether the cell is free for the current lap. A side with a single thread claims cells with a plain store
+        instead of a CAS.
+    */
+    template<class type, bool multi_producer, bool multi_consumer>
+    class channel_ring {
+
+       private:
+        struct cell {
+            std::atomic_size_t sequence;
+            alignas(type) unsigned char storage[sizeof(type)];
+
+            type* value() noexcept {
+                return std::launder(reinterpret_cast<type*>(storage));
+            }
+        };
+
+        const size_t m_mask;
+        const std::unique_ptr<cell[]> m_cells;
+
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::atomic_size_t m_enqueue_pos {0};
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::atomic_size_t m_dequeue_pos {0};
+
+        static size_t round_capacity(size_t capacity) noexcept {
+            size_t rounded = 2;
+            while (rounded < capacity) {
+                rounded <<= 1;
+            }
+
+            return rounded;
+        }
+
+        template<bool multi_threaded>
+        static bool claim(std::atomic_size_t& position, size_t& pos) noexcept {
+            if constexpr (multi_threaded) {
+                return position.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed, std::memory_order_relaxed);
+            } else {
+                position.store(pos + 1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+       public:
+        channel_ring(size_t capacity) : m_mask(round_capacity(capacity) - 1), m_cells(std::make_unique<cell[]>(m_mask + 1)) {
+            for (size_t i = 0; i <= m_mask; i++) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~channel_ring() noexcept {
+            std::optional<type> ignored;
+            while (try_pop(ignored)) {
+                ignored.reset();
+            }
+        }
+
+        size_t capacity() const noexcept {
+            return m_mask + 1;
+        }
+
+        // moves value into the ring, value is untouched if the ring is full.
+        bool try_push(type& value) noexcept {
+            auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+
+            while (true) {
+                auto& cell = m_cells[pos & m_mask];
+                const auto sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                if (diff == 0) {
+                    if (claim<multi_producer>(m_enqueue_pos, pos)) {
+                        new (cell.storage) type(std::move(value));
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = m_enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool try_pop(std::optional<type>& out) noexcept {
+            auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+
+            while (true) {
+                auto& cell = m_cells[pos & m_mask];
+                const auto sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+                if (diff == 0) {
+                    if (claim<multi_consumer>(m_dequeue_pos, pos)) {
+                        auto value = cell.value();
+                        out.emplace(std::move(*value));
+                        value->~type();
+                        cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = m_dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    template<class type, channel_mode mode>
+    class channel_send_awaitable : public async_waiter {
+
+        friend class concurrencpp::channel<type, mode>;
+
+       private:
+        channel<type, mode>& m_parent;
+        const std::shared_ptr<executor> m_resume_executor;
+        std::optional<type> m_storage;
+        type& m_value;
+        bool m_accepted = false;
+
+        // sends value in place, value is moved from only if it's accepted
+        channel_send_awaitable(channel<type, mode>& parent, std::shared_ptr<executor> resume_executor, std::reference_wrapper<type> value) noexcept :
+            async_waiter(*resume_executor), m_parent(parent), m_resume_executor(std::move(resume_executor)), m_value(value.get()) {}
+
+       public:
+        channel_send_awaitable(channel<type, mode>& parent, std::shared_ptr<executor> resume_executor, type value) :
+            async_waiter(*resume_executor), m_parent(parent), m_resume_executor(std::move(resume_executor)), m_storage(std::move(value)),
+            m_value(*m_storage) {}
+
+        channel_send_awaitable(const channel_send_awaitable&) = delete;
+        channel_send_awaitable& operator=(const channel_send_awaitable&) = delete;
+
+        bool await_ready() noexcept {
+            m_accepted = m_parent.try_send_fast(m_value);
+            return m_accepted;
+        }
+
+        bool await_suspend(coroutine_handle<void> coro_handle) {
+            handle = coro_handle;
+            return m_parent.send_slow(this);
+        }
+
+        // returns false if the channel was closed before the value was accepted
+        bool await_resume() const {
+            if (interrupted) {
+                throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+            }
+
+            return m_accepted;
+        }
+    };
+
+    template<class type, channel_mode mode>
+    class channel_receive_awaitable : public async_waiter {
+
+        friend class concurrencpp::channel<type, mode>;
+
+       private:
+        channel<type, mode>& m_parent;
+        const std::shared_ptr<executor> m_resume_executor;
+        std::optional<type> m_value;
+
+       public:
+        channel_receive_awaitable(channel<type, mode>& parent, std::shared_ptr<executor> resume_executor) noexcept :
+            async_waiter(*resume_executor), m_parent(parent), m_resume_executor(std::move(resume_executor)) {}
+
+        channel_receive_awaitable(const channel_receive_awaitable&) = delete;
+        channel_receive_awaitable& operator=(const channel_receive_awaitable&) = delete;
+
+        bool await_ready() noexcept {
+            return m_parent.try_receive_fast(m_value);
+        }
+
+        bool await_suspend(coroutine_handle<void> coro_handle) {
+            handle = coro_handle;
+            return m_parent.receive_slow(this);
+        }
+
+        // returns an empty optional if the channel is closed and drained
+        std::optional<type> await_resume() {
+            if (interrupted) {
+                // the value that was handed to this coroutine is given back to the channel.
+                // if the channel can't store it, the allocation failure is thrown instead and the value is lost.
+                if (m_value.has_value()) {
+                    m_parent.requeue(std::move(*m_value));
+                }
+
+                throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+            }
+
+            return std::move(m_value);
+        }
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Values pass through a lock-free ring buffer. Coroutines that have to wait - receivers of an empty channel and
+        senders to a full bounded channel - park in FIFO lists guarded by a mutex, which is only taken when someone
+        waits, when an unbounded channel overflows its ring, or when the channel is closed.
+        A sender that finds parked receivers hands its value directly to the first one, and a receiver that finds parked
+        senders takes their values into the ring. Coroutines released together are resumed in bulk.
+        Values that an unbounded channel can't fit in its ring are kept in an overflow queue that is always behind the ring.
+    */
+    template<class type, channel_mode mode>
+    class channel {
+
+        static_assert(std::is_nothrow_move_constructible_v<type>, "concurrencpp::channel<type> - <<type>> must be nothrow move constructible.");
+
+        friend class details::channel_send_awaitable<type, mode>;
+        friend class details::channel_receive_awaitable<type, mode>;
+
+       private:
+        using ring_type = details::channel_ring<type, mode != channel_mode::spsc, mode == channel_mode::mpmc>;
+        using send_awaitable = details::channel_send_awaitable<type, mode>;
+        using receive_awaitable = details::channel_receive_awaitable<type, mode>;
+
+        ring_type m_ring;
+        const bool m_bounded;
+
+        std::atomic_bool m_closed {false};
+        std::atomic_size_t m_receivers_waiting {0};
+        std::atomic_size_t m_senders_waiting {0};
+        std::atomic_size_t m_overflow_size {0};
+
+        std::mutex m_lock;
+        std::deque<type> m_overflow;
+        details::slist<details::async_waiter> m_receivers;
+        details::slist<details::async_waiter> m_senders;
+
+        static void push_to(details::slist<details::async_waiter>& list, details::async_waiter& waiter) noexcept {
+            waiter.next = nullptr;
+            list.push_back(waiter);
+        }
+
+        // fast paths, no lock is taken
+
+        bool try_send_fast(type& value) noexcept {
+            const auto slow_path = m_receivers_waiting.load(std::memory_order_relaxed) | m_senders_waiting.load(std::memory_order_relaxed) |
+                m_overflow_size.load(std::memory_order_acquire);
+
+            if (slow_path != 0 || m_closed.load(std::memory_order_relaxed)) {
+                return false;
+            }
+
+            if (!m_ring.try_push(value)) {
+                return false;
+            }
+
+            // a receiver that parked before the value was pushed is handed the value
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_receivers_waiting.load(std::memory_order_relaxed) != 0) {
+                rebalance();
+            }
+
+            return true;
+        }
+
+        bool try_receive_fast(std::optional<type>& out) noexcept {
+            if (!m_ring.try_pop(out)) {
+                return false;
+            }
+
+            // a sender that parked before the cell was freed is admitted to the ring
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_senders_waiting.load(std::memory_order_relaxed) != 0) {
+                rebalance();
+            }
+
+            return true;
+        }
+
+        // slow paths, must be called while m_lock is held
+
+        bool take_next_locked(std::optional<type>& out, details::slist<details::async_waiter>& to_resume) noexcept {
+            if (m_ring.try_pop(out)) {
+                return true;
+            }
+
+            if (!m_overflow.empty()) {
+                out.emplace(std::move(m_overflow.front()));
+                m_overflow.pop_front();
+                m_overflow_size.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+
+            // a sender can be parked while the ring is empty if the receivers drained the ring before it was admitted.
+            if (!m_senders.empty()) {
+                const auto sender = static_cast<send_awaitable*>(m_senders.pop_front());
+                m_senders_waiting.fetch_sub(1, std::memory_order_relaxed);
+                out.emplace(std::move(sender->m_value));
+                sender->m_accepted = true;
+                push_to(to_resume, *sender);
+                return true;
+            }
+
+            return false;
+        }
+
+        void balance_locked(details::slist<details::async_waiter>& to_resume) noexcept {
+            while (!m_receivers.empty()) {
+                const auto receiver = static_cast<receive_awaitable*>(m_receivers.front());
+                if (!take_next_locked(receiver->m_value, to_resume)) {
+                    break;
+                }
+
+                m_receivers.pop_front();
+                m_receivers_waiting.fetch_sub(1, std::memory_order_relaxed);
+                push_to(to_resume, *receiver);
+            }
+
+            while (!m_senders.empty()) {
+                const auto sender = static_cast<send_awaitable*>(m_senders.front());
+                if (!m_ring.try_push(sender->m_value)) {
+                    break;
+                }
+
+                m_senders.pop_front();
+                m_senders_waiting.fetch_sub(1, std::memory_order_relaxed);
+                sender->m_accepted = true;
+                push_to(to_resume, *sender);
+            }
+        }
+
+        void rebalance() noexcept {
+            details::slist<details::async_waiter> to_resume;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                balance_locked(to_resume);
+            }
+
+            details::async_waiter::resume_all(to_resume.front());
+        }
+
+        // returns true if the sender was parked. if sender is null, the sender doesn't park.
+        bool send_slow(send_awaitable* sender, type& value, bool& accepted) {
+            details::slist<details::async_waiter> to_resume;
+            bool parked = false;
+            accepted = false;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+
+                if (m_closed.load(std::memory_order_relaxed)) {
+                    return false;
+                }
+
+                balance_locked(to_resume);
+
+                // producers move the overflow back to the ring, so values keep their order.
+                while (!m_overflow.empty() && m_ring.try_push(m_overflow.front())) {
+                    m_overflow.pop_front();
+                    m_overflow_size.fetch_sub(1, std::memory_order_release);
+                }
+
+                if (!m_receivers.empty()) {
+                    const auto receiver = static_cast<receive_awaitable*>(m_receivers.pop_front());
+                    m_receivers_waiting.fetch_sub(1, std::memory_order_relaxed);
+                    receiver->m_value.emplace(std::move(value));
+                    push_to(to_resume, *receiver);
+                    accepted = true;
+                } else if (m_overflow.empty() && m_senders.empty() && m_ring.try_push(value)) {
+                    accepted = true;
+                } else if (!m_bounded) {
+                    m_overflow.emplace_back(std::move(value));
+                    m_overflow_size.fetch_add(1, std::memory_order_release);
+                    accepted = true;
+                } else if (sender != nullptr) {
+                    m_senders_waiting.fetch_add(1, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    // a receiver might have freed a cell before it could see this sender
+                    if (m_senders.empty() && m_ring.try_push(value)) {
+                        m_senders_waiting.fetch_sub(1, std::memory_order_relaxed);
+                        accepted = true;
+                    } else {
+                        push_to(m_senders, *sender);
+                        parked = true;
+                    }
+                }
+            }
+
+            details::async_waiter::resume_all(to_resume.front());
+            return parked;
+        }
+
+        bool send_slow(send_awaitable* sender) {
+            return send_slow(sender, sender->m_value, sender->m_accepted);
+        }
+
+        // returns true if the receiver was parked. if receiver is null, the receiver doesn't park.
+        bool receive_slow(receive_awaitable* receiver, std::optional<type>& out) {
+            details::slist<details::async_waiter> to_resume;
+            bool parked = false;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+
+                m_receivers_waiting.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                balance_locked(to_resume);
+
+                if (m_receivers.empty() && take_next_locked(out, to_resume)) {
+                    m_receivers_waiting.fetch_sub(1, std::memory_order_relaxed);
+                    balance_locked(to_resume);
+                } else if (m_closed.load(std::memory_order_relaxed) || receiver == nullptr) {
+                    m_receivers_waiting.fetch_sub(1, std::memory_order_relaxed);
+                } else {
+                    push_to(m_receivers, *receiver);
+                    parked = true;
+                }
+            }
+
+            details::async_waiter::resume_all(to_resume.front());
+            return parked;
+        }
+
+        bool receive_slow(receive_awaitable* receiver) {
+            return receive_slow(receiver, receiver->m_value);
+        }
+
+        /*
+            The value was handed out before the values that are still queued, so it's put in front of the overflow,
+            the earliest position that is still free. A bounded channel might hold more values than its capacity
+            until then, but it doesn't accept new values before the overflow was moved back to the ring.
+        */
+        void requeue(type value) {
+            details::slist<details::async_waiter> to_resume;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+
+                m_overflow.emplace_front(std::move(value));
+                m_overflow_size.fetch_add(1, std::memory_order_release);
+
+                balance_locked(to_resume);
+            }
+
+            details::async_waiter::resume_all(to_resume.front());
+        }
+
+        static void throw_if_null(const std::shared_ptr<executor>& resume_executor, const char* error_msg) {
+            if (!static_cast<bool>(resume_executor)) {
+                throw std::invalid_argument(error_msg);
+            }
+        }
+
+        lazy_result<size_t> send_batch_impl(std::shared_ptr<executor> resume_executor, std::span<type> values) {
+            size_t sent = try_send_batch(values);
+
+            while (sent < values.size()) {
+                // values[sent] is sent in place, so it's left untouched if the channel is closed before it's accepted
+                send_awaitable sender(*this, resume_executor, std::ref(values[sent]));
+                if (!co_await sender) {
+                    break;
+                }
+
+                ++sent;
+                sent += try_send_batch(values.subspan(sent));
+            }
+
+            co_return sent;
+        }
+
+        lazy_result<std::vector<type>> receive_batch_impl(std::shared_ptr<executor> resume_executor, size_t max_count) {
+            std::vector<type> values;
+
+            auto first = co_await receive(std::move(resume_executor));
+            if (!first.has_value()) {
+                co_return values;
+            }
+
+            values.reserve(max_count);
+            values.emplace_back(std::move(*first));
+            try_receive_batch(std::back_inserter(values), max_count - 1);
+
+            co_return values;
+        }
+
+       public:
+        // constructs an unbounded channel
+        channel() : m_ring(details::consts::k_default_unbounded_channel_ring_capacity), m_bounded(false) {}
+
+        // constructs a bounded channel, capacity is rounded up to a power of two
+        explicit channel(size_t capacity) : m_ring(capacity), m_bounded(true) {
+            if (capacity == 0) {
+                throw std::invalid_argument(details::consts::k_channel_invalid_capacity_err_msg);
+            }
+        }
+
+        ~channel() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+            assert(m_receivers.empty() && "concurrencpp::channel is destroyed while coroutines wait to receive from it.");
+            assert(m_senders.empty() && "concurrencpp::channel is destroyed while coroutines wait to send to it.");
+#endif
+        }
+
+        channel(const channel&) = delete;
+        channel& operator=(const channel&) = delete;
+
+        details::channel_send_awaitable<type, mode> send(std::shared_ptr<executor> resume_executor, type value) {
+            throw_if_null(resume_executor, details::consts::k_channel_send_null_resume_executor_err_msg);
+            return {*this, std::move(resume_executor), std::move(value)};
+        }
+
+        details::channel_receive_awaitable<type, mode> receive(std::shared_ptr<executor> resume_executor) {
+            throw_if_null(resume_executor, details::consts::k_channel_receive_null_resume_executor_err_msg);
+            return {*this, std::move(resume_executor)};
+        }
+
+        // value is moved from only if it's accepted
+        bool try_send(type& value) {
+            if (try_send_fast(value)) {
+                return true;
+            }
+
+            bool accepted = false;
+            send_slow(nullptr, value, accepted);
+            return accepted;
+        }
+
+        bool try_send(type&& value) {
+            return try_send(value);
+        }
+
+        std::optional<type> try_receive() {
+            std::optional<type> value;
+            if (!try_receive_fast(value)) {
+                receive_slow(nullptr, value);
+            }
+
+            return value;
+        }
+
+        // sends values until the channel is full or closed, returns the number of values that were sent.
+        size_t try_send_batch(std::span<type> values) {
+            size_t sent = 0;
+            while (sent < values.size() && try_send(values[sent])) {
+                ++sent;
+            }
+
+            return sent;
+        }
+
+        // receives up to max_count values to out, returns the number of values that were received.
+        template<class output_iterator_type>
+        size_t try_receive_batch(output_iterator_type out, size_t max_count) {
+            size_t received = 0;
+            std::optional<type> value;
+
+            while (received < max_count) {
+                value = try_receive();
+                if (!value.has_value()) {
+                    break;
+                }
+
+                *out = std::move(*value);
+                ++out;
+                ++received;
+            }
+
+            return received;
+        }
+
+        /*
+            sends all values, suspending while the channel is full. returns the number of values that were sent,
+            which is smaller than values.size() only if the channel was closed. values that were not sent are not moved from.
+        */
+        lazy_result<size_t> send_batch(std::shared_ptr<executor> resume_executor, std::span<type> values) {
+            throw_if_null(resume_executor, details::consts::k_channel_send_batch_null_resume_executor_err_msg);
+            return send_batch_impl(std::move(resume_executor), values);
+        }
+
+        /*
+            waits for at least one value and returns it together with the values that are already available, up to max_count.
+            returns an empty vector if the channel is closed and drained.
+        */
+        lazy_result<std::vector<type>> receive_batch(std::shared_ptr<executor> resume_executor, size_t max_count) {
+            throw_if_null(resume_executor, details::consts::k_channel_receive_batch_null_resume_executor_err_msg);
+
+            if (max_count == 0) {
+                throw std::invalid_argument(details::consts::k_channel_receive_batch_invalid_count_err_msg);
+            }
+
+            return receive_batch_impl(std::move(resume_executor), max_count);
+        }
+
+        /*
+            closes the channel. senders can't send new values, and suspended senders are resumed with false.
+            values that are already in the channel can still be received, after which receivers get an empty optional.
+        */
+        void close() {
+            details::slist<details::async_waiter> to_resume;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                if (m_closed.exchange(true, std::memory_order_relaxed)) {
+                    return;
+                }
+
+                balance_locked(to_resume);
+
+                while (const auto receiver = m_receivers.pop_front()) {
+                    m_receivers_waiting.fetch_sub(1, std::memory_order_relaxed);
+                    push_to(to_resume, *receiver);
+                }
+
+                while (const auto sender = m_senders.pop_front()) {
+                    m_senders_waiting.fetch_sub(1, std::memory_order_relaxed);
+                    push_to(to_resume, *sender);
+                }
+            }
+
+            details::async_waiter::resume_all(to_resume.front());
+        }
+
+        bool closed() const noexcept {
+            return m_closed.load(std::memory_order_relaxed);
+        }
+
+        bool bounded() const noexcept {
+            return m_bounded;
+        }
+
+        // the capacity of a bounded channel, or the size of the ring buffer of an unbounded channel
+        size_t capacity() const noexcept {
+            return m_ring.capacity();
+        }
+    };
+}  // namespace concurrencpp
+
+#endif
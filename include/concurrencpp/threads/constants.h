@@ -1,7 +1,13 @@
 #ifndef CONCURRENCPP_THREAD_CONSTS_H
 #define CONCURRENCPP_THREAD_CONSTS_H
 
+#include <cstddef>
+
 namespace concurrencpp::details::consts {
+    constexpr static size_t k_default_wait_spin_limit = 1024;
+    constexpr static size_t k_min_wait_spin_budget = 16;
+    constexpr static size_t k_default_unbounded_channel_ring_capacity = 1024;
+
     inline const char* k_async_lock_null_resume_executor_err_msg = "concurrencpp::async_lock::lock() - given resume executor is null.";
     inline const char* k_async_lock_unlock_invalid_lock_err_msg = "concurrencpp::async_lock::unlock() - trying to unlock an unowned lock.";
 
@@ -26,6 +32,62 @@ namespace concurrencpp::details::consts {
     inline const char* k_async_condition_variable_await_lock_unlocked_err_msg =
         "concurrencpp::async_condition_variable::await() - lock is unlocked.";
 
+    inline const char* k_async_condition_variable_notify_satisfied_lock_unlocked_err_msg =
+        "concurrencpp::async_condition_variable::notify_satisfied() - lock is unlocked.";
+
+    inline const char* k_async_condition_variable_notify_satisfied_foreign_lock_err_msg =
+        "concurrencpp::async_condition_variable::notify_satisfied() - lock doesn't own the async_lock the tasks wait with.";
+
+    inline const char* k_async_shared_mutex_lock_null_resume_executor_err_msg =
+        "concurrencpp::async_shared_mutex::lock() - given resume executor is null.";
+
+    inline const char* k_async_shared_mutex_lock_shared_null_resume_executor_err_msg =
+        "concurrencpp::async_shared_mutex::lock_shared() - given resume executor is null.";
+
+    inline const char* k_async_shared_mutex_unlock_invalid_lock_err_msg =
+        "concurrencpp::async_shared_mutex::unlock() - trying to unlock an unowned mutex.";
+
+    inline const char* k_async_shared_mutex_unlock_shared_invalid_lock_err_msg =
+        "concurrencpp::async_shared_mutex::unlock_shared() - trying to unlock an unowned mutex.";
+
+    inline const char* k_scoped_async_unique_lock_unlock_invalid_lock_err_msg =
+        "concurrencpp::scoped_async_unique_lock::unlock() - trying to unlock an unowned mutex.";
+
+    inline const char* k_scoped_async_shared_lock_unlock_invalid_lock_err_msg =
+        "concurrencpp::scoped_async_shared_lock::unlock() - trying to unlock an unowned mutex.";
+
+    inline const char* k_async_semaphore_acquire_null_resume_executor_err_msg =
+        "concurrencpp::async_semaphore::acquire() - given resume executor is null.";
+
+    inline const char* k_async_semaphore_acquire_invalid_count_err_msg = "concurrencpp::async_semaphore::acquire() - count is 0.";
+
+    inline const char* k_async_latch_count_down_invalid_update_err_msg =
+        "concurrencpp::async_latch::count_down() - update is greater than the internal counter.";
+
+    inline const char* k_async_latch_wait_null_resume_executor_err_msg = "concurrencpp::async_latch::wait() - given resume executor is null.";
+
+    inline const char* k_async_latch_arrive_and_wait_null_resume_executor_err_msg =
+        "concurrencpp::async_latch::arrive_and_wait() - given resume executor is null.";
+
+    inline const char* k_async_barrier_invalid_expected_err_msg = "concurrencpp::async_barrier::async_barrier() - expected is 0.";
+
+    inline const char* k_async_barrier_arrive_and_wait_null_resume_executor_err_msg =
+        "concurrencpp::async_barrier::arrive_and_wait() - given resume executor is null.";
+
+    inline const char* k_channel_invalid_capacity_err_msg = "concurrencpp::channel::channel() - capacity is 0.";
+
+    inline const char* k_channel_send_null_resume_executor_err_msg = "concurrencpp::channel::send() - given resume executor is null.";
+
+    inline const char* k_channel_receive_null_resume_executor_err_msg = "concurrencpp::channel::receive() - given resume executor is null.";
+
+    inline const char* k_channel_send_batch_null_resume_executor_err_msg =
+        "concurrencpp::channel::send_batch() - given resume executor is null.";
+
+    inline const char* k_channel_receive_batch_null_resume_executor_err_msg =
+        "concurrencpp::channel::receive_batch() - given resume executor is null.";
+
+    inline const char* k_channel_receive_batch_invalid_count_err_msg = "concurrencpp::channel::receive_batch() - max_count is 0.";
+
 }  // namespace concurrencpp::details::consts
 
 #endif
\ No newline at end of file
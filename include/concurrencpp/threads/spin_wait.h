@@ -0,0 +1,56 @@
+#ifndef CONCURRENCPP_SPIN_WAIT_H
+#define CONCURRENCPP_SPIN_WAIT_H
+
+#include "concurrencpp/platform_defs.h"
+
+#include <cstddef>
+
+namespace concurrencpp::details {
+    /*
+        Polls a condition for a short while before the caller falls back to blocking.
+        The number of polls adapts per thread: a spin that succeeds after k polls raises the budget to at least 2k,
+        a spin that fails halves it, so threads that keep waiting for slow results quickly stop burning cpu.
+        The budget never exceeds the process wide limit set by concurrencpp::set_wait_spin_limit.
+    */
+    class CRCPP_API spin_wait {
+
+       private:
+        static size_t begin_spin() noexcept;
+        static void end_spin(size_t polls, bool succeeded) noexcept;
+
+       public:
+        static void cpu_relax() noexcept;
+
+        template<class predicate_type>
+        static bool spin_until(predicate_type&& predicate) noexcept {
+            const auto budget = begin_spin();
+
+            for (size_t i = 0; i < budget; i++) {
+                if (predicate()) {
+                    end_spin(i, true);
+                    return true;
+                }
+
+                cpu_relax();
+            }
+
+            if (budget != 0) {
+                end_spin(budget, false);
+            }
+
+            return false;
+        }
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Sets the maximum number of times a thread polls an unready result before blocking
+        inside result::wait, result::get, shared_result::wait and shared_result::get. 0 disables spinning.
+    */
+    CRCPP_API void set_wait_spin_limit(size_t spin_limit) noexcept;
+
+    CRCPP_API size_t wait_spin_limit() noexcept;
+}  // namespace concurrencpp
+
+#endif
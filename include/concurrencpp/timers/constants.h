@@ -3,15 +3,19 @@
 
 namespace concurrencpp::details::consts {
     inline const char* k_timer_empty_get_due_time_err_msg = "concurrencpp::timer::get_due_time() - timer is empty.";
+    inline const char* k_timer_empty_get_slack_err_msg = "concurrencpp::timer::get_slack() - timer is empty.";
     inline const char* k_timer_empty_get_frequency_err_msg = "concurrencpp::timer::get_frequency() - timer is empty.";
     inline const char* k_timer_empty_get_executor_err_msg = "concurrencpp::timer::get_executor() - timer is empty.";
     inline const char* k_timer_empty_get_timer_queue_err_msg = "concurrencpp::timer::get_timer_queue() - timer is empty.";
     inline const char* k_timer_empty_set_frequency_err_msg = "concurrencpp::timer::set_frequency() - timer is empty.";
+    inline const char* k_timer_empty_get_missed_ticks_err_msg = "concurrencpp::timer::get_missed_ticks() - timer is empty.";
 
     inline const char* k_timer_queue_make_timer_executor_null_err_msg = "concurrencpp::timer_queue::make_timer() - executor is null.";
     inline const char* k_timer_queue_make_oneshot_timer_executor_null_err_msg =
         "concurrencpp::timer_queue::make_one_shot_timer() - executor is null.";
     inline const char* k_timer_queue_make_delay_object_executor_null_err_msg = "concurrencpp::timer_queue::make_delay_object() - executor is null.";
+    inline const char* k_timer_queue_sleep_for_executor_null_err_msg = "concurrencpp::timer_queue::sleep_for() - executor is null.";
+    inline const char* k_timer_queue_sleep_until_executor_null_err_msg = "concurrencpp::timer_queue::sleep_until() - executor is null.";
     inline const char* k_timer_queue_shutdown_err_msg = "concurrencpp::timer_queue has been shut down.";
 }  // namespace concurrencpp::details::consts
 
@@ -0,0 +1,112 @@
+#ifndef CONCURRENCPP_LOCAL_TIMER_SHARD_H
+#define CONCURRENCPP_LOCAL_TIMER_SHARD_H
+
+#include "concurrencpp/timers/timer_queue.h"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <functional>
+
+namespace concurrencpp::details {
+    class local_timer_shard;
+    class timer_queue_internal;
+
+    /*
+        Connects a timer_queue that keeps worker local timers to the shards that hold its timers.
+        When the timer_queue shuts down, every shard is notified and interrupts the timers of the queue on its own worker.
+        When a shard is released while the timer_queue is alive, its timers are handed to the timer_queue thread.
+    */
+    class CRCPP_API local_timer_registry {
+
+       private:
+        std::mutex m_lock;
+        std::vector<local_timer_shard*> m_shards;
+        timer_queue* m_queue;
+        bool m_abort;
+
+       public:
+        explicit local_timer_registry(timer_queue& queue) noexcept;
+
+        void attach(local_timer_shard& shard);
+        void detach(local_timer_shard& shard) noexcept;
+
+        // timers that can't be handed to the timer_queue thread are interrupted.
+        void give_back(timer_queue::request_queue& timers) noexcept;
+
+        void shutdown() noexcept;
+        bool shutdown_requested() noexcept;
+    };
+
+    /*
+        The timers a thread_pool worker registered in timer_queues that keep worker local timers, one container per queue.
+        Only the owning worker adds and processes timers, so adding a timer doesn't lock anything. The worker processes
+        the shard between its tasks and sleeps until the closest deadline when it has no tasks, so the timers expire on
+        the worker that created them. Timers are cancelled lock free, like the timers of the timer_queue thread.
+    */
+    class CRCPP_API local_timer_shard {
+
+       public:
+        using clock_type = timer_queue::clock_type;
+        using time_point = timer_queue::time_point;
+
+       private:
+        struct entry {
+            std::shared_ptr<local_timer_registry> registry;
+            std::unique_ptr<timer_queue_internal> timers;
+            timer_queue::request_queue requests;  // timers that were added while the shard was processed.
+        };
+
+        std::vector<std::unique_ptr<entry>> m_entries;
+        timer_queue::request_queue m_requests;
+        time_point m_next_deadline;  // time_point::max() if the shard holds no timers.
+        bool m_processing;
+        std::atomic_bool m_shutdown_notified;
+        const std::function<void()> m_wake_owner;
+
+        entry& entry_of(const std::shared_ptr<local_timer_registry>& registry, timer_queue_backend backend);
+        void release_aborted_entries();
+
+       public:
+        explicit local_timer_shard(std::function<void()> wake_owner);
+        ~local_timer_shard() noexcept;
+
+        local_timer_shard(const local_timer_shard&) = delete;
+        local_timer_shard& operator=(const local_timer_shard&) = delete;
+
+        // the shard of the calling thread, or null if it isn't a thread_pool worker.
+        static local_timer_shard* current() noexcept;
+        static void set_current(local_timer_shard* shard) noexcept;
+
+        void add(const std::shared_ptr<local_timer_registry>& registry, timer_queue_backend backend, timer_queue::timer_ptr new_timer);
+
+        bool empty() const noexcept {
+            return m_next_deadline == time_point::max();
+        }
+
+        time_point next_deadline() const noexcept {
+            return m_next_deadline;
+        }
+
+        bool has_pending_work() const noexcept {
+            if (m_shutdown_notified.load(std::memory_order_relaxed)) {
+                return true;
+            }
+
+            return !empty() && clock_type::now() >= m_next_deadline;
+        }
+
+        // fires the expired timers and interrupts the timers of the timer_queues that were shut down.
+        void process();
+
+        // hands every timer to the thread of its timer_queue, when the owning worker shuts down.
+        // timers that can't be handed over are interrupted, so no awaiting coroutine is left suspended.
+        void release_all() noexcept;
+
+        // called by a registry whose timer_queue was shut down, from any thread.
+        void notify_shutdown() noexcept;
+    };
+}  // namespace concurrencpp::details
+
+#endif  // CONCURRENCPP_LOCAL_TIMER_SHARD_H
@@ -1,37 +1,195 @@
 #ifndef CONCURRENCPP_TIMER_H
 #define CONCURRENCPP_TIMER_H
 
+#include "concurrencpp/task.h"
 #include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/results/impl/consumer_context.h"
 #include "concurrencpp/platform_defs.h"
 
 #include <atomic>
 #include <memory>
 #include <chrono>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+namespace concurrencpp {
+    /*
+        How a periodic timer schedules its deadlines.
+        fixed_delay - every deadline is one frequency after the timer fired, so the lateness of the ticks adds up.
+        fixed_rate - deadlines are anchored to the first one: the n-th deadline is due_time + n * frequency after the
+        timer was created, however late the previous ticks were.
+    */
+    enum class timer_schedule { fixed_delay, fixed_rate };
+
+    /*
+        What a fixed_rate timer does with the ticks whose deadlines passed before it could fire the previous one.
+        skip - the missed ticks are dropped, the late tick runs once and the timer continues with its next deadline.
+        catch_up - the missed ticks run one after another, in the task of the late tick, so they never overlap.
+        burst - every missed tick is enqueued as a task of its own, together with the late tick.
+    */
+    enum class missed_tick_policy { skip, catch_up, burst };
+
+    struct timer_policy {
+        timer_schedule schedule = timer_schedule::fixed_delay;
+        missed_tick_policy missed_ticks = missed_tick_policy::skip;
+    };
+}  // namespace concurrencpp
 
 namespace concurrencpp::details {
-    class CRCPP_API timer_state_base : public std::enable_shared_from_this<timer_state_base> {
+    // where a timer is stored inside a timing_wheel. read and written only by the thread that owns the wheel.
+    struct timing_wheel_position {
+        constexpr static size_t k_unlinked = std::numeric_limits<size_t>::max();
+
+        size_t bucket = k_unlinked;
+    };
+
+    /*
+        An owning pointer to a timer, whose reference count is kept in the timer itself, so a timer is allocated
+        without a control block and copying a pointer to it is a single atomic increment.
+        A borrowed pointer doesn't own its timer and never touches its reference count. It points to a timer that
+        lives in the frame of an awaiting coroutine, which may be destroyed while the timer_queue still points to it.
+    */
+    template<class type>
+    class timer_state_ptr {
+
+        template<class other_type>
+        friend class timer_state_ptr;
+
+       private:
+        type* m_timer = nullptr;
+        bool m_borrowed = false;
+
+        timer_state_ptr(type* timer, bool borrowed) noexcept : m_timer(timer), m_borrowed(borrowed) {}
+
+        void release() noexcept {
+            if (m_timer != nullptr && !m_borrowed) {
+                m_timer->release_ref();
+            }
+        }
 
        public:
-        using clock_type = std::chrono::high_resolution_clock;
+        timer_state_ptr() noexcept = default;
+
+        explicit timer_state_ptr(type* timer) noexcept : m_timer(timer) {
+            if (m_timer != nullptr) {
+                m_timer->add_ref();
+            }
+        }
+
+        timer_state_ptr(const timer_state_ptr& rhs) noexcept : timer_state_ptr(rhs.m_timer, rhs.m_borrowed) {
+            if (m_timer != nullptr && !m_borrowed) {
+                m_timer->add_ref();
+            }
+        }
+
+        timer_state_ptr(timer_state_ptr&& rhs) noexcept :
+            m_timer(std::exchange(rhs.m_timer, nullptr)), m_borrowed(std::exchange(rhs.m_borrowed, false)) {}
+
+        template<class other_type, class = std::enable_if_t<std::is_convertible_v<other_type*, type*>>>
+        timer_state_ptr(const timer_state_ptr<other_type>& rhs) noexcept : timer_state_ptr(rhs.m_timer, rhs.m_borrowed) {
+            if (m_timer != nullptr && !m_borrowed) {
+                m_timer->add_ref();
+            }
+        }
+
+        template<class other_type, class = std::enable_if_t<std::is_convertible_v<other_type*, type*>>>
+        timer_state_ptr(timer_state_ptr<other_type>&& rhs) noexcept :
+            m_timer(std::exchange(rhs.m_timer, nullptr)), m_borrowed(std::exchange(rhs.m_borrowed, false)) {}
+
+        ~timer_state_ptr() noexcept {
+            release();
+        }
+
+        timer_state_ptr& operator=(timer_state_ptr rhs) noexcept {
+            std::swap(m_timer, rhs.m_timer);
+            std::swap(m_borrowed, rhs.m_borrowed);
+            return *this;
+        }
+
+        static timer_state_ptr borrow(type& timer) noexcept {
+            return {&timer, true};
+        }
+
+        void reset() noexcept {
+            release();
+            m_timer = nullptr;
+            m_borrowed = false;
+        }
+
+        type* get() const noexcept {
+            return m_timer;
+        }
+
+        type* operator->() const noexcept {
+            return m_timer;
+        }
+
+        type& operator*() const noexcept {
+            return *m_timer;
+        }
+
+        explicit operator bool() const noexcept {
+            return m_timer != nullptr;
+        }
+
+        friend bool operator==(const timer_state_ptr& lhs, const timer_state_ptr& rhs) noexcept {
+            return lhs.m_timer == rhs.m_timer;
+        }
+    };
+
+    template<class timer_type, class... argument_types>
+    timer_state_ptr<timer_type> make_timer_state(argument_types&&... arguments) {
+        return timer_state_ptr<timer_type>(new timer_type(std::forward<argument_types>(arguments)...));
+    }
+
+    class CRCPP_API timer_state_base {
+
+        template<class type>
+        friend class timer_state_ptr;
+
+       public:
+        using clock_type = std::chrono::steady_clock;
         using time_point = std::chrono::time_point<clock_type>;
+        using duration = std::chrono::nanoseconds;
         using milliseconds = std::chrono::milliseconds;
 
        private:
+        std::atomic_size_t m_ref_count;
         const std::weak_ptr<timer_queue> m_timer_queue;
         const std::shared_ptr<executor> m_executor;
-        const size_t m_due_time;
-        std::atomic_size_t m_frequency;
-        time_point m_deadline;  // set by the c.tor, changed only by the timer_queue thread.
+        const duration m_due_time;
+        const duration m_slack;
+        std::atomic<duration::rep> m_frequency;
+        time_point m_anchor;    // the deadline before coalescing. set by the c.tor, changed only by the thread that fires the timer.
+        time_point m_deadline;  // set by the c.tor, changed only by the thread that fires the timer.
         std::atomic_bool m_cancelled;
+        std::atomic_size_t m_missed_ticks;
         const bool m_is_oneshot;
+        timer_policy m_policy;  // set by the timer_queue before the timer is published.
+        timing_wheel_position m_wheel_position;
+
+        size_t rearm(time_point now, duration frequency) noexcept;
 
-        static time_point make_deadline(milliseconds diff) noexcept {
-            return clock_type::now() + diff;
+        void add_ref() noexcept {
+            m_ref_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void release_ref() noexcept {
+            if (m_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
         }
 
        public:
-        timer_state_base(size_t due_time,
-                         size_t frequency,
+        // the most missed ticks a catch_up or burst timer runs when it fires late, the ones beyond it are skipped.
+        constexpr static size_t k_max_delivered_ticks = 1'024;
+
+        timer_state_base(duration due_time,
+                         duration frequency,
+                         duration slack,
                          std::shared_ptr<concurrencpp::executor> executor,
                          std::weak_ptr<concurrencpp::timer_queue> timer_queue,
                          bool is_oneshot) noexcept;
@@ -40,7 +198,20 @@ namespace concurrencpp::details {
 
         virtual void execute() = 0;
 
-        void fire();
+        // re-arms a periodic timer and appends the tasks that execute it, usually one. the caller enqueues them
+        // to the timer executor. now is the time the timer_queue thread processes its expired timers at.
+        virtual void fire(time_point now, std::vector<concurrencpp::task>& tasks);
+
+        // called for every timer a timer_queue drops without firing it when it shuts down. timers that are owned by
+        // the timer_queue are interrupted by their destructor instead.
+        virtual void interrupt() noexcept {}
+
+        /*
+            Returns the point in [deadline, deadline + slack] with the coarsest millisecond alignment,
+            so timers whose windows overlap tend to share the same deadline and are fired together.
+            Windows that don't contain a whole millisecond are aligned to nanoseconds instead.
+        */
+        static time_point coalesce_deadline(time_point deadline, duration slack) noexcept;
 
         bool expired(const time_point now) const noexcept {
             return m_deadline <= now;
@@ -50,19 +221,23 @@ namespace concurrencpp::details {
             return m_deadline;
         }
 
-        size_t get_frequency() const noexcept {
-            return m_frequency.load(std::memory_order_relaxed);
+        duration get_frequency() const noexcept {
+            return duration(m_frequency.load(std::memory_order_relaxed));
         }
 
-        size_t get_due_time() const noexcept {
+        duration get_due_time() const noexcept {
             return m_due_time;  // no need to synchronize, const anyway.
         }
 
+        duration get_slack() const noexcept {
+            return m_slack;
+        }
+
         bool is_oneshot() const noexcept {
             return m_is_oneshot;
         }
 
-        std::shared_ptr<executor> get_executor() const noexcept {
+        const std::shared_ptr<executor>& get_executor() const noexcept {
             return m_executor;
         }
 
@@ -70,10 +245,11 @@ namespace concurrencpp::details {
             return m_timer_queue;
         }
 
-        void set_new_frequency(size_t new_frequency) noexcept {
-            m_frequency.store(new_frequency, std::memory_order_relaxed);
+        void set_new_frequency(duration new_frequency) noexcept {
+            m_frequency.store(new_frequency.count(), std::memory_order_relaxed);
         }
 
+        // lock free. the timer_queue thread drops a cancelled timer when it expires or when cancelled timers are swept.
         void cancel() noexcept {
             m_cancelled.store(true, std::memory_order_relaxed);
         }
@@ -81,6 +257,18 @@ namespace concurrencpp::details {
         bool cancelled() const noexcept {
             return m_cancelled.load(std::memory_order_relaxed);
         }
+
+        size_t get_missed_ticks() const noexcept {
+            return m_missed_ticks.load(std::memory_order_relaxed);
+        }
+
+        void set_policy(timer_policy policy) noexcept {
+            m_policy = policy;
+        }
+
+        timing_wheel_position& wheel_position() noexcept {
+            return m_wheel_position;
+        }
     };
 
     template<class callable_type>
@@ -91,13 +279,14 @@ namespace concurrencpp::details {
 
        public:
         template<class given_callable_type>
-        timer_state(size_t due_time,
-                    size_t frequency,
+        timer_state(duration due_time,
+                    duration frequency,
+                    duration slack,
                     std::shared_ptr<concurrencpp::executor> executor,
                     std::weak_ptr<concurrencpp::timer_queue> timer_queue,
                     bool is_oneshot,
                     given_callable_type&& callable) :
-            timer_state_base(due_time, frequency, std::move(executor), std::move(timer_queue), is_oneshot),
+            timer_state_base(due_time, frequency, slack, std::move(executor), std::move(timer_queue), is_oneshot),
             m_callable(std::forward<given_callable_type>(callable)) {}
 
         void execute() override {
@@ -108,13 +297,67 @@ namespace concurrencpp::details {
             m_callable();
         }
     };
+
+    /*
+        The timer of a sleep_for / sleep_until awaitable. It is embedded in the awaitable, which lives in the frame of the
+        awaiting coroutine, so the timer_queue references it through a borrowed timer_state_ptr and it is never allocated.
+        Firing it hands the coroutine itself to the executor, the timer is not referenced after that.
+    */
+    class CRCPP_API sleep_timer_state final : public timer_state_base {
+
+       private:
+        const coroutine_handle<void> m_coro_handle;
+        bool* const m_interrupted;
+
+       public:
+        sleep_timer_state(duration due_time,
+                          duration slack,
+                          std::shared_ptr<concurrencpp::executor> executor,
+                          coroutine_handle<void> coro_handle,
+                          bool* interrupted) noexcept;
+
+        void execute() override;
+        void fire(time_point now, std::vector<concurrencpp::task>& tasks) override;
+        void interrupt() noexcept override;
+    };
+
+    /*
+        The timer of a with_timeout / with_deadline awaitable. The awaiting coroutine races its result against this timer
+        through m_context, whichever completes the context first resumes the coroutine. The timer is shared by the
+        awaitable and the timer_queue, so a timer that fires after the result won doesn't outlive its context.
+    */
+    class CRCPP_API timeout_timer_state final : public timer_state_base {
+
+       private:
+        when_any_context m_context;
+        bool m_interrupted = false;
+
+       public:
+        timeout_timer_state(duration due_time,
+                            duration slack,
+                            std::shared_ptr<concurrencpp::executor> executor,
+                            coroutine_handle<void> coro_handle) noexcept;
+
+        when_any_context& context() noexcept {
+            return m_context;
+        }
+
+        // valid only after the context timed out.
+        bool interrupted() const noexcept {
+            return m_interrupted;
+        }
+
+        void execute() override;
+        void fire(time_point now, std::vector<concurrencpp::task>& tasks) override;
+        void interrupt() noexcept override;
+    };
 }  // namespace concurrencpp::details
 
 namespace concurrencpp {
     class CRCPP_API timer {
 
        private:
-        std::shared_ptr<details::timer_state_base> m_state;
+        details::timer_state_ptr<details::timer_state_base> m_state;
 
         void throw_if_empty(const char* error_message) const;
 
@@ -122,7 +365,7 @@ namespace concurrencpp {
         timer() noexcept = default;
         ~timer() noexcept;
 
-        timer(std::shared_ptr<details::timer_state_base> timer_impl) noexcept;
+        timer(details::timer_state_ptr<details::timer_state_base> timer_impl) noexcept;
 
         timer(timer&& rhs) noexcept = default;
         timer& operator=(timer&& rhs) noexcept;
@@ -132,12 +375,15 @@ namespace concurrencpp {
 
         void cancel();
 
-        std::chrono::milliseconds get_due_time() const;
+        std::chrono::nanoseconds get_due_time() const;
+        std::chrono::nanoseconds get_slack() const;
         std::shared_ptr<executor> get_executor() const;
         std::weak_ptr<timer_queue> get_timer_queue() const;
 
-        std::chrono::milliseconds get_frequency() const;
-        void set_frequency(std::chrono::milliseconds new_frequency);
+        std::chrono::nanoseconds get_frequency() const;
+        void set_frequency(std::chrono::nanoseconds new_frequency);
+
+        size_t get_missed_ticks() const;
 
         explicit operator bool() const noexcept {
             return static_cast<bool>(m_state);
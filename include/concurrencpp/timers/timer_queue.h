@@ -9,27 +9,73 @@
 #include "concurrencpp/results/lazy_result.h"
 
 #include <mutex>
+#include <algorithm>
 #include <memory>
 #include <chrono>
 #include <vector>
+#include <optional>
+#include <functional>
 #include <condition_variable>
 
 #include <cassert>
 
 namespace concurrencpp::details {
-    enum class timer_request { add, remove };
+    class local_timer_registry;
+    class timeout_awaitable_base;
 }
 
+namespace concurrencpp {
+    /*
+        The container the timer_queue thread keeps its timers in.
+        ordered_set - a balanced tree ordered by deadlines, O(log n) insertion, cancellation and expiry.
+        timing_wheel - a hierarchical timing wheel with a millisecond resolution, O(1) insertion, cancellation and expiry.
+    */
+    enum class timer_queue_backend { ordered_set, timing_wheel };
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    /*
+        Returned by timer_queue::sleep_for and timer_queue::sleep_until. The timer is embedded in the awaitable,
+        so awaiting it doesn't allocate. It should be awaited right away and only once.
+    */
+    class CRCPP_API sleep_awaitable : public suspend_always {
+
+       private:
+        timer_queue& m_parent_queue;
+        const timer_state_base::duration m_due_time;
+        const timer_state_base::duration m_slack;
+        std::shared_ptr<concurrencpp::executor> m_executor;
+        std::optional<sleep_timer_state> m_timer;
+        bool m_interrupted = false;
+
+       public:
+        sleep_awaitable(timer_queue& parent_queue,
+                        timer_state_base::duration due_time,
+                        timer_state_base::duration slack,
+                        std::shared_ptr<concurrencpp::executor> executor) noexcept;
+
+        sleep_awaitable(const sleep_awaitable&) = delete;
+        sleep_awaitable& operator=(const sleep_awaitable&) = delete;
+
+        bool await_suspend(coroutine_handle<void> coro_handle) noexcept;
+        void await_resume() const;
+    };
+}  // namespace concurrencpp::details
+
 namespace concurrencpp {
     class CRCPP_API timer_queue : public std::enable_shared_from_this<timer_queue> {
 
        public:
-        using timer_ptr = std::shared_ptr<details::timer_state_base>;
-        using clock_type = std::chrono::high_resolution_clock;
-        using time_point = std::chrono::time_point<std::chrono::high_resolution_clock>;
-        using request_queue = std::vector<std::pair<timer_ptr, details::timer_request>>;
+        using timer_ptr = details::timer_state_ptr<details::timer_state_base>;
+        using clock_type = std::chrono::steady_clock;
+        using time_point = std::chrono::time_point<std::chrono::steady_clock>;
+        using duration = std::chrono::nanoseconds;
+        using request_queue = std::vector<timer_ptr>;
 
         friend class concurrencpp::timer;
+        friend class details::sleep_awaitable;
+        friend class details::timeout_awaitable_base;
+        friend class details::local_timer_registry;
 
        private:
         std::atomic_bool m_atomic_abort;
@@ -40,58 +86,66 @@ namespace concurrencpp {
         bool m_abort;
         bool m_idle;
         const std::chrono::milliseconds m_max_waiting_time;
+        const timer_queue_backend m_backend;
+        const std::chrono::milliseconds m_coalescing_window;
+        const std::chrono::microseconds m_spin_window;
+        const std::shared_ptr<details::local_timer_registry> m_local_timers;
         const std::function<void(std::string_view thread_name)> m_thread_started_callback;
         const std::function<void(std::string_view thread_name)> m_thread_terminated_callback;
 
         details::thread ensure_worker_thread(std::unique_lock<std::mutex>& lock);
+        void wait_for_deadline(std::unique_lock<std::mutex>& lock, time_point deadline);
+        void work_loop();
 
-        void add_internal_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer);
-        void remove_internal_timer(timer_ptr existing_timer);
-
-        void add_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer);
+        void add_timer(timer_ptr new_timer);
+        void add_central_timer(timer_ptr new_timer);
 
-        lazy_result<void> make_delay_object_impl(std::chrono::milliseconds due_time,
+        lazy_result<void> make_delay_object_impl(duration due_time,
+                                                 duration slack,
                                                  std::shared_ptr<concurrencpp::timer_queue> self,
                                                  std::shared_ptr<concurrencpp::executor> executor);
 
         template<class callable_type>
-        timer_ptr make_timer_impl(size_t due_time,
-                                  size_t frequency,
+        timer_ptr make_timer_impl(duration due_time,
+                                  duration frequency,
+                                  duration slack,
                                   std::shared_ptr<concurrencpp::executor> executor,
                                   bool is_oneshot,
+                                  timer_policy policy,
                                   callable_type&& callable) {
             assert(static_cast<bool>(executor));
 
             using decayed_type = typename std::decay_t<callable_type>;
 
-            auto timer_state = std::make_shared<details::timer_state<decayed_type>>(due_time,
-                                                                                    frequency,
-                                                                                    std::move(executor),
-                                                                                    weak_from_this(),
-                                                                                    is_oneshot,
-                                                                                    std::forward<callable_type>(callable));
-            {
-                std::unique_lock<std::mutex> lock(m_lock);
-                add_timer(lock, timer_state);
-            }
-
+            const auto coalescing_window = duration(m_coalescing_window);
+            auto timer_state = details::make_timer_state<details::timer_state<decayed_type>>(due_time,
+                                                                                              frequency,
+                                                                                              std::max(slack, coalescing_window),
+                                                                                              std::move(executor),
+                                                                                              weak_from_this(),
+                                                                                              is_oneshot,
+                                                                                              std::forward<callable_type>(callable));
+            timer_state->set_policy(policy);
+            add_timer(timer_state);
             return timer_state;
         }
 
-        void work_loop();
-
        public:
         timer_queue(std::chrono::milliseconds max_waiting_time,
                     const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
-                    const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
+                    const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {},
+                    timer_queue_backend backend = timer_queue_backend::ordered_set,
+                    std::chrono::milliseconds coalescing_window = std::chrono::milliseconds(0),
+                    bool worker_local_timers = false,
+                    std::chrono::microseconds spin_window = std::chrono::microseconds(0));
         ~timer_queue() noexcept;
 
         void shutdown();
         bool shutdown_requested() const noexcept;
 
         template<class callable_type, class... argumet_types>
-        timer make_timer(std::chrono::milliseconds due_time,
-                         std::chrono::milliseconds frequency,
+        timer make_timer(duration due_time,
+                         duration frequency,
                          std::shared_ptr<concurrencpp::executor> executor,
                          callable_type&& callable,
                          argumet_types&&... arguments) {
@@ -99,15 +153,78 @@ namespace concurrencpp {
                 throw std::invalid_argument(details::consts::k_timer_queue_make_timer_executor_null_err_msg);
             }
 
-            return make_timer_impl(due_time.count(),
-                                   frequency.count(),
+            return make_timer_impl(due_time,
+                                   frequency,
+                                   duration(0),
                                    std::move(executor),
                                    false,
+                                   timer_policy {},
                                    details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
         }
 
         template<class callable_type, class... argumet_types>
-        timer make_one_shot_timer(std::chrono::milliseconds due_time,
+        timer make_timer(duration due_time,
+                         duration frequency,
+                         duration slack,
+                         std::shared_ptr<concurrencpp::executor> executor,
+                         callable_type&& callable,
+                         argumet_types&&... arguments) {
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_timer_executor_null_err_msg);
+            }
+
+            return make_timer_impl(due_time,
+                                   frequency,
+                                   slack,
+                                   std::move(executor),
+                                   false,
+                                   timer_policy {},
+                                   details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
+        }
+
+        template<class callable_type, class... argumet_types>
+        timer make_timer(duration due_time,
+                         duration frequency,
+                         timer_policy policy,
+                         std::shared_ptr<concurrencpp::executor> executor,
+                         callable_type&& callable,
+                         argumet_types&&... arguments) {
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_timer_executor_null_err_msg);
+            }
+
+            return make_timer_impl(due_time,
+                                   frequency,
+                                   duration(0),
+                                   std::move(executor),
+                                   false,
+                                   policy,
+                                   details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
+        }
+
+        template<class callable_type, class... argumet_types>
+        timer make_timer(duration due_time,
+                         duration frequency,
+                         duration slack,
+                         timer_policy policy,
+                         std::shared_ptr<concurrencpp::executor> executor,
+                         callable_type&& callable,
+                         argumet_types&&... arguments) {
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_timer_executor_null_err_msg);
+            }
+
+            return make_timer_impl(due_time,
+                                   frequency,
+                                   slack,
+                                   std::move(executor),
+                                   false,
+                                   policy,
+                                   details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
+        }
+
+        template<class callable_type, class... argumet_types>
+        timer make_one_shot_timer(duration due_time,
                                   std::shared_ptr<concurrencpp::executor> executor,
                                   callable_type&& callable,
                                   argumet_types&&... arguments) {
@@ -115,16 +232,51 @@ namespace concurrencpp {
                 throw std::invalid_argument(details::consts::k_timer_queue_make_oneshot_timer_executor_null_err_msg);
             }
 
-            return make_timer_impl(due_time.count(),
-                                   0,
+            return make_timer_impl(due_time,
+                                   duration(0),
+                                   duration(0),
                                    std::move(executor),
                                    true,
+                                   timer_policy {},
                                    details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
         }
 
-        lazy_result<void> make_delay_object(std::chrono::milliseconds due_time, std::shared_ptr<concurrencpp::executor> executor);
+        template<class callable_type, class... argumet_types>
+        timer make_one_shot_timer(duration due_time,
+                                  duration slack,
+                                  std::shared_ptr<concurrencpp::executor> executor,
+                                  callable_type&& callable,
+                                  argumet_types&&... arguments) {
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_oneshot_timer_executor_null_err_msg);
+            }
+
+            return make_timer_impl(due_time,
+                                   duration(0),
+                                   slack,
+                                   std::move(executor),
+                                   true,
+                                   timer_policy {},
+                                   details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
+        }
+
+        lazy_result<void> make_delay_object(duration due_time, std::shared_ptr<concurrencpp::executor> executor);
+        lazy_result<void> make_delay_object(duration due_time,
+                                            duration slack,
+                                            std::shared_ptr<concurrencpp::executor> executor);
+
+        details::sleep_awaitable sleep_for(duration due_time, std::shared_ptr<concurrencpp::executor> executor);
+        details::sleep_awaitable sleep_for(duration due_time, duration slack, std::shared_ptr<concurrencpp::executor> executor);
+        details::sleep_awaitable sleep_until(time_point deadline, std::shared_ptr<concurrencpp::executor> executor);
+        details::sleep_awaitable sleep_until(time_point deadline,
+                                             duration slack,
+                                             std::shared_ptr<concurrencpp::executor> executor);
 
         std::chrono::milliseconds max_worker_idle_time() const noexcept;
+        timer_queue_backend backend() const noexcept;
+        std::chrono::milliseconds coalescing_window() const noexcept;
+        bool worker_local_timers() const noexcept;
+        std::chrono::microseconds spin_window() const noexcept;
     };
 }  // namespace concurrencpp
 
@@ -0,0 +1,197 @@
+#ifndef CONCURRENCPP_TIMER_QUEUE_INTERNAL_H
+#define CONCURRENCPP_TIMER_QUEUE_INTERNAL_H
+
+#include "concurrencpp/task.h"
+#include "concurrencpp/timers/timer.h"
+#include "concurrencpp/timers/timer_queue.h"
+
+#include <set>
+#include <array>
+#include <memory>
+#include <vector>
+#include <optional>
+
+#include <cstdint>
+
+namespace concurrencpp::details {
+    /*
+        Collects the tasks of the timers that are fired in one wake up of the timer_queue thread,
+        grouped by executor, so every executor receives them in a single bulk enqueue.
+    */
+    class CRCPP_API timer_batch {
+
+       private:
+        struct executor_group {
+            std::shared_ptr<concurrencpp::executor> executor;
+            std::vector<concurrencpp::task> tasks;
+        };
+
+        std::vector<executor_group> m_groups;
+        size_t m_group_count = 0;
+        size_t m_last_group = 0;
+        timer_state_base::time_point m_now;
+
+        executor_group& group_of(const std::shared_ptr<concurrencpp::executor>& executor);
+
+       public:
+        timer_batch() noexcept = default;
+
+        timer_batch(const timer_batch&) = delete;
+        timer_batch& operator=(const timer_batch&) = delete;
+
+        // the time the timers that are added next are fired at.
+        void set_now(timer_state_base::time_point now) noexcept {
+            m_now = now;
+        }
+
+        void add(timer_state_base& timer);
+        void dispatch() noexcept;
+    };
+
+    /*
+        The timer container owned by the timer_queue thread, or by a thread_pool worker that keeps worker local timers.
+        it is never accessed concurrently, so implementations don't synchronize anything.
+        The container lives as long as its owner and keeps its memory when it empties, so timers that are added
+        and expire one after another don't allocate. The memory is released when the owner retires.
+        Cancelling a timer doesn't send a request, a cancelled timer stays in the container until it expires or until
+        the cancelled timers are swept. A sweep runs once as many timers were added since the previous one as the
+        container held after it, and at least k_min_sweep_interval, so it costs O(1) per added timer and the cancelled
+        timers a container holds are bounded by the timers it added recently.
+    */
+    class CRCPP_API timer_queue_internal {
+
+       private:
+        size_t m_added_since_sweep = 0;
+        size_t m_size_after_sweep = 0;
+
+       public:
+        constexpr static size_t k_min_sweep_interval = 1'024;
+
+        using timer_ptr = timer_queue::timer_ptr;
+        using time_point = timer_queue::time_point;
+        using request_queue = timer_queue::request_queue;
+
+        virtual ~timer_queue_internal() noexcept = default;
+
+        virtual bool empty() const noexcept = 0;
+        virtual size_t size() const noexcept = 0;
+
+        virtual void add(timer_ptr new_timer) = 0;
+
+        // fires every timer that expired at or before now and returns the closest deadline of the remaining timers.
+        virtual time_point process_expired(time_point now) = 0;
+
+        // interrupts every timer in the container, when the timer_queue shuts down.
+        virtual void interrupt_all() noexcept = 0;
+
+        // removes every cancelled timer from the container.
+        virtual void remove_cancelled() noexcept = 0;
+
+        // moves every timer out of the container into timers, when its owner hands them to another one.
+        virtual void take_all(request_queue& timers) = 0;
+
+        void add_request(timer_ptr new_timer);
+        void process_requests(request_queue& queue);
+        time_point process_timers(request_queue& queue);
+
+        static std::unique_ptr<timer_queue_internal> make(timer_queue_backend backend);
+
+       protected:
+        timer_batch m_batch;
+    };
+
+    class CRCPP_API ordered_timer_set final : public timer_queue_internal {
+
+       private:
+        struct deadline_comparator {
+            bool operator()(const timer_ptr& a, const timer_ptr& b) const noexcept {
+                return a->get_deadline() < b->get_deadline();
+            }
+        };
+
+        using timer_set = std::multiset<timer_ptr, deadline_comparator>;
+
+        timer_set m_timers;
+
+        // nodes of removed timers, reused by the next timers that are added instead of allocating new ones.
+        std::vector<timer_set::node_type> m_free_timer_nodes;
+
+        void recycle(timer_set::node_type timer_node) noexcept;
+
+       public:
+        bool empty() const noexcept override;
+        size_t size() const noexcept override;
+
+        void add(timer_ptr new_timer) override;
+
+        time_point process_expired(time_point now) override;
+        void interrupt_all() noexcept override;
+        void remove_cancelled() noexcept override;
+        void take_all(request_queue& timers) override;
+    };
+
+    /*
+        A hierarchical timing wheel with a resolution of one millisecond: k_levels levels of k_slots_per_level slots,
+        every level covers k_slots_per_level times the range of the one below it.
+        A timer is placed by the highest byte in which its deadline tick differs from the current tick,
+        so inserting and cancelling are O(1) and every timer is cascaded at most k_levels - 1 times before it expires.
+        Deadlines that are beyond the range of the wheel are kept in an overflow bucket, which is re-distributed when the
+        highest level wraps around.
+    */
+    class CRCPP_API timing_wheel final : public timer_queue_internal {
+
+       public:
+        using tick_type = std::uint64_t;
+
+        constexpr static size_t k_level_bits = 8;
+        constexpr static size_t k_slots_per_level = size_t(1) << k_level_bits;
+        constexpr static size_t k_levels = 4;
+        constexpr static size_t k_wheel_bits = k_level_bits * k_levels;
+
+       private:
+        constexpr static size_t k_overflow_bucket = k_levels * k_slots_per_level;
+        constexpr static size_t k_expired_bucket = k_overflow_bucket + 1;
+        constexpr static size_t k_bucket_count = k_expired_bucket + 1;
+        constexpr static size_t k_words_per_level = k_slots_per_level / 64;
+
+        using bucket_type = std::vector<timer_ptr>;
+        using occupancy_type = std::array<std::uint64_t, k_words_per_level>;
+
+        std::vector<bucket_type> m_buckets;
+        std::array<occupancy_type, k_levels> m_occupied;
+        bucket_type m_firing;
+        time_point m_origin;
+        tick_type m_current_tick;
+        size_t m_size;
+
+        tick_type deadline_tick(time_point deadline) const noexcept;
+        tick_type elapsed_ticks(time_point now) const noexcept;
+        size_t bucket_of(tick_type tick) const noexcept;
+
+        void link(timer_ptr timer, tick_type tick);
+
+        void mark_occupied(size_t bucket) noexcept;
+        void mark_vacant(size_t bucket) noexcept;
+
+        std::optional<tick_type> next_event_tick() const noexcept;
+
+        void cascade(size_t bucket);
+        void fire_bucket(size_t bucket);
+        void advance_to(tick_type tick);
+
+       public:
+        timing_wheel();
+
+        bool empty() const noexcept override;
+        size_t size() const noexcept override;
+
+        void add(timer_ptr new_timer) override;
+
+        time_point process_expired(time_point now) override;
+        void interrupt_all() noexcept override;
+        void remove_cancelled() noexcept override;
+        void take_all(request_queue& timers) override;
+    };
+}  // namespace concurrencpp::details
+
+#endif  // CONCURRENCPP_TIMER_QUEUE_INTERNAL_H
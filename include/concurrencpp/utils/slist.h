@@ -28,11 +28,24 @@ namespace concurrencpp::details {
             rhs.m_tail = nullptr;
         }
 
+        slist& operator=(slist&& rhs) noexcept {
+            m_head = rhs.m_head;
+            m_tail = rhs.m_tail;
+            rhs.m_head = nullptr;
+            rhs.m_tail = nullptr;
+            return *this;
+        }
+
         bool empty() const noexcept {
             assert_state();
             return m_head == nullptr;
         }
 
+        node_type* front() const noexcept {
+            assert_state();
+            return m_head;
+        }
+
         void push_back(node_type& node) noexcept {
             assert_state();
 
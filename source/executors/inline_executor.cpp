@@ -0,0 +1,72 @@
+#include "concurrencpp/executors/inline_executor.h"
+
+#include <deque>
+
+#include <cassert>
+
+using concurrencpp::inline_executor;
+
+namespace concurrencpp::details {
+    namespace {
+        struct inline_trampoline {
+            std::deque<task> deferred_tasks;
+            bool draining = false;
+
+            void drain() {
+                while (!deferred_tasks.empty()) {
+                    auto task = std::move(deferred_tasks.front());
+                    deferred_tasks.pop_front();
+                    task();
+                }
+            }
+        };
+
+        thread_local inline_trampoline s_tl_inline_trampoline;
+
+        class trampoline_guard {
+
+           private:
+            inline_trampoline& m_trampoline;
+
+           public:
+            trampoline_guard(inline_trampoline& trampoline) noexcept : m_trampoline(trampoline) {
+                assert(!trampoline.draining);
+                trampoline.draining = true;
+            }
+
+            ~trampoline_guard() noexcept {
+                // if a task threw, the tasks that are still deferred will be drained by the next outermost enqueue.
+                m_trampoline.draining = false;
+            }
+        };
+    }  // namespace
+}  // namespace concurrencpp::details
+
+void inline_executor::enqueue_trampolined(concurrencpp::task& task) {
+    auto& trampoline = details::s_tl_inline_trampoline;
+    if (trampoline.draining) {
+        trampoline.deferred_tasks.emplace_back(std::move(task));
+        return;
+    }
+
+    details::trampoline_guard guard(trampoline);
+    task();
+    trampoline.drain();
+}
+
+void inline_executor::enqueue_trampolined(std::span<concurrencpp::task> tasks) {
+    auto& trampoline = details::s_tl_inline_trampoline;
+    if (trampoline.draining) {
+        trampoline.deferred_tasks.insert(trampoline.deferred_tasks.end(),
+                                         std::make_move_iterator(tasks.begin()),
+                                         std::make_move_iterator(tasks.end()));
+        return;
+    }
+
+    details::trampoline_guard guard(trampoline);
+    for (auto& task : tasks) {
+        task();
+    }
+
+    trampoline.drain();
+}
@@ -1,10 +1,12 @@
 #include "concurrencpp/executors/thread_pool_executor.h"
+#include "concurrencpp/timers/local_timer_shard.h"
 
 #include <semaphore>
 #include <algorithm>
 
 using concurrencpp::thread_pool_executor;
 using concurrencpp::details::idle_worker_set;
+using concurrencpp::details::local_timer_shard;
 using concurrencpp::details::thread_pool_worker;
 
 namespace concurrencpp::details {
@@ -41,6 +43,7 @@ namespace concurrencpp::details {
         alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::mutex m_lock;
         std::deque<task> m_public_queue;
         std::binary_semaphore m_semaphore;
+        local_timer_shard m_timers;
         bool m_idle;
         bool m_abort;
         std::atomic_bool m_task_found_or_abort;
@@ -177,15 +180,18 @@ thread_pool_worker::thread_pool_worker(thread_pool_executor& parent_pool,
                                        const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
     m_atomic_abort(false),
     m_parent_pool(parent_pool), m_index(index), m_pool_size(pool_size), m_max_idle_time(max_idle_time),
-    m_worker_name(details::make_executor_worker_name(parent_pool.name)), m_semaphore(0), m_idle(true), m_abort(false),
-    m_task_found_or_abort(false), m_thread_started_callback(thread_started_callback),
+    m_worker_name(details::make_executor_worker_name(parent_pool.name)), m_semaphore(0),
+    m_timers([this] {
+        m_semaphore.release();
+    }),
+    m_idle(true), m_abort(false), m_task_found_or_abort(false), m_thread_started_callback(thread_started_callback),
     m_thread_terminated_callback(thread_terminated_callback) {
     m_idle_worker_list.reserve(pool_size);
 }
 
 thread_pool_worker::thread_pool_worker(thread_pool_worker&& rhs) noexcept :
     m_parent_pool(rhs.m_parent_pool), m_index(rhs.m_index), m_pool_size(rhs.m_pool_size), m_max_idle_time(rhs.m_max_idle_time),
-    m_semaphore(0), m_idle(true), m_abort(true) {
+    m_semaphore(0), m_timers({}), m_idle(true), m_abort(true) {
     std::abort();  // shouldn't be called
 }
 
@@ -274,12 +280,19 @@ bool thread_pool_worker::wait_for_task(std::unique_lock<std::mutex>& lock) {
     m_parent_pool.mark_worker_idle(m_index);
 
     auto event_found = false;
-    const auto deadline = std::chrono::steady_clock::now() + m_max_idle_time;
+    const auto idle_deadline = std::chrono::steady_clock::now() + m_max_idle_time;
 
     while (true) {
+        if (m_timers.has_pending_work()) {
+            event_found = true;
+            break;
+        }
+
+        // a worker that holds timers doesn't retire, it sleeps until the closest one expires.
+        const auto deadline = m_timers.empty() ? idle_deadline : m_timers.next_deadline();
         if (!m_semaphore.try_acquire_until(deadline)) {
-            if (std::chrono::steady_clock::now() <= deadline) {
-                continue;  // handle spurious wake-ups
+            if (std::chrono::steady_clock::now() <= deadline || !m_timers.empty()) {
+                continue;  // handle spurious wake-ups and expired timers
             } else {
                 break;
             }
@@ -309,7 +322,6 @@ bool thread_pool_worker::wait_for_task(std::unique_lock<std::mutex>& lock) {
         return false;
     }
 
-    assert(!m_public_queue.empty());
     m_parent_pool.mark_worker_active(m_index);
     return true;
 }
@@ -329,6 +341,10 @@ bool thread_pool_worker::drain_queue_impl() {
         auto task = std::move(m_private_queue.back());
         m_private_queue.pop_back();
         task();
+
+        if (m_timers.has_pending_work()) {
+            m_timers.process();
+        }
     }
 
     if (aborted) {
@@ -347,7 +363,6 @@ bool thread_pool_worker::drain_queue() {
     }
 
     assert(lock.owns_lock());
-    assert(!m_public_queue.empty() || m_abort);
 
     m_task_found_or_abort.store(false, std::memory_order_relaxed);
 
@@ -356,6 +371,10 @@ bool thread_pool_worker::drain_queue() {
         return false;
     }
 
+    if (m_public_queue.empty()) {
+        return true;  // woken up by the timers of this worker.
+    }
+
     assert(m_private_queue.empty());
     std::swap(m_private_queue, m_public_queue);  // reuse underlying allocations.
     lock.unlock();
@@ -366,14 +385,31 @@ bool thread_pool_worker::drain_queue() {
 void thread_pool_worker::work_loop() {
     s_tl_thread_pool_data.this_worker = this;
     s_tl_thread_pool_data.this_thread_index = m_index;
+    local_timer_shard::set_current(&m_timers);
 
     try {
         while (true) {
+            if (m_timers.has_pending_work()) {
+                m_timers.process();
+            }
+
+            // the expired timers might have enqueued their tasks to this worker.
+            if (!m_private_queue.empty()) {
+                if (!drain_queue_impl()) {
+                    return;
+                }
+
+                continue;
+            }
+
             if (!drain_queue()) {
                 return;
             }
         }
     } catch (const errors::runtime_shutdown&) {
+        // a new thread might take over this worker once it's marked idle, so the timers are handed back before.
+        m_timers.release_all();
+
         std::unique_lock<std::mutex> lock(m_lock);
         m_idle = true;
     }
@@ -494,6 +530,9 @@ void thread_pool_worker::shutdown() {
         m_thread.join();
     }
 
+    // the timers this worker still holds are fired by the thread of their timer_queue from now on.
+    m_timers.release_all();
+
     decltype(m_public_queue) public_queue;
     decltype(m_private_queue) private_queue;
 
@@ -3,7 +3,11 @@
 #include "concurrencpp/executors/executor.h"
 #include "concurrencpp/results/impl/shared_result_state.h"
 
+#include <thread>
+
 using concurrencpp::details::when_any_context;
+using concurrencpp::details::when_all_context;
+using concurrencpp::details::when_n_context;
 using concurrencpp::details::consumer_context;
 using concurrencpp::details::await_via_functor;
 using concurrencpp::details::result_state_base;
@@ -56,7 +60,7 @@ void await_via_functor::operator()() noexcept {
  */
 
 /*
- *   k_processing -> k_done_processing -> (completed) result_state_base*
+ *   k_processing -> k_done_processing -> (completed) result_state_base* or k_timed_out
  *     |                                             ^
  *     |                                             |
  *     ----------------------------------------------
@@ -64,8 +68,10 @@ void await_via_functor::operator()() noexcept {
 
 const result_state_base* when_any_context::k_processing = reinterpret_cast<result_state_base*>(-1);
 const result_state_base* when_any_context::k_done_processing = nullptr;
+const result_state_base* when_any_context::k_timed_out = reinterpret_cast<result_state_base*>(-2);
 
-when_any_context::when_any_context(coroutine_handle<void> coro_handle) noexcept : m_status(k_processing), m_coro_handle(coro_handle) {
+when_any_context::when_any_context(coroutine_handle<void> coro_handle) noexcept :
+    m_status(k_processing), m_departed_producers(0), m_coro_handle(coro_handle) {
     assert(static_cast<bool>(coro_handle));
     assert(!coro_handle.done());
 }
@@ -85,39 +91,62 @@ bool when_any_context::finish_processing() noexcept {
     return res;  // if k_processing -> k_done_processing, then no result finished before the CAS, suspend.
 }
 
-void when_any_context::try_resume(result_state_base& completed_result) noexcept {
+concurrencpp::details::coroutine_handle<void> when_any_context::try_resume(result_state_base& completed_result) noexcept {
+    const auto coro_handle = try_complete(&completed_result);
+
+    // this must be the last access to the context, the awaiter may destroy it right after.
+    m_departed_producers.fetch_add(1, std::memory_order_release);
+    return coro_handle;
+}
+
+void when_any_context::wait_for_producers(size_t producer_count) const noexcept {
+    // producers leave try_resume a few instructions after completing their result, this rarely spins.
+    while (m_departed_producers.load(std::memory_order_acquire) != producer_count) {
+        std::this_thread::yield();
+    }
+}
+
+concurrencpp::details::coroutine_handle<void> when_any_context::try_time_out() noexcept {
+    // the timer is not counted by wait_for_producers, it keeps the context alive by itself.
+    return try_complete(k_timed_out);
+}
+
+bool when_any_context::timed_out() const noexcept {
+    return m_status.load(std::memory_order_acquire) == k_timed_out;
+}
+
+concurrencpp::details::coroutine_handle<void> when_any_context::try_complete(const result_state_base* completed_result) noexcept {
     /*
      * tries to turn m_status into the completed_result ptr
      * if m_status == k_processing, we just leave the pointer and bail out, the processor thread will pick
      *  the pointer up and resume from there
      * if m_status == k_done_processing AND we were able to CAS it into the completed result
      *   then we were the first ones to complete, processing is done for all input-results
-     *   and we resume the caller
+     *   and we return the caller so it can be resumed
      */
 
     while (true) {
         auto status = m_status.load(std::memory_order_acquire);
         if (status != k_processing && status != k_done_processing) {
-            return;  // another task finished before us, bail out
+            return {};  // another task finished before us, bail out
         }
 
         if (status == k_done_processing) {
-            const auto swapped = m_status.compare_exchange_strong(status, &completed_result, std::memory_order_acq_rel);
+            const auto swapped = m_status.compare_exchange_strong(status, completed_result, std::memory_order_acq_rel);
 
             if (!swapped) {
-                return;  // another task finished before us, bail out
+                return {};  // another task finished before us, bail out
             }
 
             // k_done_processing -> result_state_base ptr, we are the first to finish and CAS the status
-            m_coro_handle();
-            return;
+            return m_coro_handle;
         }
 
         assert(status == k_processing);
-        const auto res = m_status.compare_exchange_strong(status, &completed_result, std::memory_order_acq_rel);
+        const auto res = m_status.compare_exchange_strong(status, completed_result, std::memory_order_acq_rel);
 
         if (res) {  // k_processing -> completed result_state_base*
-            return;
+            return {};
         }
 
         // either another result raced us, either m_status is now k_done_processing, retry and act accordingly
@@ -143,6 +172,139 @@ const result_state_base* when_any_context::completed_result() const noexcept {
     return m_status.load(std::memory_order_acquire);
 }
 
+/*
+ * when_all_context
+ */
+
+/*
+ *   the countdown starts at result_count + 1. every producer that finishes after the awaiting coroutine
+ *   subscribed to it decrements the countdown by one, the awaiting coroutine decrements it by the number of results
+ *   that were already ready + 1 once it has subscribed to all of them. whoever brings the countdown to zero
+ *   resumes the awaiting coroutine, which happens exactly once.
+ */
+
+when_all_context::when_all_context(size_t result_count) noexcept : m_countdown(result_count + 1) {}
+
+concurrencpp::details::coroutine_handle<void> when_all_context::try_resume() noexcept {
+    const auto countdown_before = m_countdown.fetch_sub(1, std::memory_order_acq_rel);
+    assert(countdown_before != 0);
+
+    if (countdown_before != 1) {
+        return {};
+    }
+
+    assert(static_cast<bool>(m_coro_handle));
+    return m_coro_handle;
+}
+
+bool when_all_context::finish_processing(coroutine_handle<void> coro_handle, size_t ready_results) noexcept {
+    assert(static_cast<bool>(coro_handle));
+    assert(!coro_handle.done());
+
+    // published by the release part of the fetch_sub below, before any producer can bring the countdown to zero.
+    m_coro_handle = coro_handle;
+
+    const auto decrement = ready_results + 1;
+    const auto countdown_before = m_countdown.fetch_sub(decrement, std::memory_order_acq_rel);
+    assert(countdown_before >= decrement);
+
+    return countdown_before != decrement;  // if some results are still pending, suspend.
+}
+
+/*
+ * when_n_context
+ */
+
+/*
+ *   processing -> done_processing -> satisfied
+ *     |                                 ^
+ *     |                                 |
+ *     -----------------------------------
+ *
+ *   the context is satisfied once enough results were counted or once all results finished. every finished result
+ *   is counted exactly once, either by its producer or by the awaiter if it was ready before it could be subscribed.
+ *   whoever observes the satisfied condition moves the status to satisfied. if the awaiter was already done
+ *   processing, the one that did so resumes it.
+ */
+
+when_n_context::when_n_context(coroutine_handle<void> coro_handle,
+                               size_t required_results,
+                               size_t total_results,
+                               result_filter filter) noexcept :
+    m_status(status::processing),
+    m_counted_results(0), m_finished_results(0), m_departed_producers(0), m_required_results(required_results),
+    m_total_results(total_results), m_filter(filter), m_coro_handle(coro_handle) {
+    assert(static_cast<bool>(coro_handle));
+    assert(!coro_handle.done());
+    assert(required_results != 0);
+    assert(required_results <= total_results);
+}
+
+bool when_n_context::count_result(const result_state_base& finished_result) noexcept {
+    const auto counted = (m_filter == nullptr) || m_filter(finished_result);
+    const auto finished_results = m_finished_results.fetch_add(1, std::memory_order_acq_rel) + 1;
+    const auto counted_results =
+        counted ? m_counted_results.fetch_add(1, std::memory_order_acq_rel) + 1 : m_counted_results.load(std::memory_order_acquire);
+
+    return (counted_results >= m_required_results) || (finished_results == m_total_results);
+}
+
+bool when_n_context::satisfied() const noexcept {
+    return m_status.load(std::memory_order_acquire) == status::satisfied;
+}
+
+bool when_n_context::finish_processing() noexcept {
+    auto expected_status = status::processing;
+    return m_status.compare_exchange_strong(expected_status, status::done_processing, std::memory_order_acq_rel);
+}
+
+bool when_n_context::on_ready_result(const result_state_base& ready_result) noexcept {
+    if (!count_result(ready_result)) {
+        return false;
+    }
+
+    // a producer might have observed the satisfied condition before us, either way the awaiter doesn't suspend.
+    auto expected_status = status::processing;
+    m_status.compare_exchange_strong(expected_status, status::satisfied, std::memory_order_acq_rel);
+    return true;
+}
+
+concurrencpp::details::coroutine_handle<void> when_n_context::try_resume(result_state_base& completed_result) noexcept {
+    const auto coro_handle = try_complete(completed_result);
+
+    // this must be the last access to the context, the awaiter may destroy it right after.
+    m_departed_producers.fetch_add(1, std::memory_order_release);
+    return coro_handle;
+}
+
+concurrencpp::details::coroutine_handle<void> when_n_context::try_complete(result_state_base& completed_result) noexcept {
+    if (!count_result(completed_result)) {
+        return {};
+    }
+
+    auto expected_status = status::processing;
+    if (m_status.compare_exchange_strong(expected_status, status::satisfied, std::memory_order_acq_rel)) {
+        return {};  // the awaiter is still processing, it will notice the context is satisfied and won't suspend
+    }
+
+    if (expected_status == status::satisfied) {
+        return {};  // another result satisfied the context before us
+    }
+
+    assert(expected_status == status::done_processing);
+    if (m_status.compare_exchange_strong(expected_status, status::satisfied, std::memory_order_acq_rel)) {
+        return m_coro_handle;
+    }
+
+    return {};
+}
+
+void when_n_context::wait_for_producers(size_t producer_count) const noexcept {
+    while (m_departed_producers.load(std::memory_order_acquire) != producer_count) {
+        std::this_thread::yield();
+    }
+}
+
 /*
  * consumer_context
  */
@@ -169,6 +331,14 @@ void consumer_context::destroy() noexcept {
             return details::destroy(m_storage.when_any_ctx);
         }
 
+        case consumer_status::when_all: {
+            return details::destroy(m_storage.when_all_ctx);
+        }
+
+        case consumer_status::when_n: {
+            return details::destroy(m_storage.when_n_ctx);
+        }
+
         case consumer_status::shared: {
             return details::destroy(m_storage.shared_ctx);
         }
@@ -194,51 +364,81 @@ void consumer_context::set_wait_for_context(const std::shared_ptr<std::binary_se
     details::build(m_storage.wait_for_ctx, wait_ctx);
 }
 
-void consumer_context::set_when_any_context(const std::shared_ptr<when_any_context>& when_any_ctx) noexcept {
+void consumer_context::set_when_any_context(when_any_context* when_any_ctx) noexcept {
     assert(m_status == consumer_status::idle);
+    assert(when_any_ctx != nullptr);
     m_status = consumer_status::when_any;
     details::build(m_storage.when_any_ctx, when_any_ctx);
 }
 
+void consumer_context::set_when_all_context(when_all_context* when_all_ctx) noexcept {
+    assert(m_status == consumer_status::idle);
+    assert(when_all_ctx != nullptr);
+    m_status = consumer_status::when_all;
+    details::build(m_storage.when_all_ctx, when_all_ctx);
+}
+
+void consumer_context::set_when_n_context(when_n_context* when_n_ctx) noexcept {
+    assert(m_status == consumer_status::idle);
+    assert(when_n_ctx != nullptr);
+    m_status = consumer_status::when_n;
+    details::build(m_storage.when_n_ctx, when_n_ctx);
+}
+
 void concurrencpp::details::consumer_context::set_shared_context(const std::shared_ptr<shared_result_state_base>& shared_ctx) noexcept {
     assert(m_status == consumer_status::idle);
     m_status = consumer_status::shared;
     details::build(m_storage.shared_ctx, shared_ctx);
 }
 
-void consumer_context::resume_consumer(result_state_base& self) const {
+concurrencpp::details::coroutine_handle<void> consumer_context::resume_consumer(result_state_base& self) const {
     switch (m_status) {
         case consumer_status::idle: {
-            return;
+            return {};
         }
 
         case consumer_status::await: {
             auto caller_handle = m_storage.caller_handle;
             assert(static_cast<bool>(caller_handle));
             assert(!caller_handle.done());
-            return caller_handle();
+            return caller_handle;
         }
 
         case consumer_status::wait_for: {
             const auto wait_ctx = m_storage.wait_for_ctx;
             assert(static_cast<bool>(wait_ctx));
-            return wait_ctx->release();
+            wait_ctx->release();
+            return {};
         }
 
         case consumer_status::when_any: {
             const auto when_any_ctx = m_storage.when_any_ctx;
+            assert(when_any_ctx != nullptr);
             return when_any_ctx->try_resume(self);
         }
 
+        case consumer_status::when_all: {
+            const auto when_all_ctx = m_storage.when_all_ctx;
+            assert(when_all_ctx != nullptr);
+            return when_all_ctx->try_resume();
+        }
+
+        case consumer_status::when_n: {
+            const auto when_n_ctx = m_storage.when_n_ctx;
+            assert(when_n_ctx != nullptr);
+            return when_n_ctx->try_resume(self);
+        }
+
         case consumer_status::shared: {
             const auto weak_shared_ctx = m_storage.shared_ctx;
             const auto shared_ctx = weak_shared_ctx.lock();
             if (static_cast<bool>(shared_ctx)) {
                 shared_ctx->on_result_finished();
             }
-            return;
+            return {};
         }
     }
 
     assert(false);
+    return {};
 }
\ No newline at end of file
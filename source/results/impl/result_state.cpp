@@ -1,5 +1,6 @@
 #include "concurrencpp/results/impl/result_state.h"
 #include "concurrencpp/results/impl/shared_result_state.h"
+#include "concurrencpp/threads/spin_wait.h"
 
 using concurrencpp::details::result_state_base;
 
@@ -13,6 +14,15 @@ void result_state_base::wait() {
         return;
     }
 
+    // while the state is idle the producer doesn't have to notify anyone, short tasks complete without a syscall.
+    const auto done = spin_wait::spin_until([this]() noexcept {
+        return m_pc_state.load(std::memory_order_acquire) == pc_state::producer_done;
+    });
+
+    if (done) {
+        return;
+    }
+
     auto expected_state = pc_state::idle;
     const auto idle = m_pc_state.compare_exchange_strong(expected_state,
                                                          pc_state::consumer_waiting,
@@ -56,13 +66,13 @@ bool result_state_base::await(coroutine_handle<void> caller_handle) noexcept {
     return idle;  // if idle = true, suspend
 }
 
-result_state_base::pc_state result_state_base::when_any(const std::shared_ptr<when_any_context>& when_any_state) noexcept {
+result_state_base::pc_state result_state_base::when_any(when_any_context& when_any_state) noexcept {
     const auto state = m_pc_state.load(std::memory_order_acquire);
     if (state == pc_state::producer_done) {
         return state;
     }
 
-    m_consumer.set_when_any_context(when_any_state);
+    m_consumer.set_when_any_context(&when_any_state);
 
     auto expected_state = pc_state::idle;
     const auto idle = m_pc_state.compare_exchange_strong(expected_state,
@@ -70,11 +80,57 @@ result_state_base::pc_state result_state_base::when_any(const std::shared_ptr<wh
                                                          std::memory_order_acq_rel,
                                                          std::memory_order_acquire);
 
-    if (!idle) {
-        assert_done();
+    if (idle) {
+        return pc_state::consumer_set;
+    }
+
+    // the producer finished between the load and the CAS, it will not touch the consumer context.
+    assert_done();
+    return pc_state::producer_done;
+}
+
+result_state_base::pc_state result_state_base::when_all(when_all_context& when_all_state) noexcept {
+    const auto state = m_pc_state.load(std::memory_order_acquire);
+    if (state == pc_state::producer_done) {
+        return state;
+    }
+
+    m_consumer.set_when_all_context(&when_all_state);
+
+    auto expected_state = pc_state::idle;
+    const auto idle = m_pc_state.compare_exchange_strong(expected_state,
+                                                         pc_state::consumer_set,
+                                                         std::memory_order_acq_rel,
+                                                         std::memory_order_acquire);
+
+    if (idle) {
+        return pc_state::consumer_set;
     }
 
-    return state;
+    assert_done();
+    return pc_state::producer_done;
+}
+
+result_state_base::pc_state result_state_base::when_n(when_n_context& when_n_state) noexcept {
+    const auto state = m_pc_state.load(std::memory_order_acquire);
+    if (state == pc_state::producer_done) {
+        return state;
+    }
+
+    m_consumer.set_when_n_context(&when_n_state);
+
+    auto expected_state = pc_state::idle;
+    const auto idle = m_pc_state.compare_exchange_strong(expected_state,
+                                                         pc_state::consumer_set,
+                                                         std::memory_order_acq_rel,
+                                                         std::memory_order_acquire);
+
+    if (idle) {
+        return pc_state::consumer_set;
+    }
+
+    assert_done();
+    return pc_state::producer_done;
 }
 
 void concurrencpp::details::result_state_base::share(const std::shared_ptr<shared_result_state_base>& shared_result_state) noexcept {
@@ -99,10 +155,10 @@ void concurrencpp::details::result_state_base::share(const std::shared_ptr<share
     shared_result_state->on_result_finished();
 }
 
-void result_state_base::try_rewind_consumer() noexcept {
+bool result_state_base::try_rewind_consumer() noexcept {
     const auto pc_state = m_pc_state.load(std::memory_order_acquire);
     if (pc_state != pc_state::consumer_set) {
-        return;
+        return false;
     }
 
     auto expected_consumer_state = pc_state::consumer_set;
@@ -113,8 +169,9 @@ void result_state_base::try_rewind_consumer() noexcept {
 
     if (!consumer) {
         assert_done();
-        return;
+        return false;
     }
 
     m_consumer.clear();
+    return true;
 }
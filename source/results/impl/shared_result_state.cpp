@@ -1,5 +1,11 @@
 #include "concurrencpp/results/impl/shared_result_state.h"
 
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/threads/spin_wait.h"
+
+#include <vector>
+
+using concurrencpp::details::shared_await_context;
 using concurrencpp::details::shared_result_state_base;
 
 concurrencpp::details::shared_await_context* shared_result_state_base::result_ready_constant() noexcept {
@@ -26,7 +32,92 @@ bool shared_result_state_base::await(shared_await_context& awaiter) noexcept {
 }
 
 void concurrencpp::details::shared_result_state_base::wait() noexcept {
-    if (status() == result_status::idle) {
-        m_status.wait(result_status::idle, std::memory_order_acquire);
+    if (status() != result_status::idle) {
+        return;
+    }
+
+    const auto done = spin_wait::spin_until([this]() noexcept {
+        return status() != result_status::idle;
+    });
+
+    if (done) {
+        return;
+    }
+
+    m_status.wait(result_status::idle, std::memory_order_acquire);
+}
+
+void shared_result_state_base::notify_waiters() noexcept {
+    m_status.notify_all();
+
+    // timed waiters check the status under the lock, taking it here makes sure none of them misses the notification.
+    {
+        std::unique_lock<std::mutex> lock(m_timed_wait_lock);
+    }
+
+    m_timed_wait_condition.notify_all();
+}
+
+void shared_result_state_base::set_resume_executor(std::shared_ptr<executor> resume_executor) noexcept {
+    assert(m_awaiters.load(std::memory_order_relaxed) == nullptr);
+    m_resume_executor = std::move(resume_executor);
+}
+
+void shared_result_state_base::resume_inline(shared_await_context* awaiters) noexcept {
+    while (awaiters != nullptr) {
+        assert(static_cast<bool>(awaiters->caller_handle));
+        auto caller_handle = awaiters->caller_handle;
+        awaiters = awaiters->next;
+        caller_handle();
+    }
+}
+
+void shared_result_state_base::resume_via_executor(shared_await_context* awaiters) noexcept {
+    std::vector<task> tasks;
+
+    try {
+        for (auto awaiter = awaiters; awaiter != nullptr; awaiter = awaiter->next) {
+            tasks.emplace_back();
+        }
+    } catch (...) {
+        return resume_inline(awaiters);
     }
+
+    // an awaiter is destroyed once its coroutine is resumed, so the list is walked before anything is scheduled.
+    auto task_it = tasks.begin();
+    while (awaiters != nullptr) {
+        assert(static_cast<bool>(awaiters->caller_handle));
+        *task_it = await_via_functor {awaiters->caller_handle, &awaiters->interrupted};
+        ++task_it;
+        awaiters = awaiters->next;
+    }
+
+    try {
+        m_resume_executor->enqueue(std::span<task> {tasks});
+    } catch (...) {
+        // awaiters that could not be scheduled are resumed inline as interrupted by ~await_via_functor.
+    }
+}
+
+void shared_result_state_base::resume_awaiters() noexcept {
+    auto awaiters = m_awaiters.exchange(result_ready_constant(), std::memory_order_acq_rel);
+
+    // awaiters are pushed to the head of the list, reverse it so they are resumed by the order they came.
+    shared_await_context *prev = nullptr, *next = nullptr;
+    while (awaiters != nullptr) {
+        next = awaiters->next;
+        awaiters->next = prev;
+        prev = awaiters;
+        awaiters = next;
+    }
+
+    if (prev == nullptr) {
+        return;
+    }
+
+    if (static_cast<bool>(m_resume_executor)) {
+        return resume_via_executor(prev);
+    }
+
+    resume_inline(prev);
 }
@@ -0,0 +1,60 @@
+#include "concurrencpp/results/with_timeout.h"
+
+using concurrencpp::details::timer_state_base;
+using concurrencpp::details::make_timer_state;
+using concurrencpp::details::timeout_timer_state;
+using concurrencpp::details::result_state_base;
+using concurrencpp::details::timeout_awaitable_base;
+
+timeout_awaitable_base::timeout_awaitable_base(std::shared_ptr<timer_queue> timer_queue,
+                                               timer_state_base::duration timeout,
+                                               std::shared_ptr<concurrencpp::executor> executor,
+                                               std::stop_source stop_source) noexcept :
+    m_timer_queue(std::move(timer_queue)),
+    m_timeout(timeout), m_executor(std::move(executor)), m_stop_source(std::move(stop_source)) {}
+
+bool timeout_awaitable_base::suspend(result_state_base& result_state, coroutine_handle<void> coro_handle) {
+    const auto slack = timer_state_base::duration(m_timer_queue->m_coalescing_window);
+    m_timer = make_timer_state<timeout_timer_state>(m_timeout, slack, std::move(m_executor), coro_handle);
+
+    // armed before subscribing, so a timeout that already expired races the result like any other.
+    m_timer_queue->add_timer(m_timer);
+
+    auto& context = m_timer->context();
+    const auto status = result_state.when_any(context);
+    if (status == result_state_base::pc_state::producer_done) {
+        return context.resume_inline(result_state);
+    }
+
+    m_subscribed = true;
+    return context.finish_processing();
+}
+
+bool timeout_awaitable_base::unsubscribe(result_state_base& result_state) {
+    if (!static_cast<bool>(m_timer)) {
+        return false;  // the result was ready before it was awaited
+    }
+
+    auto& context = m_timer->context();
+
+    // a result that could not be rewound was completed, and its producer is about to leave try_resume.
+    if (m_subscribed && !result_state.try_rewind_consumer()) {
+        context.wait_for_producers(1);
+    }
+
+    if (context.timed_out()) {
+        return true;
+    }
+
+    // the timer_queue thread drops the cancelled timer lazily, cancelling it doesn't lock anything.
+    m_timer->cancel();
+    return false;
+}
+
+void timeout_awaitable_base::on_timeout() {
+    m_stop_source.request_stop();
+
+    if (m_timer->interrupted()) {
+        throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+    }
+}
@@ -62,6 +62,8 @@ runtime_options::runtime_options() noexcept :
     max_background_threads(details::default_max_background_workers()),
     max_background_executor_waiting_time(details::k_default_max_worker_wait_time),
     max_timer_queue_waiting_time(std::chrono::seconds(details::consts::k_max_timer_queue_worker_waiting_time_sec)),
+    timer_backend(timer_queue_backend::ordered_set), timer_coalescing_window(0), worker_local_timers(false), timer_spin_window(0),
+    trampolined_inline_executor(false),
     net_io_pool_threads(details::consts::k_net_io_pool_threads) {}
 
 /*
@@ -73,9 +75,13 @@ runtime::runtime() : runtime(runtime_options()) {}
 runtime::runtime(const runtime_options& options) {
     m_timer_queue = std::make_shared<::concurrencpp::timer_queue>(options.max_timer_queue_waiting_time,
                                                                   options.thread_started_callback,
-                                                                  options.thread_terminated_callback);
+                                                                  options.thread_terminated_callback,
+                                                                  options.timer_backend,
+                                                                  options.timer_coalescing_window,
+                                                                  options.worker_local_timers,
+                                                                  options.timer_spin_window);
 
-    m_inline_executor = std::make_shared<::concurrencpp::inline_executor>();
+    m_inline_executor = std::make_shared<::concurrencpp::inline_executor>(options.trampolined_inline_executor);
     m_registered_executors.register_executor(m_inline_executor);
 
     m_thread_pool_executor = std::make_shared<::concurrencpp::thread_pool_executor>(details::consts::k_thread_pool_executor_name,
@@ -0,0 +1,122 @@
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_barrier.h"
+#include "concurrencpp/executors/executor.h"
+
+using concurrencpp::async_barrier;
+using concurrencpp::details::async_waiter;
+using concurrencpp::details::async_barrier_awaiter;
+
+/*
+    async_barrier_awaiter
+*/
+
+async_barrier_awaiter::async_barrier_awaiter(async_barrier& parent, executor& resume_executor) noexcept :
+    async_waiter(resume_executor), m_parent(parent) {}
+
+bool async_barrier_awaiter::await_suspend(coroutine_handle<void> coro_handle) noexcept {
+    assert(static_cast<bool>(coro_handle));
+    assert(!coro_handle.done());
+
+    handle = coro_handle;
+
+    auto& parent = m_parent;
+    const auto pushed = push_to(parent.m_waiters);
+    assert(pushed);
+    (void)pushed;
+
+    if (!parent.arrive()) {
+        return true;
+    }
+
+    // the last coroutine to arrive completes the phase and continues synchronously.
+    parent.complete_phase(this);
+    return false;
+}
+
+void async_barrier_awaiter::await_resume() const {
+    if (interrupted) {
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
+/*
+    async_barrier
+*/
+
+async_barrier::async_barrier(size_t expected, std::function<void()> completion) :
+    m_remaining(expected), m_expected(expected), m_completion(std::move(completion)) {
+    if (expected == 0) {
+        throw std::invalid_argument(details::consts::k_async_barrier_invalid_expected_err_msg);
+    }
+}
+
+async_barrier::~async_barrier() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    assert(m_waiters.load(std::memory_order_acquire) == nullptr && "async_barrier is destroyed while coroutines wait for it.");
+#endif
+}
+
+bool async_barrier::arrive() noexcept {
+    const auto remaining = m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+    assert(remaining != 0);
+    return remaining == 1;
+}
+
+void async_barrier::complete_phase(async_waiter* self) noexcept {
+    // no other coroutine can arrive before the waiters are resumed, so the phase is completed without contention.
+    if (static_cast<bool>(m_completion)) {
+        m_completion();  // like std::barrier, a throwing completion function terminates the program.
+    }
+
+    auto waiters = async_waiter::reverse(m_waiters.exchange(nullptr, std::memory_order_acq_rel));
+
+    m_remaining.store(m_expected.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_phase.fetch_add(1, std::memory_order_release);
+
+    if (self != nullptr) {
+        async_waiter* others = nullptr;
+        async_waiter** others_tail = &others;
+
+        while (waiters != nullptr) {
+            const auto next = waiters->next;
+            if (waiters != self) {
+                *others_tail = waiters;
+                others_tail = &waiters->next;
+            }
+
+            waiters = next;
+        }
+
+        *others_tail = nullptr;
+        waiters = others;
+    }
+
+    async_waiter::resume_all(waiters);
+}
+
+concurrencpp::lazy_result<void> async_barrier::arrive_and_wait_impl(std::shared_ptr<executor> resume_executor) {
+    co_await details::async_barrier_awaiter(*this, *resume_executor);
+}
+
+concurrencpp::lazy_result<void> async_barrier::arrive_and_wait(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_barrier_arrive_and_wait_null_resume_executor_err_msg);
+    }
+
+    return arrive_and_wait_impl(std::move(resume_executor));
+}
+
+void async_barrier::arrive_and_drop() {
+    // the participant leaves before it arrives, so the next phase is started with the reduced count.
+    m_expected.fetch_sub(1, std::memory_order_relaxed);
+
+    if (arrive()) {
+        complete_phase(nullptr);
+    }
+}
+
+size_t async_barrier::phase() const noexcept {
+    return m_phase.load(std::memory_order_acquire);
+}
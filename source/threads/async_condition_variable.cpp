@@ -1,22 +1,32 @@
-#include "concurrencpp/results/resume_on.h"
+#include "concurrencpp/errors.h"
 #include "concurrencpp/threads/constants.h"
 #include "concurrencpp/threads/async_condition_variable.h"
 
+#include <limits>
+
 using concurrencpp::executor;
 using concurrencpp::lazy_result;
 using concurrencpp::scoped_async_lock;
 using concurrencpp::async_condition_variable;
 
 using concurrencpp::details::cv_awaiter;
+using concurrencpp::details::cv_predicate;
+using concurrencpp::details::async_waiter;
 
 /*
     cv_awaiter
 */
 
-cv_awaiter::cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock) noexcept : m_parent(parent), m_lock(lock) {}
+cv_awaiter::cv_awaiter(async_condition_variable& parent,
+                       scoped_async_lock& lock,
+                       executor& resume_executor,
+                       std::optional<size_t> key,
+                       cv_predicate pred) noexcept :
+    async_waiter(resume_executor),
+    m_parent(parent), m_lock(lock), key(key), pred(pred), mutex(lock.mutex()) {}
 
 void cv_awaiter::await_suspend(details::coroutine_handle<void> caller_handle) {
-    m_caller_handle = caller_handle;
+    handle = caller_handle;
 
     std::unique_lock<std::mutex> lock(m_parent.m_lock);
     m_lock.unlock();
@@ -24,10 +34,23 @@ void cv_awaiter::await_suspend(details::coroutine_handle<void> caller_handle) {
     m_parent.m_awaiters.push_back(*this);
 }
 
-void cv_awaiter::resume() noexcept {
-    assert(static_cast<bool>(m_caller_handle));
-    assert(!m_caller_handle.done());
-    m_caller_handle();
+void cv_awaiter::await_resume() const {
+    if (interrupted) {
+        throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+    }
+}
+
+bool cv_awaiter::satisfied() const noexcept {
+    if (pred.invoke == nullptr) {
+        return true;
+    }
+
+    try {
+        return pred.invoke(pred.context);
+    } catch (...) {
+        // the task is resumed and re-evaluates its predicate, the exception is thrown there.
+        return true;
+    }
 }
 
 /*
@@ -51,16 +74,58 @@ void async_condition_variable::verify_await_params(const std::shared_ptr<executo
     }
 }
 
-lazy_result<void> async_condition_variable::await_impl(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock) {
-    co_await details::cv_awaiter(*this, lock);
+lazy_result<void> async_condition_variable::await_impl(std::shared_ptr<executor> resume_executor,
+                                                       scoped_async_lock& lock,
+                                                       std::optional<size_t> key,
+                                                       details::cv_predicate pred) {
+    co_await details::cv_awaiter(*this, lock, *resume_executor, key, pred);
     assert(!lock.owns_lock());
-    co_await resume_on(resume_executor);  // TODO: optimize this when get_current_executor is available
     co_await lock.lock(resume_executor);
 }
 
 lazy_result<void> async_condition_variable::await(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock) {
     verify_await_params(resume_executor, lock);
-    return await_impl(std::move(resume_executor), lock);
+    return await_impl(std::move(resume_executor), lock, std::nullopt, {});
+}
+
+lazy_result<void> async_condition_variable::await_keyed(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock, size_t key) {
+    verify_await_params(resume_executor, lock);
+    return await_impl(std::move(resume_executor), lock, key, {});
+}
+
+/*
+    moves up to max_count suspended tasks that pass filter to a separate list, keeping the order of the tasks that remain.
+    must be called while m_lock is held.
+*/
+template<class filter_type>
+concurrencpp::details::slist<async_waiter> async_condition_variable::take_awaiters_locked(filter_type filter, size_t max_count) noexcept {
+    details::slist<async_waiter> taken;
+    details::slist<async_waiter> remaining;
+    size_t count = 0;
+
+    while (const auto awaiter = m_awaiters.pop_front()) {
+        awaiter->next = nullptr;
+
+        if (count < max_count && filter(*static_cast<cv_awaiter*>(awaiter))) {
+            taken.push_back(*awaiter);
+            ++count;
+        } else {
+            remaining.push_back(*awaiter);
+        }
+    }
+
+    m_awaiters = std::move(remaining);
+    return taken;
+}
+
+// resumes the tasks that pass filter once the lock is released.
+template<class filter_type>
+void async_condition_variable::notify_impl(filter_type filter, size_t max_count) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto to_resume = take_awaiters_locked(filter, max_count);
+    lock.unlock();
+
+    async_waiter::resume_all(to_resume.front());
 }
 
 void async_condition_variable::notify_one() {
@@ -69,7 +134,8 @@ void async_condition_variable::notify_one() {
     lock.unlock();
 
     if (awaiter != nullptr) {
-        awaiter->resume();
+        awaiter->next = nullptr;
+        async_waiter::resume_all(awaiter);
     }
 }
 
@@ -78,12 +144,47 @@ void async_condition_variable::notify_all() {
     auto awaiters = std::move(m_awaiters);
     lock.unlock();
 
-    while (true) {
-        const auto awaiter = awaiters.pop_front();
-        if (awaiter == nullptr) {
-            return;  // no more awaiters
-        }
+    async_waiter::resume_all(awaiters.front());
+}
+
+void async_condition_variable::notify_one(size_t key) {
+    notify_impl(
+        [key](const cv_awaiter& awaiter) noexcept {
+            return awaiter.key == key;
+        },
+        1);
+}
+
+void async_condition_variable::notify_all(size_t key) {
+    notify_impl(
+        [key](const cv_awaiter& awaiter) noexcept {
+            return awaiter.key == key;
+        },
+        std::numeric_limits<size_t>::max());
+}
 
-        awaiter->resume();
+void async_condition_variable::notify_satisfied(const scoped_async_lock& lock) {
+    if (!lock.owns_lock()) {
+        throw std::invalid_argument(details::consts::k_async_condition_variable_notify_satisfied_lock_unlocked_err_msg);
     }
+
+    std::unique_lock<std::mutex> cv_lock(m_lock);
+
+    // the predicates read memory that is guarded by the lock their tasks waited with, so they are only evaluated under it.
+    for (auto awaiter = m_awaiters.front(); awaiter != nullptr; awaiter = awaiter->next) {
+        const auto& waiting_task = static_cast<const cv_awaiter&>(*awaiter);
+        if (waiting_task.pred.invoke != nullptr && waiting_task.mutex != lock.mutex()) {
+            throw std::invalid_argument(details::consts::k_async_condition_variable_notify_satisfied_foreign_lock_err_msg);
+        }
+    }
+
+    auto to_resume = take_awaiters_locked(
+        [](const cv_awaiter& awaiter) noexcept {
+            return awaiter.satisfied();
+        },
+        std::numeric_limits<size_t>::max());
+
+    cv_lock.unlock();
+
+    async_waiter::resume_all(to_resume.front());
 }
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_latch.h"
+#include "concurrencpp/executors/executor.h"
+
+using concurrencpp::async_latch;
+using concurrencpp::details::async_waiter;
+using concurrencpp::details::async_latch_awaiter;
+
+/*
+    async_latch_awaiter
+*/
+
+async_latch_awaiter::async_latch_awaiter(async_latch& parent, executor& resume_executor) noexcept :
+    async_waiter(resume_executor), m_parent(parent) {}
+
+bool async_latch_awaiter::await_ready() const noexcept {
+    return m_parent.try_wait();
+}
+
+bool async_latch_awaiter::await_suspend(coroutine_handle<void> coro_handle) noexcept {
+    assert(static_cast<bool>(coro_handle));
+    assert(!coro_handle.done());
+
+    handle = coro_handle;
+
+    // if the latch was released in the meantime, the coroutine continues synchronously.
+    return push_to(m_parent.m_waiters, async_latch::released_constant());
+}
+
+void async_latch_awaiter::await_resume() const {
+    if (interrupted) {
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
+/*
+    async_latch
+*/
+
+async_latch::async_latch(size_t expected) noexcept : m_counter(expected) {
+    if (expected == 0) {
+        m_waiters.store(released_constant(), std::memory_order_relaxed);
+    }
+}
+
+async_latch::~async_latch() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    const auto waiters = m_waiters.load(std::memory_order_acquire);
+    assert((waiters == nullptr || waiters == released_constant()) && "async_latch is destroyed while coroutines wait for it.");
+#endif
+}
+
+async_waiter* async_latch::released_constant() noexcept {
+    return reinterpret_cast<async_waiter*>(-1);
+}
+
+void async_latch::count_down(size_t update) {
+    auto counter = m_counter.load(std::memory_order_relaxed);
+
+    do {
+        if (update > counter) {
+            throw std::invalid_argument(details::consts::k_async_latch_count_down_invalid_update_err_msg);
+        }
+    } while (!m_counter.compare_exchange_weak(counter, counter - update, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    if (update == 0 || counter != update) {
+        return;
+    }
+
+    const auto waiters = m_waiters.exchange(released_constant(), std::memory_order_acq_rel);
+    assert(waiters != released_constant());
+
+    async_waiter::resume_all(async_waiter::reverse(waiters));
+}
+
+bool async_latch::try_wait() const noexcept {
+    return m_counter.load(std::memory_order_acquire) == 0;
+}
+
+concurrencpp::lazy_result<void> async_latch::wait_impl(std::shared_ptr<executor> resume_executor) {
+    co_await details::async_latch_awaiter(*this, *resume_executor);
+}
+
+concurrencpp::lazy_result<void> async_latch::wait(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_latch_wait_null_resume_executor_err_msg);
+    }
+
+    return wait_impl(std::move(resume_executor));
+}
+
+concurrencpp::lazy_result<void> async_latch::arrive_and_wait(std::shared_ptr<executor> resume_executor, size_t update) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_latch_arrive_and_wait_null_resume_executor_err_msg);
+    }
+
+    count_down(update);
+    return wait_impl(std::move(resume_executor));
+}
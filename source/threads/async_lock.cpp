@@ -1,4 +1,6 @@
+#include "concurrencpp/errors.h"
 #include "concurrencpp/results/resume_on.h"
+#include "concurrencpp/results/constants.h"
 #include "concurrencpp/threads/constants.h"
 #include "concurrencpp/threads/async_lock.h"
 #include "concurrencpp/executors/executor.h"
@@ -11,68 +13,161 @@ using concurrencpp::details::async_lock_awaiter;
     async_lock_awaiter
 */
 
-async_lock_awaiter::async_lock_awaiter(async_lock& parent, std::unique_lock<std::mutex>& lock) noexcept :
-    m_parent(parent), m_lock(std::move(lock)) {}
+async_lock_awaiter::async_lock_awaiter(async_lock& parent, executor& resume_executor) noexcept :
+    m_parent(parent), m_resume_executor(resume_executor) {}
 
-void async_lock_awaiter::await_suspend(coroutine_handle<void> handle) {
+bool async_lock_awaiter::await_ready() noexcept {
+    m_acquired = m_parent.try_acquire();
+    return m_acquired;
+}
+
+bool async_lock_awaiter::await_suspend(coroutine_handle<void> handle) noexcept {
     assert(static_cast<bool>(handle));
     assert(!handle.done());
     assert(!static_cast<bool>(m_resume_handle));
-    assert(m_lock.owns_lock());
 
     m_resume_handle = handle;
-    m_parent.m_awaiters.push_back(*this);
 
-    auto lock = std::move(m_lock);  // will unlock underlying lock
+    /*
+        if the lock was released in the meantime, it's acquired instead and the coroutine continues synchronously.
+        once parked, this awaiter may be resumed and destroyed by another thread, so it's not touched after parking.
+    */
+    if (m_parent.try_park(*this)) {
+        return true;
+    }
+
+    m_acquired = true;
+    return false;
 }
 
-void async_lock_awaiter::retry() noexcept {
-    m_resume_handle.resume();
+bool async_lock_awaiter::await_resume() {
+    if (!m_interrupted) {
+        return m_acquired;
+    }
+
+    /*
+        the resume executor was shut down. the lock (or in barging mode, the wake up) that was meant for this coroutine
+        has to be passed on, otherwise the other waiters are never resumed.
+    */
+    if (m_acquired || m_parent.try_acquire()) {
+        m_parent.release();
+    }
+
+    throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+}
+
+void async_lock_awaiter::resume(bool acquired) noexcept {
+    m_acquired = acquired;
+
+    // this awaiter might be destroyed as soon as the coroutine is resumed, so nothing is accessed after posting.
+    auto& resume_executor = m_resume_executor;
+
+    try {
+        resume_executor.post(await_via_functor {m_resume_handle, &m_interrupted});
+    } catch (...) {
+        // the exception caused the enqeueud task to be broken and resumed with an interrupt, no need to do anything here.
+    }
 }
 
 /*
     async_lock
 */
 
+async_lock::async_lock() noexcept : async_lock(false) {}
+
+async_lock::async_lock(bool barging) noexcept : m_barging(barging) {}
+
 async_lock::~async_lock() noexcept {
 #ifdef CRCPP_DEBUG_MODE
-    std::unique_lock<std::mutex> lock(m_awaiter_lock);
-    assert(!m_locked && "async_lock is dstroyed while it's locked.");
+    assert(m_state.load(std::memory_order_acquire) == k_unlocked && "async_lock is dstroyed while it's locked.");
+    assert(m_waiters.empty());
 #endif
 }
 
-concurrencpp::lazy_result<scoped_async_lock> async_lock::lock_impl(std::shared_ptr<executor> resume_executor, bool with_raii_guard) {
-    auto resume_synchronously = true;  // indicates if the locking coroutine managed to lock the lock on first attempt
+bool async_lock::try_acquire() noexcept {
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    while ((state & k_locked) == 0) {
+        if (m_state.compare_exchange_weak(state, state | k_locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool async_lock::try_park(details::async_lock_awaiter& awaiter) noexcept {
+    static_assert(alignof(details::async_lock_awaiter) > k_locked);
+
+    auto state = m_state.load(std::memory_order_relaxed);
 
     while (true) {
-        std::unique_lock<std::mutex> lock(m_awaiter_lock);
-        if (!m_locked) {
-            m_locked = true;
-            lock.unlock();
-            break;
+        if ((state & k_locked) == 0) {
+            if (m_state.compare_exchange_weak(state, state | k_locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            continue;
         }
 
-        co_await async_lock_awaiter(*this, lock);
+        awaiter.next = reinterpret_cast<details::async_lock_awaiter*>(state & ~k_locked);
+        const auto parked_state = reinterpret_cast<std::uintptr_t>(&awaiter) | k_locked;
 
-        resume_synchronously =
-            false;  // if we haven't managed to lock the lock on first attempt, we need to resume using resume_executor
+        if (m_state.compare_exchange_weak(state, parked_state, std::memory_order_release, std::memory_order_relaxed)) {
+            return true;
+        }
     }
+}
 
-    if (!resume_synchronously) {
-        try {
-            co_await resume_on(resume_executor);
-        } catch (...) {
-            std::unique_lock<std::mutex> lock(m_awaiter_lock);
-            assert(m_locked);
-            m_locked = false;
-            const auto awaiter = m_awaiters.pop_front();
-            lock.unlock();
+void async_lock::release() noexcept {
+    if (m_waiters.empty()) {
+        auto state = m_state.load(std::memory_order_acquire);
 
-            if (awaiter != nullptr) {
-                awaiter->retry();
+        while (state == k_locked) {
+            if (m_state.compare_exchange_weak(state, k_unlocked, std::memory_order_release, std::memory_order_acquire)) {
+                return;
             }
+        }
+
+        // coroutines parked while the lock was owned. take them while keeping the lock, and put them in FIFO order.
+        auto parked = reinterpret_cast<details::async_lock_awaiter*>(m_state.exchange(k_locked, std::memory_order_acquire) & ~k_locked);
+        assert(parked != nullptr);
 
-            throw;
+        details::async_lock_awaiter* reversed = nullptr;
+        while (parked != nullptr) {
+            const auto next = parked->next;
+            parked->next = reversed;
+            reversed = parked;
+            parked = next;
+        }
+
+        while (reversed != nullptr) {
+            const auto next = reversed->next;
+            m_waiters.push_back(*reversed);
+            reversed = next;
+        }
+    }
+
+    const auto awaiter = m_waiters.pop_front();
+    assert(awaiter != nullptr);
+
+    if (!m_barging) {
+        // direct handoff, the lock stays locked and is now owned by awaiter.
+        return awaiter->resume(true);
+    }
+
+    auto state = m_state.load(std::memory_order_relaxed);
+    while (!m_state.compare_exchange_weak(state, state & ~k_locked, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+
+    awaiter->resume(false);
+}
+
+concurrencpp::lazy_result<scoped_async_lock> async_lock::lock_impl(std::shared_ptr<executor> resume_executor, bool with_raii_guard) {
+    while (true) {
+        details::async_lock_awaiter awaiter(*this, *resume_executor);
+        if (co_await awaiter) {
+            break;
         }
     }
 
@@ -97,16 +192,7 @@ concurrencpp::lazy_result<scoped_async_lock> async_lock::lock(std::shared_ptr<ex
 }
 
 concurrencpp::lazy_result<bool> async_lock::try_lock() {
-    auto res = false;
-
-    std::unique_lock<std::mutex> lock(m_awaiter_lock);
-    if (!m_locked) {
-        m_locked = true;
-        lock.unlock();
-        res = true;
-    } else {
-        lock.unlock();
-    }
+    const auto res = try_acquire();
 
 #ifdef CRCPP_DEBUG_MODE
     if (res) {
@@ -119,27 +205,22 @@ concurrencpp::lazy_result<bool> async_lock::try_lock() {
 }
 
 void async_lock::unlock() {
-    std::unique_lock<std::mutex> lock(m_awaiter_lock);
-    if (!m_locked) {  // trying to unlocked non-owned mutex
-        lock.unlock();
+    if ((m_state.load(std::memory_order_relaxed) & k_locked) == 0) {  // trying to unlocked non-owned mutex
         throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
                                 std::system_category(),
                                 details::consts::k_async_lock_unlock_invalid_lock_err_msg);
     }
 
-    m_locked = false;
-
 #ifdef CRCPP_DEBUG_MODE
     const auto current_count = m_thread_count_in_critical_section.fetch_sub(1, std::memory_order_relaxed);
     assert(current_count == 1);
 #endif
 
-    const auto awaiter = m_awaiters.pop_front();
-    lock.unlock();
+    release();
+}
 
-    if (awaiter != nullptr) {
-        awaiter->retry();
-    }
+bool async_lock::barging() const noexcept {
+    return m_barging;
 }
 
 /*
@@ -0,0 +1,164 @@
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_semaphore.h"
+#include "concurrencpp/executors/executor.h"
+
+using concurrencpp::async_semaphore;
+using concurrencpp::details::async_waiter;
+using concurrencpp::details::async_semaphore_awaiter;
+
+/*
+    async_semaphore_awaiter
+*/
+
+async_semaphore_awaiter::async_semaphore_awaiter(async_semaphore& parent, executor& resume_executor, size_t count) noexcept :
+    async_waiter(resume_executor), m_parent(parent), m_count(count) {}
+
+bool async_semaphore_awaiter::await_ready() noexcept {
+    return m_parent.try_acquire(m_count);
+}
+
+void async_semaphore_awaiter::await_suspend(coroutine_handle<void> coro_handle) noexcept {
+    assert(static_cast<bool>(coro_handle));
+    assert(!coro_handle.done());
+
+    handle = coro_handle;
+
+    // once pushed, this awaiter might be granted, resumed and destroyed by another thread.
+    auto& parent = m_parent;
+
+    // the waiter count is raised before parking, so a concurrent release knows it has to dispatch.
+    parent.m_waiter_count.fetch_add(1, std::memory_order_seq_cst);
+
+    const auto pushed = push_to(parent.m_parked);
+    assert(pushed);
+    (void)pushed;
+
+    // permits might have been released before this coroutine parked
+    parent.dispatch();
+}
+
+void async_semaphore_awaiter::await_resume() {
+    if (!interrupted) {
+        return;
+    }
+
+    // the resume executor was shut down. the permits that were granted to this coroutine are given back.
+    m_parent.release(m_count);
+    throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+}
+
+/*
+    async_semaphore
+*/
+
+async_semaphore::async_semaphore(size_t initial_permits) noexcept : m_permits(initial_permits) {}
+
+async_semaphore::~async_semaphore() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    assert(m_waiter_count.load(std::memory_order_acquire) == 0 && "async_semaphore is destroyed while coroutines wait for it.");
+#endif
+}
+
+bool async_semaphore::try_take(size_t count) noexcept {
+    auto permits = m_permits.load(std::memory_order_acquire);
+
+    while (permits >= count) {
+        if (m_permits.compare_exchange_weak(permits, permits - count, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+async_waiter* async_semaphore::grant_waiters() noexcept {
+    // coroutines that parked since the last dispatch join the FIFO by the order they came
+    auto parked = async_waiter::reverse(m_parked.exchange(nullptr, std::memory_order_acq_rel));
+    while (parked != nullptr) {
+        const auto next = parked->next;
+        parked->next = nullptr;
+        m_waiters.push_back(*parked);
+        parked = next;
+    }
+
+    async_waiter* granted = nullptr;
+    async_waiter** granted_tail = &granted;
+
+    while (const auto waiter = m_waiters.front()) {
+        if (!try_take(static_cast<async_semaphore_awaiter*>(waiter)->m_count)) {
+            break;
+        }
+
+        m_waiters.pop_front();
+        m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+        waiter->next = nullptr;
+
+        *granted_tail = waiter;
+        granted_tail = &waiter->next;
+    }
+
+    return granted;
+}
+
+void async_semaphore::dispatch() noexcept {
+    if (m_dispatch_requests.fetch_add(1, std::memory_order_acq_rel) != 0) {
+        // another thread is dispatching and will handle this request before it returns.
+        return;
+    }
+
+    size_t handled_requests = 1;
+
+    while (true) {
+        async_waiter::resume_all(grant_waiters());
+
+        const auto remaining_requests = m_dispatch_requests.fetch_sub(handled_requests, std::memory_order_acq_rel) - handled_requests;
+        if (remaining_requests == 0) {
+            return;
+        }
+
+        handled_requests = remaining_requests;
+    }
+}
+
+concurrencpp::lazy_result<void> async_semaphore::acquire_impl(std::shared_ptr<executor> resume_executor, size_t count) {
+    co_await details::async_semaphore_awaiter(*this, *resume_executor, count);
+}
+
+concurrencpp::lazy_result<void> async_semaphore::acquire(std::shared_ptr<executor> resume_executor, size_t count) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_semaphore_acquire_null_resume_executor_err_msg);
+    }
+
+    if (count == 0) {
+        throw std::invalid_argument(details::consts::k_async_semaphore_acquire_invalid_count_err_msg);
+    }
+
+    return acquire_impl(std::move(resume_executor), count);
+}
+
+bool async_semaphore::try_acquire(size_t count) noexcept {
+    // permits are not taken from under coroutines that already wait for them
+    if (m_waiter_count.load(std::memory_order_seq_cst) != 0) {
+        return false;
+    }
+
+    return try_take(count);
+}
+
+void async_semaphore::release(size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    m_permits.fetch_add(count, std::memory_order_seq_cst);
+
+    if (m_waiter_count.load(std::memory_order_seq_cst) != 0) {
+        dispatch();
+    }
+}
+
+size_t async_semaphore::available_permits() const noexcept {
+    return m_permits.load(std::memory_order_relaxed);
+}
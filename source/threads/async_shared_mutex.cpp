@@ -0,0 +1,365 @@
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/resume_on.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_shared_mutex.h"
+#include "concurrencpp/executors/executor.h"
+
+using concurrencpp::async_shared_mutex;
+using concurrencpp::scoped_async_shared_lock;
+using concurrencpp::scoped_async_unique_lock;
+using concurrencpp::details::async_shared_mutex_awaiter;
+
+/*
+    async_shared_mutex_awaiter
+*/
+
+async_shared_mutex_awaiter::async_shared_mutex_awaiter(async_shared_mutex& parent, executor& resume_executor, bool shared) noexcept :
+    m_parent(parent), m_resume_executor(resume_executor), m_shared(shared) {}
+
+bool async_shared_mutex_awaiter::await_ready() noexcept {
+    return m_shared ? m_parent.try_acquire_shared() : m_parent.try_acquire();
+}
+
+bool async_shared_mutex_awaiter::await_suspend(coroutine_handle<void> handle) {
+    assert(static_cast<bool>(handle));
+    assert(!handle.done());
+    assert(!static_cast<bool>(m_resume_handle));
+
+    m_resume_handle = handle;
+
+    // if the mutex became available in the meantime, it's acquired instead and the coroutine continues synchronously.
+    return m_parent.try_park(*this);
+}
+
+void async_shared_mutex_awaiter::await_resume() {
+    if (!m_interrupted) {
+        return;
+    }
+
+    // the resume executor was shut down. the ownership that was handed to this coroutine is passed on.
+    if (m_shared) {
+        m_parent.release_shared();
+    } else {
+        m_parent.release();
+    }
+
+    throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+}
+
+void async_shared_mutex_awaiter::resume() noexcept {
+    // this awaiter might be destroyed as soon as the coroutine is resumed, so nothing is accessed after posting.
+    auto& resume_executor = m_resume_executor;
+
+    try {
+        resume_executor.post(await_via_functor {m_resume_handle, &m_interrupted});
+    } catch (...) {
+        // the exception caused the enqeueud task to be broken and resumed with an interrupt, no need to do anything here.
+    }
+}
+
+/*
+    async_shared_mutex
+*/
+
+async_shared_mutex::~async_shared_mutex() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    assert(m_state.load(std::memory_order_acquire) == 0 && "async_shared_mutex is dstroyed while it's locked.");
+    assert(m_parked_writers.empty());
+    assert(m_parked_readers.empty());
+#endif
+}
+
+std::uintptr_t async_shared_mutex::reader_count(std::uintptr_t state) noexcept {
+    return state / k_reader;
+}
+
+bool async_shared_mutex::try_acquire_shared() noexcept {
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    // readers don't acquire the mutex while a writer owns it or waits for it
+    while ((state & (k_writer | k_writers_parked)) == 0) {
+        if (m_state.compare_exchange_weak(state, state + k_reader, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool async_shared_mutex::try_acquire() noexcept {
+    // the parked bits are only set while the mutex is owned or while a writer waits, so an available mutex is always 0.
+    std::uintptr_t state = 0;
+    return m_state.compare_exchange_strong(state, k_writer, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+bool async_shared_mutex::try_park(details::async_shared_mutex_awaiter& awaiter) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    if (awaiter.m_shared) {
+        while (true) {
+            if ((state & (k_writer | k_writers_parked)) == 0) {
+                if (m_state.compare_exchange_weak(state, state + k_reader, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return false;
+                }
+
+                continue;
+            }
+
+            if (m_state.compare_exchange_weak(state, state | k_readers_parked, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                m_parked_readers.push_back(awaiter);
+                return true;
+            }
+        }
+    }
+
+    while (true) {
+        if ((state & ~k_readers_parked) == 0) {
+            if (m_state.compare_exchange_weak(state, state | k_writer, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            continue;
+        }
+
+        /*
+            once k_writers_parked is set, new readers park as well, and the last reader to release the mutex
+            hands it to the first parked writer.
+        */
+        if (m_state.compare_exchange_weak(state, state | k_writers_parked, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            m_parked_writers.push_back(awaiter);
+            return true;
+        }
+    }
+}
+
+void async_shared_mutex::release_shared() noexcept {
+    const auto state = m_state.fetch_sub(k_reader, std::memory_order_release);
+    assert(reader_count(state) != 0);
+
+    if (reader_count(state) == 1 && (state & k_writers_parked) != 0) {
+        hand_off();
+    }
+}
+
+void async_shared_mutex::release() noexcept {
+    auto state = k_writer;
+    if (m_state.compare_exchange_strong(state, 0, std::memory_order_release, std::memory_order_relaxed)) {
+        return;
+    }
+
+    hand_off();
+}
+
+void async_shared_mutex::hand_off() noexcept {
+    details::slist<details::async_shared_mutex_awaiter> granted;
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+
+        /*
+            either a writer is releasing the mutex, or the last reader released it while a writer is parked.
+            in both cases no other thread can modify the state without holding m_lock, so the new owners are
+            installed with a plain store.
+        */
+        const auto state = m_state.load(std::memory_order_acquire);
+        std::uintptr_t new_state = 0;
+
+        if ((state & k_writer) != 0 && !m_parked_readers.empty()) {
+            // readers that parked behind a writer are granted together, before the next writer
+            while (const auto reader = m_parked_readers.pop_front()) {
+                reader->next = nullptr;
+                granted.push_back(*reader);
+                new_state += k_reader;
+            }
+        } else {
+            const auto writer = m_parked_writers.pop_front();
+            assert(writer != nullptr);
+
+            writer->next = nullptr;
+            granted.push_back(*writer);
+            new_state = k_writer;
+
+            if (!m_parked_readers.empty()) {
+                new_state |= k_readers_parked;
+            }
+        }
+
+        if (!m_parked_writers.empty()) {
+            new_state |= k_writers_parked;
+        }
+
+        m_state.store(new_state, std::memory_order_release);
+    }
+
+    while (const auto awaiter = granted.pop_front()) {
+        awaiter->resume();
+    }
+}
+
+concurrencpp::lazy_result<scoped_async_unique_lock> async_shared_mutex::lock_impl(std::shared_ptr<executor> resume_executor) {
+    co_await details::async_shared_mutex_awaiter(*this, *resume_executor, false);
+    co_return scoped_async_unique_lock(*this, std::adopt_lock);
+}
+
+concurrencpp::lazy_result<scoped_async_shared_lock> async_shared_mutex::lock_shared_impl(std::shared_ptr<executor> resume_executor) {
+    co_await details::async_shared_mutex_awaiter(*this, *resume_executor, true);
+    co_return scoped_async_shared_lock(*this, std::adopt_lock);
+}
+
+concurrencpp::lazy_result<scoped_async_unique_lock> async_shared_mutex::lock(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_shared_mutex_lock_null_resume_executor_err_msg);
+    }
+
+    return lock_impl(std::move(resume_executor));
+}
+
+concurrencpp::lazy_result<bool> async_shared_mutex::try_lock() {
+    co_return try_acquire();
+}
+
+void async_shared_mutex::unlock() {
+    if ((m_state.load(std::memory_order_relaxed) & k_writer) == 0) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_async_shared_mutex_unlock_invalid_lock_err_msg);
+    }
+
+    release();
+}
+
+concurrencpp::lazy_result<scoped_async_shared_lock> async_shared_mutex::lock_shared(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_shared_mutex_lock_shared_null_resume_executor_err_msg);
+    }
+
+    return lock_shared_impl(std::move(resume_executor));
+}
+
+concurrencpp::lazy_result<bool> async_shared_mutex::try_lock_shared() {
+    co_return try_acquire_shared();
+}
+
+void async_shared_mutex::unlock_shared() {
+    if (reader_count(m_state.load(std::memory_order_relaxed)) == 0) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_async_shared_mutex_unlock_shared_invalid_lock_err_msg);
+    }
+
+    release_shared();
+}
+
+/*
+ *  scoped_async_unique_lock
+ */
+
+scoped_async_unique_lock::scoped_async_unique_lock(scoped_async_unique_lock&& rhs) noexcept :
+    m_mutex(std::exchange(rhs.m_mutex, nullptr)), m_owns(std::exchange(rhs.m_owns, false)) {}
+
+scoped_async_unique_lock::scoped_async_unique_lock(async_shared_mutex& mutex, std::adopt_lock_t) noexcept : m_mutex(&mutex), m_owns(true) {}
+
+scoped_async_unique_lock::~scoped_async_unique_lock() noexcept {
+    if (m_owns && m_mutex != nullptr) {
+        m_mutex->unlock();
+    }
+}
+
+scoped_async_unique_lock& scoped_async_unique_lock::operator=(scoped_async_unique_lock&& rhs) noexcept {
+    if (this != &rhs) {
+        scoped_async_unique_lock(std::move(rhs)).swap(*this);
+    }
+
+    return *this;
+}
+
+void scoped_async_unique_lock::unlock() {
+    if (!m_owns) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_scoped_async_unique_lock_unlock_invalid_lock_err_msg);
+    } else if (m_mutex != nullptr) {
+        m_mutex->unlock();
+        m_owns = false;
+    }
+}
+
+bool scoped_async_unique_lock::owns_lock() const noexcept {
+    return m_owns;
+}
+
+scoped_async_unique_lock::operator bool() const noexcept {
+    return owns_lock();
+}
+
+void scoped_async_unique_lock::swap(scoped_async_unique_lock& rhs) noexcept {
+    std::swap(m_mutex, rhs.m_mutex);
+    std::swap(m_owns, rhs.m_owns);
+}
+
+async_shared_mutex* scoped_async_unique_lock::release() noexcept {
+    m_owns = false;
+    return std::exchange(m_mutex, nullptr);
+}
+
+async_shared_mutex* scoped_async_unique_lock::mutex() const noexcept {
+    return m_mutex;
+}
+
+/*
+ *  scoped_async_shared_lock
+ */
+
+scoped_async_shared_lock::scoped_async_shared_lock(scoped_async_shared_lock&& rhs) noexcept :
+    m_mutex(std::exchange(rhs.m_mutex, nullptr)), m_owns(std::exchange(rhs.m_owns, false)) {}
+
+scoped_async_shared_lock::scoped_async_shared_lock(async_shared_mutex& mutex, std::adopt_lock_t) noexcept : m_mutex(&mutex), m_owns(true) {}
+
+scoped_async_shared_lock::~scoped_async_shared_lock() noexcept {
+    if (m_owns && m_mutex != nullptr) {
+        m_mutex->unlock_shared();
+    }
+}
+
+scoped_async_shared_lock& scoped_async_shared_lock::operator=(scoped_async_shared_lock&& rhs) noexcept {
+    if (this != &rhs) {
+        scoped_async_shared_lock(std::move(rhs)).swap(*this);
+    }
+
+    return *this;
+}
+
+void scoped_async_shared_lock::unlock() {
+    if (!m_owns) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_scoped_async_shared_lock_unlock_invalid_lock_err_msg);
+    } else if (m_mutex != nullptr) {
+        m_mutex->unlock_shared();
+        m_owns = false;
+    }
+}
+
+bool scoped_async_shared_lock::owns_lock() const noexcept {
+    return m_owns;
+}
+
+scoped_async_shared_lock::operator bool() const noexcept {
+    return owns_lock();
+}
+
+void scoped_async_shared_lock::swap(scoped_async_shared_lock& rhs) noexcept {
+    std::swap(m_mutex, rhs.m_mutex);
+    std::swap(m_owns, rhs.m_owns);
+}
+
+async_shared_mutex* scoped_async_shared_lock::release() noexcept {
+    m_owns = false;
+    return std::exchange(m_mutex, nullptr);
+}
+
+async_shared_mutex* scoped_async_shared_lock::mutex() const noexcept {
+    return m_mutex;
+}
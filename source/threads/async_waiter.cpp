@@ -0,0 +1,98 @@
+#include "concurrencpp/threads/async_waiter.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+
+#include <vector>
+
+using concurrencpp::details::async_waiter;
+
+bool async_waiter::push_to(std::atomic<async_waiter*>& head, async_waiter* closed_list) noexcept {
+    auto current_head = head.load(std::memory_order_acquire);
+
+    while (true) {
+        if (closed_list != nullptr && current_head == closed_list) {
+            return false;
+        }
+
+        next = current_head;
+        if (head.compare_exchange_weak(current_head, this, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return true;
+        }
+    }
+}
+
+async_waiter* async_waiter::reverse(async_waiter* waiters) noexcept {
+    async_waiter* reversed = nullptr;
+    while (waiters != nullptr) {
+        const auto next = waiters->next;
+        waiters->next = reversed;
+        reversed = waiters;
+        waiters = next;
+    }
+
+    return reversed;
+}
+
+void async_waiter::resume_all(async_waiter* waiters) noexcept {
+    size_t count = 0;
+    for (auto waiter = waiters; waiter != nullptr; waiter = waiter->next) {
+        ++count;
+    }
+
+    std::vector<task> tasks;
+
+    try {
+        tasks.reserve(count);
+    } catch (...) {
+        // no memory for batching, every waiter is scheduled on its own.
+        while (waiters != nullptr) {
+            const auto next = waiters->next;
+            try {
+                waiters->resume_executor.post(await_via_functor {waiters->handle, &waiters->interrupted});
+            } catch (...) {
+                // the waiter was resumed inline as interrupted by ~await_via_functor.
+            }
+
+            waiters = next;
+        }
+
+        return;
+    }
+
+    /*
+        every pass schedules all the waiters that share the resume executor of the first remaining waiter.
+        a waiter is destroyed once its coroutine is resumed, so it's not accessed after it's scheduled.
+    */
+    while (waiters != nullptr) {
+        auto& resume_executor = waiters->resume_executor;
+        async_waiter* remaining = nullptr;
+        async_waiter** remaining_tail = &remaining;
+
+        tasks.clear();
+
+        while (waiters != nullptr) {
+            const auto next = waiters->next;
+
+            if (&waiters->resume_executor == &resume_executor) {
+                tasks.emplace_back(await_via_functor {waiters->handle, &waiters->interrupted});
+            } else {
+                *remaining_tail = waiters;
+                remaining_tail = &waiters->next;
+            }
+
+            waiters = next;
+        }
+
+        *remaining_tail = nullptr;
+
+        try {
+            resume_executor.enqueue(std::span<task> {tasks});
+        } catch (...) {
+            // waiters that could not be scheduled are resumed inline as interrupted by ~await_via_functor.
+        }
+
+        waiters = remaining;
+    }
+
+    tasks.clear();
+}
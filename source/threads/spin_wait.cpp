@@ -0,0 +1,67 @@
+#include "concurrencpp/threads/spin_wait.h"
+#include "concurrencpp/threads/constants.h"
+
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+#if defined(CRCPP_MSVC_COMPILER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#elif (defined(CRCPP_GCC_COMPILER) || defined(CRCPP_CLANG_COMPILER)) && (defined(__x86_64__) || defined(__i386__))
+#    include <immintrin.h>
+#endif
+
+using concurrencpp::details::spin_wait;
+
+namespace concurrencpp::details {
+    namespace {
+        size_t default_spin_limit() noexcept {
+            // on a single core machine the producer cannot make progress while we spin.
+            if (std::thread::hardware_concurrency() <= 1) {
+                return 0;
+            }
+
+            return consts::k_default_wait_spin_limit;
+        }
+
+        std::atomic_size_t s_spin_limit {default_spin_limit()};
+
+        thread_local size_t s_tl_spin_budget = consts::k_default_wait_spin_limit;
+    }  // namespace
+}  // namespace concurrencpp::details
+
+size_t spin_wait::begin_spin() noexcept {
+    return std::min(details::s_tl_spin_budget, details::s_spin_limit.load(std::memory_order_relaxed));
+}
+
+void spin_wait::end_spin(size_t polls, bool succeeded) noexcept {
+    auto& budget = details::s_tl_spin_budget;
+    if (succeeded) {
+        budget = std::max({budget, polls * 2, consts::k_min_wait_spin_budget});
+    } else {
+        budget = std::max(budget / 2, consts::k_min_wait_spin_budget);
+    }
+
+    budget = std::min(budget, details::s_spin_limit.load(std::memory_order_relaxed));
+}
+
+void spin_wait::cpu_relax() noexcept {
+#if defined(CRCPP_MSVC_COMPILER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif (defined(CRCPP_GCC_COMPILER) || defined(CRCPP_CLANG_COMPILER)) && (defined(__x86_64__) || defined(__i386__))
+    _mm_pause();
+#elif (defined(CRCPP_GCC_COMPILER) || defined(CRCPP_CLANG_COMPILER)) && defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+void concurrencpp::set_wait_spin_limit(size_t spin_limit) noexcept {
+    details::s_spin_limit.store(spin_limit, std::memory_order_relaxed);
+    details::s_tl_spin_budget = spin_limit;
+}
+
+size_t concurrencpp::wait_spin_limit() noexcept {
+    return details::s_spin_limit.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,240 @@
+#include "concurrencpp/timers/local_timer_shard.h"
+#include "concurrencpp/timers/timer_queue_internal.h"
+
+#include <algorithm>
+
+#include <cassert>
+
+using concurrencpp::timer_queue;
+using concurrencpp::timer_queue_backend;
+using concurrencpp::details::local_timer_shard;
+using concurrencpp::details::local_timer_registry;
+using concurrencpp::details::timer_queue_internal;
+
+using timer_ptr = timer_queue::timer_ptr;
+using request_queue = timer_queue::request_queue;
+
+namespace concurrencpp::details {
+    namespace {
+        thread_local local_timer_shard* s_tl_local_timer_shard = nullptr;
+
+        // marks the shard as processed, timers that are added meanwhile are queued instead of touching the containers.
+        class processing_guard {
+
+           private:
+            bool& m_processing;
+
+           public:
+            processing_guard(bool& processing) noexcept : m_processing(processing) {
+                assert(!m_processing);
+                m_processing = true;
+            }
+
+            ~processing_guard() noexcept {
+                m_processing = false;
+            }
+        };
+    }  // namespace
+}  // namespace concurrencpp::details
+
+/*
+    local_timer_registry
+*/
+
+local_timer_registry::local_timer_registry(timer_queue& queue) noexcept : m_queue(&queue), m_abort(false) {}
+
+void local_timer_registry::attach(local_timer_shard& shard) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_abort) {
+        throw errors::runtime_shutdown(details::consts::k_timer_queue_shutdown_err_msg);
+    }
+
+    m_shards.emplace_back(&shard);
+}
+
+void local_timer_registry::detach(local_timer_shard& shard) noexcept {
+    std::unique_lock<std::mutex> lock(m_lock);
+    const auto shard_it = std::find(m_shards.begin(), m_shards.end(), &shard);
+    if (shard_it != m_shards.end()) {
+        m_shards.erase(shard_it);
+    }
+}
+
+void local_timer_registry::give_back(request_queue& timers) noexcept {
+    size_t not_handed_over = 0;
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        for (auto& timer : timers) {
+            // the queue is shut down only after m_queue is reset, so while it's set, a timer is refused only if the timer
+            // thread can't be started or the timer can't be queued.
+            if (m_queue != nullptr) {
+                try {
+                    m_queue->add_central_timer(timer);
+                    continue;
+                } catch (...) {
+                    // the timer is interrupted below.
+                }
+            }
+
+            std::swap(timers[not_handed_over], timer);
+            ++not_handed_over;
+        }
+    }
+
+    // interrupting a timer might resume a coroutine inline, so it's done without holding the lock.
+    for (size_t i = 0; i < not_handed_over; i++) {
+        timers[i]->interrupt();
+    }
+
+    timers.clear();
+}
+
+void local_timer_registry::shutdown() noexcept {
+    std::unique_lock<std::mutex> lock(m_lock);
+    m_abort = true;
+    m_queue = nullptr;
+
+    for (auto shard : m_shards) {
+        shard->notify_shutdown();
+    }
+}
+
+bool local_timer_registry::shutdown_requested() noexcept {
+    std::unique_lock<std::mutex> lock(m_lock);
+    return m_abort;
+}
+
+/*
+    local_timer_shard
+*/
+
+local_timer_shard::local_timer_shard(std::function<void()> wake_owner) :
+    m_next_deadline(time_point::max()), m_processing(false), m_shutdown_notified(false), m_wake_owner(std::move(wake_owner)) {}
+
+local_timer_shard::~local_timer_shard() noexcept {
+    release_all();
+}
+
+local_timer_shard* local_timer_shard::current() noexcept {
+    return s_tl_local_timer_shard;
+}
+
+void local_timer_shard::set_current(local_timer_shard* shard) noexcept {
+    s_tl_local_timer_shard = shard;
+}
+
+local_timer_shard::entry& local_timer_shard::entry_of(const std::shared_ptr<local_timer_registry>& registry,
+                                                     timer_queue_backend backend) {
+    for (auto& entry : m_entries) {
+        if (entry->registry == registry) {
+            return *entry;
+        }
+    }
+
+    auto new_entry = std::make_unique<entry>();
+    new_entry->registry = registry;
+    new_entry->timers = timer_queue_internal::make(backend);
+
+    m_entries.reserve(m_entries.size() + 1);
+    registry->attach(*this);
+    m_entries.emplace_back(std::move(new_entry));
+    return *m_entries.back();
+}
+
+void local_timer_shard::add(const std::shared_ptr<local_timer_registry>& registry,
+                            timer_queue_backend backend,
+                            timer_ptr new_timer) {
+    auto& entry = entry_of(registry, backend);
+    const auto deadline = new_timer->get_deadline();
+
+    if (m_processing) {
+        entry.requests.emplace_back(std::move(new_timer));
+    } else {
+        entry.timers->add_request(std::move(new_timer));
+    }
+
+    m_next_deadline = std::min(m_next_deadline, deadline);
+}
+
+void local_timer_shard::release_aborted_entries() {
+    std::vector<std::unique_ptr<entry>> aborted_entries;
+
+    for (auto entry_it = m_entries.begin(); entry_it != m_entries.end();) {
+        if ((**entry_it).registry->shutdown_requested()) {
+            aborted_entries.emplace_back(std::move(*entry_it));
+            entry_it = m_entries.erase(entry_it);
+            continue;
+        }
+
+        ++entry_it;
+    }
+
+    // interrupted coroutines might resume inline and add timers to this shard, so the entries are detached first.
+    for (auto& entry : aborted_entries) {
+        entry->timers->interrupt_all();
+
+        for (auto& timer : entry->requests) {
+            timer->interrupt();
+        }
+
+        entry->registry->detach(*this);
+    }
+}
+
+void local_timer_shard::process() {
+    processing_guard guard(m_processing);
+
+    if (m_shutdown_notified.exchange(false, std::memory_order_relaxed)) {
+        release_aborted_entries();
+    }
+
+    // timers that are added while the shard is processed lower m_next_deadline again.
+    m_next_deadline = time_point::max();
+    auto next_deadline = time_point::max();
+
+    // firing a timer might add timers of a new queue, so the entries are indexed and not iterated.
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        auto& entry = *m_entries[i];
+
+        m_requests.swap(entry.requests);
+        entry.timers->process_requests(m_requests);
+        m_requests.clear();
+
+        if (entry.timers->empty()) {
+            continue;
+        }
+
+        const auto entry_deadline = entry.timers->process_expired(clock_type::now());
+        if (!entry.timers->empty()) {
+            next_deadline = std::min(next_deadline, entry_deadline);
+        }
+    }
+
+    m_next_deadline = std::min(m_next_deadline, next_deadline);
+}
+
+void local_timer_shard::release_all() noexcept {
+    assert(!m_processing);
+
+    auto entries = std::move(m_entries);
+    m_entries.clear();
+    m_next_deadline = time_point::max();
+
+    for (auto& entry : entries) {
+        try {
+            entry->timers->take_all(entry->requests);
+        } catch (...) {
+            // nothing was taken, the timers can't be handed over and are interrupted in place.
+            entry->timers->interrupt_all();
+        }
+
+        entry->registry->give_back(entry->requests);
+        entry->registry->detach(*this);
+    }
+}
+
+void local_timer_shard::notify_shutdown() noexcept {
+    m_shutdown_notified.store(true, std::memory_order_relaxed);
+    m_wake_owner();
+}
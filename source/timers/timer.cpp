@@ -4,35 +4,200 @@
 
 #include "concurrencpp/errors.h"
 #include "concurrencpp/results/result.h"
+#include "concurrencpp/results/impl/consumer_context.h"
 #include "concurrencpp/executors/executor.h"
 
+#include <bit>
+#include <algorithm>
+
 using concurrencpp::timer;
 using concurrencpp::details::timer_state;
+using concurrencpp::details::timer_state_ptr;
 using concurrencpp::details::timer_state_base;
+using concurrencpp::details::sleep_timer_state;
+using concurrencpp::details::timeout_timer_state;
+using concurrencpp::details::await_via_functor;
 
-timer_state_base::timer_state_base(size_t due_time,
-                                   size_t frequency,
+timer_state_base::timer_state_base(duration due_time,
+                                   duration frequency,
+                                   duration slack,
                                    std::shared_ptr<concurrencpp::executor> executor,
                                    std::weak_ptr<concurrencpp::timer_queue> timer_queue,
                                    bool is_oneshot) noexcept :
-    m_timer_queue(std::move(timer_queue)),
-    m_executor(std::move(executor)), m_due_time(due_time), m_frequency(frequency), m_deadline(make_deadline(milliseconds(due_time))),
-    m_cancelled(false), m_is_oneshot(is_oneshot) {
+    m_ref_count(0), m_timer_queue(std::move(timer_queue)),
+    m_executor(std::move(executor)), m_due_time(due_time), m_slack(slack), m_frequency(frequency.count()),
+    m_anchor(clock_type::now() + due_time), m_deadline(coalesce_deadline(m_anchor, m_slack)), m_cancelled(false),
+    m_missed_ticks(0), m_is_oneshot(is_oneshot) {
     assert(static_cast<bool>(m_executor));
 }
 
-void timer_state_base::fire() {
-    const auto frequency = m_frequency.load(std::memory_order_relaxed);
-    m_deadline = make_deadline(milliseconds(frequency));
+size_t timer_state_base::rearm(time_point now, duration frequency) noexcept {
+    // the ticks after the one that fires now whose deadlines already passed.
+    const auto missed_ticks = (frequency > duration::zero() && now >= m_anchor + frequency)
+        ? static_cast<size_t>((now - m_anchor) / frequency)
+        : size_t(0);
+
+    if (missed_ticks != 0) {
+        m_missed_ticks.fetch_add(missed_ticks, std::memory_order_relaxed);
+    }
+
+    if (m_policy.schedule == timer_schedule::fixed_delay || frequency <= duration::zero()) {
+        m_anchor = clock_type::now() + frequency;
+        m_deadline = coalesce_deadline(m_anchor, m_slack);
+        return 0;
+    }
+
+    // coalescing may postpone a deadline by up to half a frequency, so it never makes the timer miss a tick.
+    m_anchor += frequency * (missed_ticks + 1);
+    m_deadline = coalesce_deadline(m_anchor, std::min(m_slack, frequency / 2));
+    return missed_ticks;
+}
 
+void timer_state_base::fire(time_point now, std::vector<concurrencpp::task>& tasks) {
     assert(static_cast<bool>(m_executor));
 
-    m_executor->post([self = shared_from_this()]() mutable {
-        self->execute();
-    });
+    auto ticks = size_t(1);
+    if (!m_is_oneshot) {
+        ticks += std::min(rearm(now, get_frequency()), k_max_delivered_ticks);
+    }
+
+    if (ticks == 1 || m_policy.missed_ticks == missed_tick_policy::skip) {
+        tasks.emplace_back([self = timer_state_ptr<timer_state_base>(this)]() mutable {
+            self->execute();
+        });
+        return;
+    }
+
+    if (m_policy.missed_ticks == missed_tick_policy::catch_up) {
+        tasks.emplace_back([self = timer_state_ptr<timer_state_base>(this), ticks]() mutable {
+            for (size_t i = 0; i < ticks; i++) {
+                self->execute();
+            }
+        });
+        return;
+    }
+
+    for (size_t i = 0; i < ticks; i++) {
+        tasks.emplace_back([self = timer_state_ptr<timer_state_base>(this)]() mutable {
+            self->execute();
+        });
+    }
+}
+
+sleep_timer_state::sleep_timer_state(duration due_time,
+                                     duration slack,
+                                     std::shared_ptr<concurrencpp::executor> executor,
+                                     coroutine_handle<void> coro_handle,
+                                     bool* interrupted) noexcept :
+    timer_state_base(due_time, duration(0), slack, std::move(executor), {}, true),
+    m_coro_handle(coro_handle), m_interrupted(interrupted) {}
+
+void sleep_timer_state::execute() {
+    await_via_functor {m_coro_handle, m_interrupted}();
+}
+
+void sleep_timer_state::fire(time_point, std::vector<concurrencpp::task>& tasks) {
+    // the awaiting coroutine may destroy this timer as soon as it resumes, so the task doesn't reference it.
+    tasks.emplace_back(await_via_functor {m_coro_handle, m_interrupted});
+}
+
+void sleep_timer_state::interrupt() noexcept {
+    await_via_functor interrupter {m_coro_handle, m_interrupted};  // resumes the coroutine as interrupted when destroyed.
+}
+
+namespace concurrencpp::details {
+    namespace {
+        // fires a timeout timer, or interrupts it if the executor drops the task without running it.
+        class timeout_timer_functor {
+
+           private:
+            timer_state_ptr<timeout_timer_state> m_state;
+
+           public:
+            timeout_timer_functor(timer_state_ptr<timeout_timer_state> state) noexcept : m_state(std::move(state)) {}
+            timeout_timer_functor(timeout_timer_functor&& rhs) noexcept = default;
+
+            ~timeout_timer_functor() noexcept {
+                if (static_cast<bool>(m_state)) {
+                    m_state->interrupt();
+                }
+            }
+
+            void operator()() {
+                const auto state = std::move(m_state);
+                state->execute();
+            }
+        };
+    }  // namespace
+}  // namespace concurrencpp::details
+
+timeout_timer_state::timeout_timer_state(duration due_time,
+                                         duration slack,
+                                         std::shared_ptr<concurrencpp::executor> executor,
+                                         coroutine_handle<void> coro_handle) noexcept :
+    timer_state_base(due_time, duration(0), slack, std::move(executor), {}, true),
+    m_context(coro_handle) {}
+
+void timeout_timer_state::execute() {
+    // fails if the result completed first, the awaiting coroutine was resumed by its producer then.
+    if (const auto coro_handle = m_context.try_time_out()) {
+        coro_handle();
+    }
+}
+
+void timeout_timer_state::fire(time_point, std::vector<concurrencpp::task>& tasks) {
+    assert(static_cast<bool>(get_executor()));
+    tasks.emplace_back(timeout_timer_functor {timer_state_ptr<timeout_timer_state>(this)});
+}
+
+void timeout_timer_state::interrupt() noexcept {
+    // written before the context is completed, read by the awaiting coroutine only after it.
+    m_interrupted = true;
+
+    if (const auto coro_handle = m_context.try_time_out()) {
+        coro_handle();
+    }
+}
+
+namespace concurrencpp::details {
+    namespace {
+        template<class unit_type>
+        bool coalesce_deadline_in(timer_state_base::time_point deadline,
+                                  timer_state_base::duration slack,
+                                  timer_state_base::time_point& result) noexcept {
+            const auto earliest = static_cast<std::uint64_t>(std::chrono::ceil<unit_type>(deadline.time_since_epoch()).count());
+            const auto latest = static_cast<std::uint64_t>(std::chrono::floor<unit_type>((deadline + slack).time_since_epoch()).count());
+
+            if (latest <= earliest) {
+                return false;
+            }
+
+            // earliest and latest share every bit above the highest one they differ in, where latest has 1 and earliest has 0.
+            // clearing the bits below it gives the coarsest aligned point in between.
+            const auto highest_different_bit = std::bit_width(earliest ^ latest) - 1;
+            const auto aligned = latest & ~((std::uint64_t(1) << highest_different_bit) - 1);
+            result = timer_state_base::time_point(
+                std::chrono::duration_cast<timer_state_base::time_point::duration>(unit_type(static_cast<typename unit_type::rep>(aligned))));
+            return true;
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+timer_state_base::time_point timer_state_base::coalesce_deadline(time_point deadline, duration slack) noexcept {
+    if (slack <= duration(0)) {
+        return deadline;
+    }
+
+    auto coalesced = deadline;
+    if (details::coalesce_deadline_in<milliseconds>(deadline, slack, coalesced)) {
+        return coalesced;
+    }
+
+    details::coalesce_deadline_in<std::chrono::nanoseconds>(deadline, slack, coalesced);
+    return coalesced;
 }
 
-timer::timer(std::shared_ptr<timer_state_base> timer_impl) noexcept : m_state(std::move(timer_impl)) {}
+timer::timer(timer_state_ptr<timer_state_base> timer_impl) noexcept : m_state(std::move(timer_impl)) {}
 
 timer::~timer() noexcept {
     cancel();
@@ -46,14 +211,24 @@ void timer::throw_if_empty(const char* error_message) const {
     throw errors::empty_timer(error_message);
 }
 
-std::chrono::milliseconds timer::get_due_time() const {
+std::chrono::nanoseconds timer::get_due_time() const {
     throw_if_empty(details::consts::k_timer_empty_get_due_time_err_msg);
-    return std::chrono::milliseconds(m_state->get_due_time());
+    return m_state->get_due_time();
+}
+
+std::chrono::nanoseconds timer::get_slack() const {
+    throw_if_empty(details::consts::k_timer_empty_get_slack_err_msg);
+    return m_state->get_slack();
 }
 
-std::chrono::milliseconds timer::get_frequency() const {
+std::chrono::nanoseconds timer::get_frequency() const {
     throw_if_empty(details::consts::k_timer_empty_get_frequency_err_msg);
-    return std::chrono::milliseconds(m_state->get_frequency());
+    return m_state->get_frequency();
+}
+
+size_t timer::get_missed_ticks() const {
+    throw_if_empty(details::consts::k_timer_empty_get_missed_ticks_err_msg);
+    return m_state->get_missed_ticks();
 }
 
 std::shared_ptr<concurrencpp::executor> timer::get_executor() const {
@@ -71,21 +246,14 @@ void timer::cancel() {
         return;
     }
 
-    auto state = std::move(m_state);
+    // the timer_queue thread drops the timer, and destroys its callable, lazily.
+    const auto state = std::move(m_state);
     state->cancel();
-
-    auto timer_queue = state->get_timer_queue().lock();
-
-    if (!static_cast<bool>(timer_queue)) {
-        return;
-    }
-
-    timer_queue->remove_internal_timer(std::move(state));
 }
 
-void timer::set_frequency(std::chrono::milliseconds new_frequency) {
+void timer::set_frequency(std::chrono::nanoseconds new_frequency) {
     throw_if_empty(details::consts::k_timer_empty_set_frequency_err_msg);
-    return m_state->set_new_frequency(new_frequency.count());
+    return m_state->set_new_frequency(new_frequency);
 }
 
 timer& timer::operator=(timer&& rhs) noexcept {
@@ -1,12 +1,12 @@
 #include "concurrencpp/timers/timer.h"
 #include "concurrencpp/timers/timer_queue.h"
+#include "concurrencpp/timers/timer_queue_internal.h"
+#include "concurrencpp/timers/local_timer_shard.h"
 
 #include "concurrencpp/coroutines/coroutine.h"
 #include "concurrencpp/executors/constants.h"
 #include "concurrencpp/executors/executor.h"
-
-#include <set>
-#include <unordered_map>
+#include "concurrencpp/threads/spin_wait.h"
 
 #include <cassert>
 
@@ -14,175 +14,88 @@ using namespace std::chrono;
 
 using concurrencpp::timer;
 using concurrencpp::timer_queue;
-using concurrencpp::details::timer_request;
+using concurrencpp::timer_queue_backend;
+using concurrencpp::details::sleep_awaitable;
 using concurrencpp::details::timer_state_base;
+using concurrencpp::details::timer_queue_internal;
 
 using timer_ptr = timer_queue::timer_ptr;
 using time_point = timer_queue::time_point;
 using request_queue = timer_queue::request_queue;
 
-namespace concurrencpp::details {
-    namespace {
-        struct deadline_comparator {
-            bool operator()(const timer_ptr& a, const timer_ptr& b) const noexcept {
-                return a->get_deadline() < b->get_deadline();
-            }
-        };
-
-        class timer_queue_internal {
-            using timer_set = std::multiset<timer_ptr, deadline_comparator>;
-            using timer_set_iterator = typename timer_set::iterator;
-            using iterator_map = std::unordered_map<timer_ptr, timer_set_iterator>;
-
-           private:
-            timer_set m_timers;
-            iterator_map m_iterator_mapper;
-
-            void add_timer_internal(timer_ptr new_timer) {
-                assert(m_iterator_mapper.find(new_timer) == m_iterator_mapper.end());
-                auto timer_it = m_timers.emplace(new_timer);
-                m_iterator_mapper.emplace(std::move(new_timer), timer_it);
-            }
-
-            void remove_timer_internal(timer_ptr existing_timer) {
-                auto timer_it = m_iterator_mapper.find(existing_timer);
-                if (timer_it == m_iterator_mapper.end()) {
-                    assert(existing_timer->is_oneshot() || existing_timer->cancelled());  // the timer was already deleted by
-                                                                                          // the queue when it was fired.
-                    return;
-                }
-
-                auto set_iterator = timer_it->second;
-                m_timers.erase(set_iterator);
-                m_iterator_mapper.erase(timer_it);
-            }
-
-            void process_request_queue(request_queue& queue) {
-                for (auto& request : queue) {
-                    auto& timer_ptr = request.first;
-                    const auto opt = request.second;
-
-                    if (opt == timer_request::add) {
-                        add_timer_internal(std::move(timer_ptr));
-                    } else {
-                        remove_timer_internal(std::move(timer_ptr));
-                    }
-                }
-            }
-
-            void reset_containers_memory() noexcept {
-                assert(empty());
-                timer_set timers;
-                std::swap(m_timers, timers);
-                iterator_map iterator_mapper;
-                std::swap(m_iterator_mapper, iterator_mapper);
-            }
+sleep_awaitable::sleep_awaitable(timer_queue& parent_queue,
+                                 timer_state_base::duration due_time,
+                                 timer_state_base::duration slack,
+                                 std::shared_ptr<concurrencpp::executor> executor) noexcept :
+    m_parent_queue(parent_queue),
+    m_due_time(due_time), m_slack(slack), m_executor(std::move(executor)) {}
+
+bool sleep_awaitable::await_suspend(details::coroutine_handle<void> coro_handle) noexcept {
+    const auto slack = std::max(m_slack, timer_state_base::duration(m_parent_queue.m_coalescing_window));
+    auto& timer = m_timer.emplace(m_due_time, slack, std::move(m_executor), coro_handle, &m_interrupted);
+
+    try {
+        // the timer is owned by the awaitable, so the timer_queue gets a pointer that shares no ownership.
+        m_parent_queue.add_timer(timer_ptr::borrow(timer));
+    } catch (...) {
+        m_interrupted = true;
+        return false;
+    }
 
-           public:
-            bool empty() const noexcept {
-                assert(m_iterator_mapper.size() == m_timers.size());
-                return m_timers.empty();
-            }
+    return true;
+}
 
-            ::time_point process_timers(request_queue& queue) {
-                process_request_queue(queue);
-
-                const auto now = high_resolution_clock::now();
-
-                while (true) {
-                    if (m_timers.empty()) {
-                        break;
-                    }
-
-                    timer_set temp_set;
-
-                    auto first_timer_it = m_timers.begin();  // closest deadline
-                    auto timer_ptr = *first_timer_it;
-                    const auto is_oneshot = timer_ptr->is_oneshot();
-
-                    if (!timer_ptr->expired(now)) {
-                        // if this timer is not expired, the next ones are guaranteed not to, as
-                        // the set is ordered by deadlines.
-                        break;
-                    }
-
-                    // we are going to modify the timer, so first we extract it
-                    auto timer_node = m_timers.extract(first_timer_it);
-
-                    // we cannot use the naked node_handle according to the standard. it must
-                    // be contained somewhere.
-                    auto temp_it = temp_set.insert(std::move(timer_node));
-
-                    // we fire it only if it's not cancelled
-                    const auto cancelled = timer_ptr->cancelled();
-                    if (!cancelled) {
-                        (*temp_it)->fire();
-                    }
-
-                    if (is_oneshot || cancelled) {
-                        m_iterator_mapper.erase(timer_ptr);
-                        continue;  // let the timer die inside temp_set
-                    }
-
-                    // regular timer, re-insert into the right position
-                    timer_node = temp_set.extract(temp_it);
-                    auto new_it = m_timers.insert(std::move(timer_node));
-                    // AppleClang doesn't have std::unordered_map::contains yet
-                    assert(m_iterator_mapper.find(timer_ptr) != m_iterator_mapper.end());
-                    m_iterator_mapper[timer_ptr] = new_it;  // update the iterator map, multiset::extract invalidates the
-                    // timer
-                }
-
-                if (m_timers.empty()) {
-                    reset_containers_memory();
-                    return now + std::chrono::hours(24);
-                }
-
-                // get the closest deadline.
-                return (**m_timers.begin()).get_deadline();
-            }
-        };
-    }  // namespace
-}  // namespace concurrencpp::details
+void sleep_awaitable::await_resume() const {
+    if (m_interrupted) {
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+}
 
 timer_queue::timer_queue(milliseconds max_waiting_time,
                          const std::function<void(std::string_view thread_name)>& thread_started_callback,
-                         const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
-    m_thread_started_callback(thread_started_callback),
-    m_thread_terminated_callback(thread_terminated_callback), m_atomic_abort(false), m_abort(false), m_idle(true),
-    m_max_waiting_time(max_waiting_time) {}
+                         const std::function<void(std::string_view thread_name)>& thread_terminated_callback,
+                         timer_queue_backend backend,
+                         milliseconds coalescing_window,
+                         bool worker_local_timers,
+                         microseconds spin_window) :
+    m_atomic_abort(false),
+    m_abort(false), m_idle(true), m_max_waiting_time(max_waiting_time), m_backend(backend), m_coalescing_window(coalescing_window),
+    m_spin_window(spin_window),
+    m_local_timers(worker_local_timers ? std::make_shared<details::local_timer_registry>(*this) : nullptr),
+    m_thread_started_callback(thread_started_callback), m_thread_terminated_callback(thread_terminated_callback) {}
 
 timer_queue::~timer_queue() noexcept {
     shutdown();
     assert(!m_worker.joinable());
 }
 
-void timer_queue::add_internal_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer) {
-    assert(lock.owns_lock());
-    m_request_queue.emplace_back(std::move(new_timer), timer_request::add);
-    lock.unlock();
-
-    m_condition.notify_one();
-}
+void timer_queue::add_timer(timer_ptr new_timer) {
+    // a thread_pool worker keeps the timers it creates and fires them itself, without locking anything.
+    if (static_cast<bool>(m_local_timers)) {
+        if (const auto local_shard = details::local_timer_shard::current()) {
+            if (shutdown_requested()) {
+                throw errors::runtime_shutdown(details::consts::k_timer_queue_shutdown_err_msg);
+            }
 
-void timer_queue::remove_internal_timer(timer_ptr existing_timer) {
-    {
-        std::unique_lock<decltype(m_lock)> lock(m_lock);
-        m_request_queue.emplace_back(std::move(existing_timer), timer_request::remove);
+            local_shard->add(m_local_timers, m_backend, std::move(new_timer));
+            return;
+        }
     }
 
-    m_condition.notify_one();
+    add_central_timer(std::move(new_timer));
 }
 
-void timer_queue::add_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer) {
-    assert(lock.owns_lock());
-
+void timer_queue::add_central_timer(timer_ptr new_timer) {
+    std::unique_lock<std::mutex> lock(m_lock);
     if (m_abort) {
         throw errors::runtime_shutdown(details::consts::k_timer_queue_shutdown_err_msg);
     }
 
     auto old_thread = ensure_worker_thread(lock);
-    add_internal_timer(lock, new_timer);
+    m_request_queue.emplace_back(std::move(new_timer));
+    lock.unlock();
+
+    m_condition.notify_one();
 
     if (old_thread.joinable()) {
         old_thread.join();
@@ -191,11 +104,12 @@ void timer_queue::add_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_ti
 
 void timer_queue::work_loop() {
     time_point next_deadline;
-    details::timer_queue_internal internal_state;
+    const auto internal_state = timer_queue_internal::make(m_backend);
+    request_queue requests;  // swapped with m_request_queue, so neither of them is reallocated once it grew.
 
     while (true) {
         std::unique_lock<decltype(m_lock)> lock(m_lock);
-        if (internal_state.empty()) {
+        if (internal_state->empty()) {
             const auto res = m_condition.wait_for(lock, m_max_waiting_time, [this] {
                 return !m_request_queue.empty() || m_abort;
             });
@@ -207,26 +121,50 @@ void timer_queue::work_loop() {
             }
 
         } else {
-            m_condition.wait_until(lock, next_deadline, [this] {
-                return !m_request_queue.empty() || m_abort;
-            });
+            wait_for_deadline(lock, next_deadline);
         }
 
         if (m_abort) {
+            lock.unlock();
+            internal_state->interrupt_all();
             return;
         }
 
-        auto request_queue = std::move(m_request_queue);
+        requests.swap(m_request_queue);
         lock.unlock();
 
-        next_deadline = internal_state.process_timers(request_queue);
-        const auto now = clock_type::now();
-        if (next_deadline <= now) {
-            continue;
-        }
+        next_deadline = internal_state->process_timers(requests);
+        requests.clear();
     }
 }
 
+void timer_queue::wait_for_deadline(std::unique_lock<std::mutex>& lock, time_point deadline) {
+    assert(lock.owns_lock());
+
+    const auto has_work = [this] {
+        return !m_request_queue.empty() || m_abort;
+    };
+
+    if (m_spin_window == microseconds(0)) {
+        m_condition.wait_until(lock, deadline, has_work);
+        return;
+    }
+
+    // a blocking wait wakes up tens of microseconds late, so the thread blocks until the spin window
+    // before the deadline and polls the clock for the rest of it.
+    if (m_condition.wait_until(lock, deadline - m_spin_window, has_work)) {
+        return;
+    }
+
+    lock.unlock();
+
+    while (clock_type::now() < deadline) {
+        details::spin_wait::cpu_relax();
+    }
+
+    lock.lock();
+}
+
 bool timer_queue::shutdown_requested() const noexcept {
     return m_atomic_abort.load(std::memory_order_relaxed);
 }
@@ -237,6 +175,11 @@ void timer_queue::shutdown() {
         return;  // timer_queue has been shut down already.
     }
 
+    // workers interrupt their local timers of this queue on their own thread.
+    if (static_cast<bool>(m_local_timers)) {
+        m_local_timers->shutdown();
+    }
+
     std::unique_lock<std::mutex> lock(m_lock);
     m_abort = true;
 
@@ -244,11 +187,15 @@ void timer_queue::shutdown() {
         return;  // nothing to shut down
     }
 
-    m_request_queue.clear();
+    auto pending_requests = std::move(m_request_queue);
     lock.unlock();
 
     m_condition.notify_all();
     m_worker.join();
+
+    for (auto& timer : pending_requests) {
+        timer->interrupt();
+    }
 }
 
 concurrencpp::details::thread timer_queue::ensure_worker_thread(std::unique_lock<std::mutex>& lock) {
@@ -271,30 +218,35 @@ concurrencpp::details::thread timer_queue::ensure_worker_thread(std::unique_lock
     return old_worker;
 }
 
-concurrencpp::lazy_result<void> timer_queue::make_delay_object_impl(std::chrono::milliseconds due_time,
+concurrencpp::lazy_result<void> timer_queue::make_delay_object_impl(duration due_time,
+                                                                    duration slack,
                                                                     std::shared_ptr<concurrencpp::timer_queue> self,
                                                                     std::shared_ptr<concurrencpp::executor> executor) {
     class delay_object_awaitable : public details::suspend_always {
 
        private:
-        const size_t m_due_time_ms;
+        const duration m_due_time;
+        const duration m_slack;
         timer_queue& m_parent_queue;
         std::shared_ptr<concurrencpp::executor> m_executor;
         bool m_interrupted = false;
 
        public:
-        delay_object_awaitable(size_t due_time_ms,
+        delay_object_awaitable(duration due_time,
+                               duration slack,
                                timer_queue& parent_queue,
                                std::shared_ptr<concurrencpp::executor> executor) noexcept :
-            m_due_time_ms(due_time_ms),
-            m_parent_queue(parent_queue), m_executor(std::move(executor)) {}
+            m_due_time(due_time),
+            m_slack(slack), m_parent_queue(parent_queue), m_executor(std::move(executor)) {}
 
         void await_suspend(details::coroutine_handle<void> coro_handle) noexcept {
             try {
-                m_parent_queue.make_timer_impl(m_due_time_ms,
-                                               0,
+                m_parent_queue.make_timer_impl(m_due_time,
+                                               duration(0),
+                                               m_slack,
                                                std::move(m_executor),
                                                true,
+                                               timer_policy {},
                                                details::await_via_functor {coro_handle, &m_interrupted});
 
             } catch (...) {
@@ -309,18 +261,75 @@ concurrencpp::lazy_result<void> timer_queue::make_delay_object_impl(std::chrono:
         }
     };
 
-    co_await delay_object_awaitable {static_cast<size_t>(due_time.count()), *this, std::move(executor)};
+    co_await delay_object_awaitable {due_time, slack, *this, std::move(executor)};
+}
+
+concurrencpp::lazy_result<void> timer_queue::make_delay_object(duration due_time, std::shared_ptr<executor> executor) {
+    if (!static_cast<bool>(executor)) {
+        throw std::invalid_argument(details::consts::k_timer_queue_make_delay_object_executor_null_err_msg);
+    }
+
+    return make_delay_object_impl(due_time, duration(0), shared_from_this(), std::move(executor));
 }
 
-concurrencpp::lazy_result<void> timer_queue::make_delay_object(std::chrono::milliseconds due_time,
+concurrencpp::lazy_result<void> timer_queue::make_delay_object(duration due_time,
+                                                               duration slack,
                                                                std::shared_ptr<executor> executor) {
     if (!static_cast<bool>(executor)) {
         throw std::invalid_argument(details::consts::k_timer_queue_make_delay_object_executor_null_err_msg);
     }
 
-    return make_delay_object_impl(due_time, shared_from_this(), std::move(executor));
+    return make_delay_object_impl(due_time, slack, shared_from_this(), std::move(executor));
+}
+
+sleep_awaitable timer_queue::sleep_for(duration due_time, std::shared_ptr<executor> executor) {
+    if (!static_cast<bool>(executor)) {
+        throw std::invalid_argument(details::consts::k_timer_queue_sleep_for_executor_null_err_msg);
+    }
+
+    return {*this, due_time, duration(0), std::move(executor)};
+}
+
+sleep_awaitable timer_queue::sleep_for(duration due_time, duration slack, std::shared_ptr<executor> executor) {
+    if (!static_cast<bool>(executor)) {
+        throw std::invalid_argument(details::consts::k_timer_queue_sleep_for_executor_null_err_msg);
+    }
+
+    return {*this, due_time, slack, std::move(executor)};
+}
+
+sleep_awaitable timer_queue::sleep_until(time_point deadline, std::shared_ptr<executor> executor) {
+    if (!static_cast<bool>(executor)) {
+        throw std::invalid_argument(details::consts::k_timer_queue_sleep_until_executor_null_err_msg);
+    }
+
+    return {*this, deadline - clock_type::now(), duration(0), std::move(executor)};
+}
+
+sleep_awaitable timer_queue::sleep_until(time_point deadline, duration slack, std::shared_ptr<executor> executor) {
+    if (!static_cast<bool>(executor)) {
+        throw std::invalid_argument(details::consts::k_timer_queue_sleep_until_executor_null_err_msg);
+    }
+
+    return {*this, deadline - clock_type::now(), slack, std::move(executor)};
 }
 
 milliseconds timer_queue::max_worker_idle_time() const noexcept {
     return m_max_waiting_time;
 }
+
+timer_queue_backend timer_queue::backend() const noexcept {
+    return m_backend;
+}
+
+milliseconds timer_queue::coalescing_window() const noexcept {
+    return m_coalescing_window;
+}
+
+bool timer_queue::worker_local_timers() const noexcept {
+    return static_cast<bool>(m_local_timers);
+}
+
+microseconds timer_queue::spin_window() const noexcept {
+    return m_spin_window;
+}
@@ -0,0 +1,519 @@
+#include "concurrencpp/timers/timer_queue_internal.h"
+#include "concurrencpp/executors/executor.h"
+
+#include <bit>
+#include <iterator>
+#include <algorithm>
+
+#include <cassert>
+
+using namespace std::chrono;
+
+using concurrencpp::timer_queue_backend;
+using concurrencpp::details::timer_batch;
+using concurrencpp::details::timing_wheel;
+using concurrencpp::details::ordered_timer_set;
+using concurrencpp::details::timer_state_base;
+using concurrencpp::details::timer_queue_internal;
+using concurrencpp::details::timing_wheel_position;
+
+using timer_ptr = timer_queue_internal::timer_ptr;
+
+/*
+    timer_batch
+*/
+
+timer_batch::executor_group& timer_batch::group_of(const std::shared_ptr<concurrencpp::executor>& executor) {
+    // timers of the same executor tend to expire together, so the last group is checked first.
+    if (m_last_group < m_group_count && m_groups[m_last_group].executor == executor) {
+        return m_groups[m_last_group];
+    }
+
+    for (size_t i = 0; i < m_group_count; i++) {
+        if (m_groups[i].executor == executor) {
+            m_last_group = i;
+            return m_groups[i];
+        }
+    }
+
+    if (m_group_count == m_groups.size()) {
+        m_groups.emplace_back();
+    }
+
+    m_last_group = m_group_count++;
+    auto& group = m_groups[m_last_group];
+    group.executor = executor;
+    return group;
+}
+
+void timer_batch::add(timer_state_base& timer) {
+    auto& group = group_of(timer.get_executor());
+    timer.fire(m_now, group.tasks);
+}
+
+void timer_batch::dispatch() noexcept {
+    for (size_t i = 0; i < m_group_count; i++) {
+        auto& group = m_groups[i];
+
+        try {
+            if (group.tasks.size() == 1) {
+                group.executor->enqueue(std::move(group.tasks[0]));
+            } else {
+                group.executor->enqueue(std::span<concurrencpp::task> {group.tasks});
+            }
+        } catch (...) {
+            // the executor was shut down. the tasks are destroyed below, which interrupts awaiting coroutines.
+        }
+
+        group.tasks.clear();
+        group.executor.reset();
+    }
+
+    m_group_count = 0;
+    m_last_group = 0;
+}
+
+/*
+    timer_queue_internal
+*/
+
+void timer_queue_internal::add_request(timer_ptr new_timer) {
+    // timers that were cancelled before they reached the container, like timeouts of results that completed in time.
+    if (new_timer->cancelled()) {
+        return;
+    }
+
+    add(std::move(new_timer));
+    ++m_added_since_sweep;
+
+    if (m_added_since_sweep < std::max(m_size_after_sweep, k_min_sweep_interval)) {
+        return;
+    }
+
+    remove_cancelled();
+    m_added_since_sweep = 0;
+    m_size_after_sweep = size();
+}
+
+void timer_queue_internal::process_requests(request_queue& queue) {
+    for (auto& timer : queue) {
+        add_request(std::move(timer));
+    }
+}
+
+timer_queue_internal::time_point timer_queue_internal::process_timers(request_queue& queue) {
+    process_requests(queue);
+    return process_expired(timer_queue::clock_type::now());
+}
+
+std::unique_ptr<timer_queue_internal> timer_queue_internal::make(timer_queue_backend backend) {
+    switch (backend) {
+        case timer_queue_backend::timing_wheel: {
+            return std::make_unique<timing_wheel>();
+        }
+
+        case timer_queue_backend::ordered_set: {
+            return std::make_unique<ordered_timer_set>();
+        }
+    }
+
+    assert(false);
+    return std::make_unique<ordered_timer_set>();
+}
+
+/*
+    ordered_timer_set
+*/
+
+void ordered_timer_set::recycle(timer_set::node_type timer_node) noexcept {
+    timer_node.value().reset();
+
+    try {
+        m_free_timer_nodes.emplace_back(std::move(timer_node));
+    } catch (...) {
+        // the node is freed instead.
+    }
+}
+
+bool ordered_timer_set::empty() const noexcept {
+    return m_timers.empty();
+}
+
+size_t ordered_timer_set::size() const noexcept {
+    return m_timers.size();
+}
+
+void ordered_timer_set::add(timer_ptr new_timer) {
+    if (m_free_timer_nodes.empty()) {
+        m_timers.emplace(std::move(new_timer));
+        return;
+    }
+
+    auto timer_node = std::move(m_free_timer_nodes.back());
+    m_free_timer_nodes.pop_back();
+
+    timer_node.value() = std::move(new_timer);
+    m_timers.insert(std::move(timer_node));
+}
+
+timer_queue_internal::time_point ordered_timer_set::process_expired(time_point now) {
+    m_batch.set_now(now);
+
+    while (!m_timers.empty()) {
+        auto first_timer_it = m_timers.begin();  // closest deadline
+        if (!(**first_timer_it).expired(now)) {
+            // if this timer is not expired, the next ones are guaranteed not to, as
+            // the set is ordered by deadlines.
+            break;
+        }
+
+        // firing a timer changes its deadline, so it is extracted first. the node is re-inserted as is if the timer is
+        // periodic, or kept for the next timer that is added if it isn't, so no timer is copied or allocated.
+        auto timer_node = m_timers.extract(first_timer_it);
+        auto& timer = *timer_node.value();
+
+        // we fire it only if it's not cancelled
+        const auto cancelled = timer.cancelled();
+        if (!cancelled) {
+            m_batch.add(timer);
+        }
+
+        if (timer.is_oneshot() || cancelled) {
+            recycle(std::move(timer_node));  // its task holds its own reference.
+            continue;
+        }
+
+        // regular timer, re-insert into the right position.
+        m_timers.insert(std::move(timer_node));
+    }
+
+    m_batch.dispatch();
+
+    if (m_timers.empty()) {
+        return now + std::chrono::hours(24);
+    }
+
+    // get the closest deadline.
+    return (**m_timers.begin()).get_deadline();
+}
+
+void ordered_timer_set::interrupt_all() noexcept {
+    for (auto& timer : m_timers) {
+        timer->interrupt();
+    }
+}
+
+void ordered_timer_set::remove_cancelled() noexcept {
+    for (auto timer_it = m_timers.begin(); timer_it != m_timers.end();) {
+        const auto next_it = std::next(timer_it);
+        if ((**timer_it).cancelled()) {
+            recycle(m_timers.extract(timer_it));
+        }
+
+        timer_it = next_it;
+    }
+}
+
+void ordered_timer_set::take_all(request_queue& timers) {
+    timers.reserve(timers.size() + m_timers.size());
+
+    while (!m_timers.empty()) {
+        auto timer_node = m_timers.extract(m_timers.begin());
+        timers.emplace_back(std::move(timer_node.value()));
+        recycle(std::move(timer_node));
+    }
+}
+
+/*
+    timing_wheel
+*/
+
+timing_wheel::timing_wheel() :
+    m_buckets(k_bucket_count), m_occupied(), m_origin(timer_queue::clock_type::now()), m_current_tick(0), m_size(0) {}
+
+timing_wheel::tick_type timing_wheel::deadline_tick(time_point deadline) const noexcept {
+    if (deadline <= m_origin) {
+        return 0;
+    }
+
+    // rounded up, a timer never fires before its deadline.
+    const auto diff = duration_cast<nanoseconds>(deadline - m_origin).count();
+    constexpr auto tick_ns = duration_cast<nanoseconds>(milliseconds(1)).count();
+    return static_cast<tick_type>((diff + tick_ns - 1) / tick_ns);
+}
+
+timing_wheel::tick_type timing_wheel::elapsed_ticks(time_point now) const noexcept {
+    if (now <= m_origin) {
+        return 0;
+    }
+
+    return static_cast<tick_type>(duration_cast<milliseconds>(now - m_origin).count());
+}
+
+size_t timing_wheel::bucket_of(tick_type tick) const noexcept {
+    if (tick <= m_current_tick) {
+        return k_expired_bucket;
+    }
+
+    const auto highest_different_bit = static_cast<size_t>(std::bit_width(tick ^ m_current_tick)) - 1;
+    const auto level = highest_different_bit / k_level_bits;
+    if (level >= k_levels) {
+        return k_overflow_bucket;
+    }
+
+    const auto slot = static_cast<size_t>(tick >> (level * k_level_bits)) & (k_slots_per_level - 1);
+    return level * k_slots_per_level + slot;
+}
+
+void timing_wheel::mark_occupied(size_t bucket) noexcept {
+    if (bucket >= k_overflow_bucket) {
+        return;
+    }
+
+    const auto level = bucket / k_slots_per_level;
+    const auto slot = bucket % k_slots_per_level;
+    m_occupied[level][slot / 64] |= std::uint64_t(1) << (slot % 64);
+}
+
+void timing_wheel::mark_vacant(size_t bucket) noexcept {
+    if (bucket >= k_overflow_bucket) {
+        return;
+    }
+
+    const auto level = bucket / k_slots_per_level;
+    const auto slot = bucket % k_slots_per_level;
+    m_occupied[level][slot / 64] &= ~(std::uint64_t(1) << (slot % 64));
+}
+
+void timing_wheel::link(timer_ptr timer, tick_type tick) {
+    const auto bucket_index = bucket_of(tick);
+    auto& bucket = m_buckets[bucket_index];
+    auto& position = timer->wheel_position();
+    assert(position.bucket == timing_wheel_position::k_unlinked);
+
+    bucket.emplace_back(std::move(timer));
+    position.bucket = bucket_index;
+
+    mark_occupied(bucket_index);
+    ++m_size;
+}
+
+std::optional<timing_wheel::tick_type> timing_wheel::next_event_tick() const noexcept {
+    if (!m_buckets[k_expired_bucket].empty()) {
+        return m_current_tick;
+    }
+
+    /*
+        a lower level always holds earlier deadlines than the levels above it, so the first occupied slot
+        that comes after the current one, scanning the levels bottom up, is the next event.
+        for levels above the first one, the event is the tick at which the slot starts and has to be cascaded.
+    */
+    for (size_t level = 0; level < k_levels; level++) {
+        const auto shift = level * k_level_bits;
+        const auto current_slot = static_cast<size_t>(m_current_tick >> shift) & (k_slots_per_level - 1);
+        const auto& occupied = m_occupied[level];
+
+        for (size_t slot = current_slot + 1; slot < k_slots_per_level;) {
+            const auto word = occupied[slot / 64] >> (slot % 64);
+            if (word == 0) {
+                slot = (slot / 64 + 1) * 64;
+                continue;
+            }
+
+            const auto found_slot = slot + static_cast<size_t>(std::countr_zero(word));
+            const auto rotation_start = (m_current_tick >> (shift + k_level_bits)) << (shift + k_level_bits);
+            return rotation_start + (static_cast<tick_type>(found_slot) << shift);
+        }
+    }
+
+    if (!m_buckets[k_overflow_bucket].empty()) {
+        return ((m_current_tick >> k_wheel_bits) + 1) << k_wheel_bits;
+    }
+
+    return std::nullopt;
+}
+
+void timing_wheel::cascade(size_t bucket_index) {
+    auto& bucket = m_buckets[bucket_index];
+    if (bucket.empty()) {
+        return;
+    }
+
+    auto cascaded = std::move(bucket);
+    bucket.clear();
+    mark_vacant(bucket_index);
+    m_size -= cascaded.size();
+
+    for (auto& timer : cascaded) {
+        timer->wheel_position().bucket = timing_wheel_position::k_unlinked;
+        const auto tick = deadline_tick(timer->get_deadline());
+        link(std::move(timer), tick);
+    }
+
+    // reuse the capacity for the next timers that land in this slot. the overflow bucket might have been refilled.
+    if (bucket.empty() && cascaded.capacity() > bucket.capacity()) {
+        cascaded.clear();
+        bucket.swap(cascaded);
+    }
+}
+
+void timing_wheel::fire_bucket(size_t bucket_index) {
+    auto& bucket = m_buckets[bucket_index];
+    if (bucket.empty()) {
+        return;
+    }
+
+    assert(m_firing.empty());
+    m_firing.swap(bucket);
+    mark_vacant(bucket_index);
+    m_size -= m_firing.size();
+
+    for (auto& timer : m_firing) {
+        timer->wheel_position().bucket = timing_wheel_position::k_unlinked;
+    }
+
+    for (auto& timer : m_firing) {
+        if (timer->cancelled()) {
+            continue;
+        }
+
+        m_batch.add(*timer);
+
+        if (timer->is_oneshot()) {
+            continue;
+        }
+
+        // a periodic timer re-armed with a zero frequency fires again on the next tick, not in this one.
+        const auto tick = std::max(deadline_tick(timer->get_deadline()), m_current_tick + 1);
+        link(std::move(timer), tick);
+    }
+
+    m_firing.clear();
+    if (m_firing.capacity() > bucket.capacity()) {
+        m_firing.swap(bucket);
+    }
+}
+
+void timing_wheel::advance_to(tick_type tick) {
+    assert(tick >= m_current_tick);
+    m_current_tick = tick;
+
+    // cascade top down, so a timer that moves from a higher level lands in a slot that is cascaded next (or fired).
+    if ((tick & ((tick_type(1) << k_wheel_bits) - 1)) == 0) {
+        cascade(k_overflow_bucket);
+    }
+
+    for (size_t level = k_levels - 1; level > 0; level--) {
+        const auto shift = level * k_level_bits;
+        if ((tick & ((tick_type(1) << shift) - 1)) != 0) {
+            continue;
+        }
+
+        const auto slot = static_cast<size_t>(tick >> shift) & (k_slots_per_level - 1);
+        cascade(level * k_slots_per_level + slot);
+    }
+
+    fire_bucket(static_cast<size_t>(tick) & (k_slots_per_level - 1));
+}
+
+bool timing_wheel::empty() const noexcept {
+    return m_size == 0;
+}
+
+size_t timing_wheel::size() const noexcept {
+    return m_size;
+}
+
+void timing_wheel::add(timer_ptr new_timer) {
+    const auto tick = deadline_tick(new_timer->get_deadline());
+    link(std::move(new_timer), tick);
+}
+
+timer_queue_internal::time_point timing_wheel::process_expired(time_point now) {
+    const auto target_tick = std::max(elapsed_ticks(now), m_current_tick);
+    m_batch.set_now(now);
+
+    // timers that were added with a deadline that already passed.
+    fire_bucket(k_expired_bucket);
+
+    while (true) {
+        const auto next_tick = next_event_tick();
+        if (!next_tick.has_value() || *next_tick > target_tick) {
+            break;
+        }
+
+        if (*next_tick == m_current_tick) {
+            fire_bucket(k_expired_bucket);
+            continue;
+        }
+
+        advance_to(*next_tick);
+    }
+
+    m_current_tick = target_tick;
+    m_batch.dispatch();
+
+    if (empty()) {
+        return now + std::chrono::hours(24);
+    }
+
+    const auto next_tick = next_event_tick();
+    assert(next_tick.has_value());
+    return m_origin + milliseconds(*next_tick);
+}
+
+void timing_wheel::interrupt_all() noexcept {
+    for (auto& bucket : m_buckets) {
+        for (auto& timer : bucket) {
+            timer->interrupt();
+        }
+    }
+}
+
+void timing_wheel::remove_cancelled() noexcept {
+    for (size_t bucket_index = 0; bucket_index < k_bucket_count; bucket_index++) {
+        auto& bucket = m_buckets[bucket_index];
+        if (bucket.empty()) {
+            continue;
+        }
+
+        // compacts the bucket in place, the timers that remain keep their order.
+        size_t kept = 0;
+        for (size_t i = 0; i < bucket.size(); i++) {
+            if (bucket[i]->cancelled()) {
+                bucket[i]->wheel_position().bucket = timing_wheel_position::k_unlinked;
+                continue;
+            }
+
+            if (kept != i) {
+                bucket[kept] = std::move(bucket[i]);
+            }
+
+            ++kept;
+        }
+
+        m_size -= bucket.size() - kept;
+        bucket.erase(bucket.begin() + kept, bucket.end());
+
+        if (bucket.empty()) {
+            mark_vacant(bucket_index);
+        }
+    }
+}
+
+void timing_wheel::take_all(request_queue& timers) {
+    timers.reserve(timers.size() + m_size);
+
+    for (size_t bucket_index = 0; bucket_index < k_bucket_count; bucket_index++) {
+        auto& bucket = m_buckets[bucket_index];
+        for (auto& timer : bucket) {
+            timer->wheel_position().bucket = timing_wheel_position::k_unlinked;
+            timers.emplace_back(std::move(timer));
+        }
+
+        bucket.clear();
+        mark_vacant(bucket_index);
+    }
+
+    m_size = 0;
+}
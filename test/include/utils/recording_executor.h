@@ -0,0 +1,91 @@
+#ifndef CONCURRENCPP_RECORDING_EXECUTOR_H
+#define CONCURRENCPP_RECORDING_EXECUTOR_H
+
+#include "concurrencpp/executors/executor.h"
+
+#include <mutex>
+#include <vector>
+
+namespace concurrencpp::tests {
+    // queues tasks like manual_executor, and counts how many enqueue calls scheduled them.
+    class recording_executor : public concurrencpp::executor {
+
+       private:
+        mutable std::mutex m_lock;
+        std::vector<concurrencpp::task> m_tasks;
+        size_t m_enqueue_calls = 0;
+        bool m_shutdown = false;
+
+       public:
+        recording_executor() : executor("recording_executor") {}
+
+        void enqueue(concurrencpp::task task) override {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (m_shutdown) {
+                concurrencpp::details::throw_runtime_shutdown_exception(name);
+            }
+
+            ++m_enqueue_calls;
+            m_tasks.emplace_back(std::move(task));
+        }
+
+        void enqueue(std::span<concurrencpp::task> tasks) override {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (m_shutdown) {
+                concurrencpp::details::throw_runtime_shutdown_exception(name);
+            }
+
+            ++m_enqueue_calls;
+            for (auto& task : tasks) {
+                m_tasks.emplace_back(std::move(task));
+            }
+        }
+
+        int max_concurrency_level() const noexcept override {
+            return 1;
+        }
+
+        bool shutdown_requested() const noexcept override {
+            std::unique_lock<std::mutex> lock(m_lock);
+            return m_shutdown;
+        }
+
+        void shutdown() noexcept override {
+            std::vector<concurrencpp::task> tasks;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_shutdown = true;
+                tasks = std::move(m_tasks);
+            }
+        }
+
+        size_t enqueue_calls() const {
+            std::unique_lock<std::mutex> lock(m_lock);
+            return m_enqueue_calls;
+        }
+
+        size_t size() const {
+            std::unique_lock<std::mutex> lock(m_lock);
+            return m_tasks.size();
+        }
+
+        size_t run_all() {
+            std::vector<concurrencpp::task> tasks;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                tasks = std::move(m_tasks);
+                m_tasks.clear();
+            }
+
+            for (auto& task : tasks) {
+                task();
+            }
+
+            return tasks.size();
+        }
+    };
+}  // namespace concurrencpp::tests
+
+#endif
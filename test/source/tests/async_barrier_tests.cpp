@@ -0,0 +1,185 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+#include "utils/recording_executor.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_barrier_constructor();
+    void test_async_barrier_arrive_and_wait_null_resume_executor();
+    void test_async_barrier_arrive_and_wait_phase();
+    void test_async_barrier_arrive_and_wait_resumption_fails();
+    void test_async_barrier_arrive_and_wait();
+    void test_async_barrier_arrive_and_drop();
+    void test_async_barrier_mini_load_test();
+
+    result<void> barrier_coro(async_barrier& barrier, std::shared_ptr<executor> ex) {
+        co_await barrier.arrive_and_wait(ex);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_barrier_constructor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_barrier barrier(0);
+        },
+        concurrencpp::details::consts::k_async_barrier_invalid_expected_err_msg);
+
+    async_barrier barrier(3);
+    assert_equal(barrier.phase(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_barrier barrier(1);
+            barrier.arrive_and_wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_barrier_arrive_and_wait_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait_phase() {
+    // the last arrival runs the completion function, resumes the others in bulk and continues synchronously
+    constexpr size_t participant_count = 16;
+
+    size_t completions = 0;
+    async_barrier barrier(participant_count, [&completions] {
+        ++completions;
+    });
+
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    for (size_t phase = 0; phase < 3; phase++) {
+        std::vector<result<void>> results;
+        for (size_t i = 0; i < participant_count - 1; i++) {
+            results.emplace_back(barrier_coro(barrier, executor));
+            assert_equal(results.back().status(), result_status::idle);
+        }
+
+        assert_equal(completions, phase);
+
+        auto last = barrier_coro(barrier, executor);
+        assert_equal(last.status(), result_status::value);
+        assert_equal(completions, phase + 1);
+        assert_equal(barrier.phase(), phase + 1);
+
+        assert_equal(executor->enqueue_calls(), phase + 1);
+        assert_equal(executor->run_all(), participant_count - 1);
+
+        for (auto& result : results) {
+            assert_equal(result.status(), result_status::value);
+        }
+    }
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait_resumption_fails() {
+    async_barrier barrier(2);
+    const auto executor = std::make_shared<recording_executor>();
+
+    auto result = barrier_coro(barrier, executor);
+    executor->shutdown();
+
+    barrier_coro(barrier, std::make_shared<inline_executor>()).get();
+
+    assert_throws<errors::broken_task>([&result] {
+        result.get();
+    });
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait() {
+    test_async_barrier_arrive_and_wait_null_resume_executor();
+    test_async_barrier_arrive_and_wait_phase();
+    test_async_barrier_arrive_and_wait_resumption_fails();
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_drop() {
+    async_barrier barrier(3);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    auto waiter = barrier_coro(barrier, executor);
+    barrier.arrive_and_drop();
+    assert_equal(barrier.phase(), static_cast<size_t>(0));
+
+    // the dropping participant completes the phase, and the next phase expects only two participants
+    auto last = barrier_coro(barrier, executor);
+    assert_equal(last.status(), result_status::value);
+    assert_equal(barrier.phase(), static_cast<size_t>(1));
+    assert_equal(executor->run_all(), static_cast<size_t>(1));
+    assert_equal(waiter.status(), result_status::value);
+
+    waiter = barrier_coro(barrier, executor);
+    assert_equal(waiter.status(), result_status::idle);
+
+    barrier.arrive_and_drop();
+    assert_equal(barrier.phase(), static_cast<size_t>(2));
+    assert_equal(executor->run_all(), static_cast<size_t>(1));
+    assert_equal(waiter.status(), result_status::value);
+
+    // a single participant is left
+    last = barrier_coro(barrier, executor);
+    assert_equal(last.status(), result_status::value);
+    assert_equal(barrier.phase(), static_cast<size_t>(3));
+}
+
+namespace concurrencpp::tests {
+    result<void> barrier_participant(executor_tag,
+                                     std::shared_ptr<executor> ex,
+                                     async_barrier& barrier,
+                                     std::atomic_size_t& arrivals,
+                                     size_t participant_count,
+                                     size_t phases) {
+        for (size_t phase = 0; phase < phases; phase++) {
+            arrivals.fetch_add(1);
+            co_await barrier.arrive_and_wait(ex);
+
+            // every participant of this phase arrived before any participant was released
+            assert_smaller_equal((phase + 1) * participant_count, arrivals.load());
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_barrier_mini_load_test() {
+    constexpr size_t participant_count = 16;
+    constexpr size_t phases = 500;
+
+    std::atomic_size_t arrivals {0};
+    size_t completions = 0;
+    async_barrier barrier(participant_count, [&] {
+        assert_equal(arrivals.load(), (completions + 1) * participant_count);
+        ++completions;
+    });
+
+    const auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner es(executor);
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < participant_count; i++) {
+        results.emplace_back(barrier_participant({}, executor, barrier, arrivals, participant_count, phases));
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(completions, phases);
+    assert_equal(barrier.phase(), phases);
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_barrier test");
+
+    tester.add_step("constructor", test_async_barrier_constructor);
+    tester.add_step("arrive_and_wait", test_async_barrier_arrive_and_wait);
+    tester.add_step("arrive_and_drop", test_async_barrier_arrive_and_drop);
+    tester.add_step("mini load test", test_async_barrier_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include "infra/tester.h"
 #include "infra/assertions.h"
 #include "utils/executor_shutdowner.h"
+#include "utils/recording_executor.h"
 
 #include "concurrencpp/threads/constants.h"
 
@@ -19,6 +20,16 @@ namespace concurrencpp::tests {
 
     void test_async_condition_variable_notify_one();
     void test_async_condition_variable_notify_all();
+
+    void test_async_condition_variable_await_keyed_null_resume_executor();
+    void test_async_condition_variable_await_keyed_unlocked_scoped_async_lock();
+    void test_async_condition_variable_await_keyed();
+
+    void test_async_condition_variable_notify_satisfied_unlocked_scoped_async_lock();
+    void test_async_condition_variable_notify_satisfied_foreign_lock();
+    void test_async_condition_variable_notify_satisfied();
+
+    void test_async_condition_variable_bulk_resume();
 }  // namespace concurrencpp::tests
 
 using namespace concurrencpp::tests;
@@ -222,6 +233,311 @@ void tests::test_async_condition_variable_notify_all() {
     }
 }
 
+void tests::test_async_condition_variable_await_keyed_null_resume_executor() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    auto scoped_lock = lock.lock(executor).run().get();
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            cv.await_keyed({}, scoped_lock, 1);
+        },
+        concurrencpp::details::consts::k_async_condition_variable_await_invalid_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            cv.await_keyed({}, scoped_lock, 1, [] {
+                return true;
+            });
+        },
+        concurrencpp::details::consts::k_async_condition_variable_await_invalid_resume_executor_err_msg);
+}
+
+void tests::test_async_condition_variable_await_keyed_unlocked_scoped_async_lock() {
+    async_condition_variable cv;
+    const auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            scoped_async_lock sal;
+            cv.await_keyed(executor, sal, 1);
+        },
+        concurrencpp::details::consts::k_async_condition_variable_await_lock_unlocked_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            scoped_async_lock sal;
+            cv.await_keyed(executor, sal, 1, [] {
+                return true;
+            });
+        },
+        concurrencpp::details::consts::k_async_condition_variable_await_lock_unlocked_err_msg);
+}
+
+void tests::test_async_condition_variable_await_keyed() {
+    test_async_condition_variable_await_keyed_null_resume_executor();
+    test_async_condition_variable_await_keyed_unlocked_scoped_async_lock();
+
+    async_lock lock;
+    async_condition_variable cv;
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    auto task = [&](size_t key) -> result<void> {
+        auto sal = co_await lock.lock(executor);
+        co_await cv.await_keyed(executor, sal, key);
+    };
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 16; i++) {
+        results.emplace_back(task(i % 4));
+    }
+
+    // a notification for a key no one waits on resumes no one
+    cv.notify_one(7);
+    cv.notify_all(7);
+    assert_equal(executor->size(), static_cast<size_t>(0));
+
+    cv.notify_one(1);
+    assert_equal(executor->size(), static_cast<size_t>(1));
+    executor->run_all();
+
+    for (size_t i = 0; i < results.size(); i++) {
+        assert_equal(results[i].status(), i == 1 ? result_status::value : result_status::idle);
+    }
+
+    const auto enqueue_calls = executor->enqueue_calls();
+    cv.notify_all(2);
+    assert_equal(executor->size(), static_cast<size_t>(4));
+    assert_equal(executor->enqueue_calls(), enqueue_calls + 1);
+    executor->run_all();
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto resumed = (i == 1) || (i % 4 == 2);
+        assert_equal(results[i].status(), resumed ? result_status::value : result_status::idle);
+    }
+
+    // notify_all without a key resumes keyed tasks as well
+    cv.notify_all();
+    assert_equal(executor->size(), static_cast<size_t>(11));
+    executor->run_all();
+
+    for (auto& result : results) {
+        assert_equal(result.status(), result_status::value);
+        result.get();
+    }
+
+    // keyed tasks with a predicate
+    size_t value = 0;
+    auto pred_task = [&](size_t key) -> result<void> {
+        auto sal = co_await lock.lock(executor);
+        co_await cv.await_keyed(executor, sal, key, [&value, key] {
+            return value == key;
+        });
+    };
+
+    auto res0 = pred_task(0);
+    auto res1 = pred_task(1);
+    assert_equal(res0.status(), result_status::value);
+    assert_equal(res1.status(), result_status::idle);
+
+    value = 1;
+    cv.notify_all(0);
+    assert_equal(executor->size(), static_cast<size_t>(0));
+
+    cv.notify_all(1);
+    executor->run_all();
+    assert_equal(res1.status(), result_status::value);
+}
+
+void tests::test_async_condition_variable_notify_satisfied_unlocked_scoped_async_lock() {
+    async_lock lock;
+    async_condition_variable cv;
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            scoped_async_lock sal;
+            cv.notify_satisfied(sal);
+        },
+        concurrencpp::details::consts::k_async_condition_variable_notify_satisfied_lock_unlocked_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            scoped_async_lock sal(lock, std::defer_lock);
+            cv.notify_satisfied(sal);
+        },
+        concurrencpp::details::consts::k_async_condition_variable_notify_satisfied_lock_unlocked_err_msg);
+}
+
+void tests::test_async_condition_variable_notify_satisfied_foreign_lock() {
+    async_lock lock0, lock1;
+    async_condition_variable cv;
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    bool ready = false;
+    size_t evaluations = 0;
+
+    auto pred_task = [&]() -> result<void> {
+        auto sal = co_await lock0.lock(executor);
+        co_await cv.await(executor, sal, [&] {
+            ++evaluations;
+            return ready;
+        });
+    };
+
+    // a task without a predicate reads nothing, the lock it waits with doesn't matter
+    auto plain_task = [&]() -> result<void> {
+        auto sal = co_await lock1.lock(executor);
+        co_await cv.await(executor, sal);
+    };
+
+    auto res0 = pred_task();
+    auto res1 = plain_task();
+    assert_equal(evaluations, static_cast<size_t>(1));
+
+    {
+        auto sal = lock1.lock(executor).run().get();
+        assert_throws_with_error_message<std::invalid_argument>(
+            [&] {
+                cv.notify_satisfied(sal);
+            },
+            concurrencpp::details::consts::k_async_condition_variable_notify_satisfied_foreign_lock_err_msg);
+    }
+
+    // the predicate wasn't evaluated and no task was resumed
+    assert_equal(evaluations, static_cast<size_t>(1));
+    assert_equal(executor->size(), static_cast<size_t>(0));
+
+    {
+        auto sal = lock0.lock(executor).run().get();
+        ready = true;
+        cv.notify_satisfied(sal);
+    }
+
+    executor->run_all();
+    assert_equal(res0.status(), result_status::value);
+    assert_equal(res1.status(), result_status::value);
+}
+
+void tests::test_async_condition_variable_notify_satisfied() {
+    test_async_condition_variable_notify_satisfied_unlocked_scoped_async_lock();
+    test_async_condition_variable_notify_satisfied_foreign_lock();
+
+    async_lock lock;
+    async_condition_variable cv;
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    size_t value = 0;
+    size_t evaluations_in_tasks = 0;
+
+    auto task = [&](size_t target) -> result<void> {
+        auto sal = co_await lock.lock(executor);
+        co_await cv.await(executor, sal, [&, target] {
+            if (sal.owns_lock()) {
+                ++evaluations_in_tasks;
+            }
+
+            return value == target;
+        });
+    };
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 16; i++) {
+        results.emplace_back(task(i % 4 + 1));
+    }
+
+    assert_equal(evaluations_in_tasks, static_cast<size_t>(16));
+
+    for (size_t round = 1; round <= 4; round++) {
+        {
+            auto sal = lock.lock(executor).run().get();
+            value = round;
+
+            const auto enqueue_calls = executor->enqueue_calls();
+            cv.notify_satisfied(sal);
+
+            // only the tasks whose predicate holds are resumed, all of them with one enqueue call
+            assert_equal(executor->size(), static_cast<size_t>(4));
+            assert_equal(executor->enqueue_calls(), enqueue_calls + 1);
+        }
+
+        executor->run_all();
+
+        for (size_t i = 0; i < results.size(); i++) {
+            const auto resumed = (i % 4 + 1) <= round;
+            assert_equal(results[i].status(), resumed ? result_status::value : result_status::idle);
+        }
+    }
+
+    // every task evaluated its predicate once when it was created and once when it was resumed
+    assert_equal(evaluations_in_tasks, static_cast<size_t>(32));
+
+    // predicate-less tasks are always resumed
+    auto res = [&]() -> result<void> {
+        auto sal = co_await lock.lock(executor);
+        co_await cv.await(executor, sal);
+    }();
+
+    {
+        auto sal = lock.lock(executor).run().get();
+        cv.notify_satisfied(sal);
+    }
+
+    executor->run_all();
+    assert_equal(res.status(), result_status::value);
+}
+
+void tests::test_async_condition_variable_bulk_resume() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto executor0 = std::make_shared<recording_executor>();
+    const auto executor1 = std::make_shared<recording_executor>();
+    executor_shutdowner es0(executor0);
+    executor_shutdowner es1(executor1);
+
+    auto task = [&](std::shared_ptr<executor> executor) -> result<void> {
+        auto sal = co_await lock.lock(executor);
+        co_await cv.await(executor, sal);
+    };
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 64; i++) {
+        results.emplace_back(task(i % 2 == 0 ? std::static_pointer_cast<executor>(executor0) : executor1));
+    }
+
+    cv.notify_all();
+
+    // one enqueue call per resume executor
+    assert_equal(executor0->enqueue_calls(), static_cast<size_t>(1));
+    assert_equal(executor1->enqueue_calls(), static_cast<size_t>(1));
+    assert_equal(executor0->size(), static_cast<size_t>(32));
+    assert_equal(executor1->size(), static_cast<size_t>(32));
+
+    executor0->run_all();
+    executor1->run_all();
+
+    for (auto& result : results) {
+        assert_equal(result.status(), result_status::value);
+        result.get();
+    }
+
+    // a task whose resume executor was shut down is resumed with errors::broken_task
+    auto res = task(executor0);
+    executor0->shutdown();
+    cv.notify_all();
+
+    assert_equal(res.status(), result_status::exception);
+    assert_throws<errors::broken_task>([&] {
+        res.get();
+    });
+}
+
 int main() {
     tester tester("async_condition_variable test");
 
@@ -229,6 +545,9 @@ int main() {
     tester.add_step("await + pred", test_async_condition_variable_await_pred);
     tester.add_step("notify_one", test_async_condition_variable_notify_one);
     tester.add_step("notify_all", test_async_condition_variable_notify_all);
+    tester.add_step("await_keyed", test_async_condition_variable_await_keyed);
+    tester.add_step("notify_satisfied", test_async_condition_variable_notify_satisfied);
+    tester.add_step("bulk resume", test_async_condition_variable_bulk_resume);
 
     tester.launch_test();
     return 0;
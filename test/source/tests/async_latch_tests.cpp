@@ -0,0 +1,163 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+#include "utils/recording_executor.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_latch_count_down();
+    void test_async_latch_try_wait();
+    void test_async_latch_wait_null_resume_executor();
+    void test_async_latch_wait_bulk();
+    void test_async_latch_wait_resumption_fails();
+    void test_async_latch_wait();
+    void test_async_latch_arrive_and_wait();
+
+    result<void> latch_wait_coro(async_latch& latch, std::shared_ptr<executor> ex) {
+        co_await latch.wait(ex);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_latch_count_down() {
+    async_latch latch(3);
+
+    latch.count_down(2);
+    assert_false(latch.try_wait());
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&latch] {
+            latch.count_down(2);
+        },
+        concurrencpp::details::consts::k_async_latch_count_down_invalid_update_err_msg);
+
+    assert_false(latch.try_wait());
+
+    latch.count_down();
+    assert_true(latch.try_wait());
+}
+
+void concurrencpp::tests::test_async_latch_try_wait() {
+    async_latch released_latch(0);
+    assert_true(released_latch.try_wait());
+
+    async_latch latch(1);
+    assert_false(latch.try_wait());
+    latch.count_down();
+    assert_true(latch.try_wait());
+}
+
+void concurrencpp::tests::test_async_latch_wait_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_latch latch(1);
+            latch.wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_latch_wait_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_latch latch(1);
+            latch.arrive_and_wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_latch_arrive_and_wait_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_latch_wait_bulk() {
+    // the count_down that releases the latch schedules all the waiters with a single enqueue call
+    constexpr size_t waiter_count = 64;
+
+    async_latch latch(2);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < waiter_count; i++) {
+        results.emplace_back(latch_wait_coro(latch, executor));
+    }
+
+    latch.count_down();
+    assert_equal(executor->size(), static_cast<size_t>(0));
+
+    latch.count_down();
+    assert_equal(executor->enqueue_calls(), static_cast<size_t>(1));
+    assert_equal(executor->run_all(), waiter_count);
+
+    for (auto& result : results) {
+        assert_equal(result.status(), result_status::value);
+    }
+
+    // a released latch resumes the waiter synchronously
+    auto result = latch_wait_coro(latch, executor);
+    assert_equal(result.status(), result_status::value);
+    assert_equal(executor->enqueue_calls(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_async_latch_wait_resumption_fails() {
+    async_latch latch(1);
+    const auto executor = std::make_shared<recording_executor>();
+
+    auto result = latch_wait_coro(latch, executor);
+
+    executor->shutdown();
+    latch.count_down();
+
+    assert_throws<errors::broken_task>([&result] {
+        result.get();
+    });
+}
+
+void concurrencpp::tests::test_async_latch_wait() {
+    test_async_latch_wait_null_resume_executor();
+    test_async_latch_wait_bulk();
+    test_async_latch_wait_resumption_fails();
+}
+
+namespace concurrencpp::tests {
+    result<void> latch_participant(executor_tag,
+                                   std::shared_ptr<executor> ex,
+                                   async_latch& latch,
+                                   std::atomic_size_t& arrived,
+                                   size_t participant_count) {
+        arrived.fetch_add(1);
+        co_await latch.arrive_and_wait(ex);
+        assert_equal(arrived.load(), participant_count);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_latch_arrive_and_wait() {
+    constexpr size_t participant_count = 32;
+
+    async_latch latch(participant_count);
+    std::atomic_size_t arrived {0};
+
+    const auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner es(executor);
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < participant_count; i++) {
+        results.emplace_back(latch_participant({}, executor, latch, arrived, participant_count));
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_true(latch.try_wait());
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_latch test");
+
+    tester.add_step("count_down", test_async_latch_count_down);
+    tester.add_step("try_wait", test_async_latch_try_wait);
+    tester.add_step("wait", test_async_latch_wait);
+    tester.add_step("arrive_and_wait", test_async_latch_arrive_and_wait);
+
+    tester.launch_test();
+    return 0;
+}
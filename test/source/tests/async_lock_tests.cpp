@@ -6,6 +6,8 @@
 
 #include "concurrencpp/threads/constants.h"
 
+#include <type_traits>
+
 namespace concurrencpp::tests {
     void test_async_lock_lock_null_resume_executor();
     void test_async_lock_lock_resumption();
@@ -13,11 +15,13 @@ namespace concurrencpp::tests {
 
     void test_async_lock_try_lock();
 
-    void test_async_lock_unlock_resumption_fails();
+    void test_async_lock_unlock_resumption_fails(bool barging);
+    void test_async_lock_unlock_handoff();
+    void test_async_lock_unlock_barging();
     void test_async_lock_unlock();
 
-    void test_async_lock_mini_load_test1();
-    void test_async_lock_mini_load_test2();
+    void test_async_lock_mini_load_test1(bool barging);
+    void test_async_lock_mini_load_test2(bool barging);
     void test_async_lock_lock_unlock();
 
     result<void> incremenet(executor_tag, std::shared_ptr<executor> ex, async_lock& lock, size_t& counter, size_t cycles) {
@@ -103,7 +107,7 @@ namespace concurrencpp::tests {
     }
 }  // namespace concurrencpp::tests
 
-void concurrencpp::tests::test_async_lock_unlock_resumption_fails() {
+void concurrencpp::tests::test_async_lock_unlock_resumption_fails(bool barging) {
     /* let's say that one coroutine tried to lock a lock and failed because the lock is already locked.
      * that coroutine was queued for resumption for when async_lock::unlock is called.
      * when unlock is called, the coroutine manages to lock the lock but executor::shutdown is called
@@ -122,7 +126,7 @@ void concurrencpp::tests::test_async_lock_unlock_resumption_fails() {
         executor = runtime.make_worker_thread_executor();
     }
 
-    async_lock lock;
+    async_lock lock(barging);
 
     auto g = lock.lock(runtime.thread_pool_executor()).run().get();
 
@@ -147,6 +151,64 @@ void concurrencpp::tests::test_async_lock_unlock_resumption_fails() {
     result.get();  // make sure nothing is thrown
 }
 
+void concurrencpp::tests::test_async_lock_unlock_handoff() {
+    // unlocking a contended lock hands it to the first waiter, the lock can't be acquired before the waiter runs.
+    async_lock lock;
+    const auto manual_executor = std::make_shared<concurrencpp::manual_executor>();
+    executor_shutdowner es(manual_executor);
+
+    assert_true(lock.try_lock().run().get());
+
+    auto waiter0 = lock_coro(lock, manual_executor);
+    auto waiter1 = lock_coro(lock, manual_executor);
+
+    lock.unlock();
+    assert_false(lock.try_lock().run().get());
+    assert_equal(manual_executor->size(), static_cast<size_t>(1));
+
+    // waiter0 releases the lock, which is handed to waiter1
+    assert_true(manual_executor->loop_once());
+    assert_equal(waiter0.status(), result_status::value);
+    assert_false(lock.try_lock().run().get());
+
+    assert_true(manual_executor->loop_once());
+    assert_equal(waiter1.status(), result_status::value);
+
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void concurrencpp::tests::test_async_lock_unlock_barging() {
+    // in barging mode, unlocking a contended lock releases it and wakes the first waiter, which has to compete for it.
+    static_assert(!std::is_convertible_v<bool, async_lock>, "the barging mode must be selected explicitly");
+
+    async_lock lock(true);
+    assert_true(lock.barging());
+    assert_false(async_lock {}.barging());
+
+    const auto manual_executor = std::make_shared<concurrencpp::manual_executor>();
+    executor_shutdowner es(manual_executor);
+
+    assert_true(lock.try_lock().run().get());
+
+    auto waiter = lock_coro(lock, manual_executor);
+
+    lock.unlock();
+    assert_equal(manual_executor->size(), static_cast<size_t>(1));
+    assert_true(lock.try_lock().run().get());
+
+    // the waiter lost the race and parks again
+    assert_true(manual_executor->loop_once());
+    assert_equal(waiter.status(), result_status::idle);
+
+    lock.unlock();
+    assert_true(manual_executor->loop_once());
+    assert_equal(waiter.status(), result_status::value);
+
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
 void concurrencpp::tests::test_async_lock_unlock() {
     // unlocking an un-owned lock throws
     assert_throws_contains_error_message<std::system_error>(
@@ -156,14 +218,17 @@ void concurrencpp::tests::test_async_lock_unlock() {
         },
         concurrencpp::details::consts::k_async_lock_unlock_invalid_lock_err_msg);
 
-    test_async_lock_unlock_resumption_fails();
+    test_async_lock_unlock_resumption_fails(false);
+    test_async_lock_unlock_resumption_fails(true);
+    test_async_lock_unlock_handoff();
+    test_async_lock_unlock_barging();
 }
 
-void concurrencpp::tests::test_async_lock_mini_load_test1() {
-    async_lock mtx;
+void concurrencpp::tests::test_async_lock_mini_load_test1(bool barging) {
+    async_lock mtx(barging);
     size_t counter = 0;
 
-    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+    const size_t worker_count = std::max(concurrencpp::details::thread::hardware_concurrency(), size_t(4));
     constexpr size_t cycles = 100'000;
 
     std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
@@ -191,11 +256,11 @@ void concurrencpp::tests::test_async_lock_mini_load_test1() {
     }
 }
 
-void concurrencpp::tests::test_async_lock_mini_load_test2() {
-    async_lock mtx;
+void concurrencpp::tests::test_async_lock_mini_load_test2(bool barging) {
+    async_lock mtx(barging);
     std::vector<size_t> vector;
 
-    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+    const size_t worker_count = std::max(concurrencpp::details::thread::hardware_concurrency(), size_t(4));
     constexpr size_t cycles = 100'000;
 
     std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
@@ -230,8 +295,10 @@ void concurrencpp::tests::test_async_lock_mini_load_test2() {
 }
 
 void concurrencpp::tests::test_async_lock_lock_unlock() {
-    test_async_lock_mini_load_test1();
-    test_async_lock_mini_load_test2();
+    test_async_lock_mini_load_test1(false);
+    test_async_lock_mini_load_test2(false);
+    test_async_lock_mini_load_test1(true);
+    test_async_lock_mini_load_test2(true);
 }
 
 using namespace concurrencpp::tests;
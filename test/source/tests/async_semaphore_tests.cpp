@@ -0,0 +1,222 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+#include "utils/recording_executor.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_semaphore_acquire_invalid_arguments();
+    void test_async_semaphore_acquire_available();
+    void test_async_semaphore_acquire_fifo();
+    void test_async_semaphore_acquire();
+
+    void test_async_semaphore_try_acquire();
+
+    void test_async_semaphore_release_bulk();
+    void test_async_semaphore_release_resumption_fails();
+    void test_async_semaphore_release();
+
+    void test_async_semaphore_mini_load_test();
+
+    result<void> acquire_coro(async_semaphore& semaphore, std::shared_ptr<executor> ex, size_t count) {
+        co_await semaphore.acquire(ex, count);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_semaphore_acquire_invalid_arguments() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_semaphore semaphore(1);
+            semaphore.acquire(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_semaphore_acquire_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_semaphore semaphore(1);
+            semaphore.acquire(std::make_shared<concurrencpp::inline_executor>(), 0);
+        },
+        concurrencpp::details::consts::k_async_semaphore_acquire_invalid_count_err_msg);
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire_available() {
+    // available permits are acquired synchronously, without going through the resume executor
+    async_semaphore semaphore(5);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    auto result = acquire_coro(semaphore, executor, 2);
+    assert_equal(result.status(), result_status::value);
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(3));
+
+    result = acquire_coro(semaphore, executor, 3);
+    assert_equal(result.status(), result_status::value);
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+
+    result = acquire_coro(semaphore, executor, 1);
+    assert_equal(result.status(), result_status::idle);
+
+    semaphore.release();
+    assert_equal(result.status(), result_status::idle);
+    assert_equal(executor->run_all(), static_cast<size_t>(1));
+    assert_equal(result.status(), result_status::value);
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire_fifo() {
+    // permits are granted by the order of arrival, a large acquire is not starved by smaller ones
+    async_semaphore semaphore(0);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    auto large = acquire_coro(semaphore, executor, 3);
+    auto small = acquire_coro(semaphore, executor, 1);
+
+    semaphore.release(2);
+    assert_equal(executor->size(), static_cast<size_t>(0));
+    assert_false(semaphore.try_acquire(1));
+
+    semaphore.release(2);
+    assert_equal(executor->run_all(), static_cast<size_t>(2));
+    assert_equal(large.status(), result_status::value);
+    assert_equal(small.status(), result_status::value);
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire() {
+    test_async_semaphore_acquire_invalid_arguments();
+    test_async_semaphore_acquire_available();
+    test_async_semaphore_acquire_fifo();
+}
+
+void concurrencpp::tests::test_async_semaphore_try_acquire() {
+    async_semaphore semaphore(3);
+
+    assert_true(semaphore.try_acquire(2));
+    assert_false(semaphore.try_acquire(2));
+    assert_true(semaphore.try_acquire());
+    assert_false(semaphore.try_acquire());
+
+    semaphore.release(3);
+    assert_true(semaphore.try_acquire(3));
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_async_semaphore_release_bulk() {
+    // releasing N permits to N waiters schedules them with a single enqueue call
+    constexpr size_t waiter_count = 64;
+
+    async_semaphore semaphore(0);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < waiter_count; i++) {
+        results.emplace_back(acquire_coro(semaphore, executor, 1));
+    }
+
+    semaphore.release(waiter_count);
+    assert_equal(executor->enqueue_calls(), static_cast<size_t>(1));
+    assert_equal(executor->run_all(), waiter_count);
+
+    for (auto& result : results) {
+        assert_equal(result.status(), result_status::value);
+    }
+}
+
+void concurrencpp::tests::test_async_semaphore_release_resumption_fails() {
+    // permits that were granted to a coroutine whose resume executor was shut down are given back
+    async_semaphore semaphore(0);
+    const auto dead_executor = std::make_shared<recording_executor>();
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    auto failed = acquire_coro(semaphore, dead_executor, 2);
+    auto succeeded = acquire_coro(semaphore, executor, 2);
+
+    dead_executor->shutdown();
+    semaphore.release(2);
+
+    assert_throws<errors::broken_task>([&failed] {
+        failed.get();
+    });
+
+    assert_equal(executor->run_all(), static_cast<size_t>(1));
+    assert_equal(succeeded.status(), result_status::value);
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_async_semaphore_release() {
+    test_async_semaphore_release_bulk();
+    test_async_semaphore_release_resumption_fails();
+}
+
+namespace concurrencpp::tests {
+    result<void> limited_worker(executor_tag,
+                                std::shared_ptr<executor> ex,
+                                async_semaphore& semaphore,
+                                std::atomic_size_t& in_flight,
+                                std::atomic_size_t& max_in_flight,
+                                size_t permits,
+                                size_t cycles) {
+        for (size_t i = 0; i < cycles; i++) {
+            const auto count = (i % permits) + 1;
+            co_await semaphore.acquire(ex, count);
+
+            const auto current = in_flight.fetch_add(count) + count;
+            auto max = max_in_flight.load();
+            while (current > max && !max_in_flight.compare_exchange_weak(max, current)) {
+            }
+
+            in_flight.fetch_sub(count);
+            semaphore.release(count);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_semaphore_mini_load_test() {
+    constexpr size_t permits = 3;
+    constexpr size_t cycles = 20'000;
+
+    async_semaphore semaphore(permits);
+    std::atomic_size_t in_flight {0}, max_in_flight {0};
+
+    const size_t worker_count = std::max(concurrencpp::details::thread::hardware_concurrency(), size_t(4));
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    std::vector<result<void>> results(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = limited_worker({}, workers[i], semaphore, in_flight, max_in_flight, permits, cycles);
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_smaller_equal(max_in_flight.load(), permits);
+    assert_equal(semaphore.available_permits(), permits);
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_semaphore test");
+
+    tester.add_step("acquire", test_async_semaphore_acquire);
+    tester.add_step("try_acquire", test_async_semaphore_try_acquire);
+    tester.add_step("release", test_async_semaphore_release);
+    tester.add_step("mini load test", test_async_semaphore_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
@@ -0,0 +1,371 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_shared_mutex_lock_null_resume_executor();
+    void test_async_shared_mutex_lock();
+
+    void test_async_shared_mutex_try_lock();
+
+    void test_async_shared_mutex_unlock_invalid();
+    void test_async_shared_mutex_unlock_resumption_fails();
+    void test_async_shared_mutex_writer_preference();
+    void test_async_shared_mutex_reader_batch();
+    void test_async_shared_mutex_unlock();
+
+    void test_async_shared_mutex_scoped_locks();
+
+    void test_async_shared_mutex_mini_load_test();
+
+    result<void> shared_mutex_write_coro(async_shared_mutex& mutex, std::shared_ptr<executor> ex) {
+        auto g = co_await mutex.lock(ex);
+    }
+
+    result<void> shared_mutex_read_coro(async_shared_mutex& mutex, std::shared_ptr<executor> ex) {
+        auto g = co_await mutex.lock_shared(ex);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_shared_mutex_lock_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_shared_mutex mutex;
+            mutex.lock(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_shared_mutex_lock_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_shared_mutex mutex;
+            mutex.lock_shared(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_shared_mutex_lock_shared_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_shared_mutex_lock() {
+    test_async_shared_mutex_lock_null_resume_executor();
+
+    async_shared_mutex mutex;
+    const auto manual_executor = std::make_shared<concurrencpp::manual_executor>();
+    executor_shutdowner es(manual_executor);
+
+    // an available mutex is acquired synchronously, without going through the resume executor
+    {
+        auto reader0 = mutex.lock_shared(manual_executor).run();
+        auto reader1 = mutex.lock_shared(manual_executor).run();
+        assert_equal(reader0.status(), result_status::value);
+        assert_equal(reader1.status(), result_status::value);
+        assert_true(manual_executor->empty());
+
+        auto guard0 = reader0.get();
+        auto guard1 = reader1.get();
+        assert_true(guard0.owns_lock());
+        assert_true(guard1.owns_lock());
+        assert_equal(guard0.mutex(), &mutex);
+    }
+
+    {
+        auto writer = mutex.lock(manual_executor).run();
+        assert_equal(writer.status(), result_status::value);
+        assert_true(manual_executor->empty());
+
+        auto guard = writer.get();
+        assert_true(guard.owns_lock());
+
+        // an owned mutex suspends the caller, which is resumed inside the resume executor
+        auto reader = shared_mutex_read_coro(mutex, manual_executor);
+        assert_equal(reader.status(), result_status::idle);
+
+        guard.unlock();
+        assert_equal(reader.status(), result_status::idle);
+        assert_true(manual_executor->loop_once());
+        assert_equal(reader.status(), result_status::value);
+    }
+}
+
+void concurrencpp::tests::test_async_shared_mutex_try_lock() {
+    async_shared_mutex mutex;
+
+    assert_true(mutex.try_lock_shared().run().get());
+    assert_true(mutex.try_lock_shared().run().get());
+    assert_false(mutex.try_lock().run().get());
+
+    mutex.unlock_shared();
+    assert_false(mutex.try_lock().run().get());
+
+    mutex.unlock_shared();
+    assert_true(mutex.try_lock().run().get());
+    assert_false(mutex.try_lock().run().get());
+    assert_false(mutex.try_lock_shared().run().get());
+
+    mutex.unlock();
+    assert_true(mutex.try_lock().run().get());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_unlock_invalid() {
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            async_shared_mutex mutex;
+            mutex.unlock();
+        },
+        concurrencpp::details::consts::k_async_shared_mutex_unlock_invalid_lock_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            async_shared_mutex mutex;
+            mutex.unlock_shared();
+        },
+        concurrencpp::details::consts::k_async_shared_mutex_unlock_shared_invalid_lock_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            scoped_async_unique_lock lock;
+            lock.unlock();
+        },
+        concurrencpp::details::consts::k_scoped_async_unique_lock_unlock_invalid_lock_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            scoped_async_shared_lock lock;
+            lock.unlock();
+        },
+        concurrencpp::details::consts::k_scoped_async_shared_lock_unlock_invalid_lock_err_msg);
+}
+
+void concurrencpp::tests::test_async_shared_mutex_unlock_resumption_fails() {
+    // ownership that was handed to a coroutine whose resume executor was shut down is passed on to the next waiter
+    runtime runtime;
+    std::shared_ptr<worker_thread_executor> executors[4];
+    std::shared_ptr<worker_thread_executor> working_executor = runtime.make_worker_thread_executor();
+
+    for (auto& executor : executors) {
+        executor = runtime.make_worker_thread_executor();
+    }
+
+    async_shared_mutex mutex;
+    auto g = mutex.lock(runtime.thread_pool_executor()).run().get();
+
+    result<void> results[4];
+    results[0] = shared_mutex_write_coro(mutex, executors[0]);
+    results[1] = shared_mutex_read_coro(mutex, executors[1]);
+    results[2] = shared_mutex_write_coro(mutex, executors[2]);
+    results[3] = shared_mutex_read_coro(mutex, executors[3]);
+
+    auto result = shared_mutex_write_coro(mutex, working_executor);
+
+    for (auto& executor : executors) {
+        executor->shutdown();
+    }
+
+    g.unlock();
+
+    for (auto& err_result : results) {
+        assert_throws<errors::broken_task>([&err_result] {
+            err_result.get();
+        });
+    }
+
+    result.get();  // make sure nothing is thrown
+    assert_true(mutex.try_lock().run().get());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_writer_preference() {
+    // once a writer waits, new readers wait as well, and the last reader hands the mutex to the writer
+    async_shared_mutex mutex;
+    const auto manual_executor = std::make_shared<concurrencpp::manual_executor>();
+    executor_shutdowner es(manual_executor);
+
+    assert_true(mutex.try_lock_shared().run().get());
+
+    auto writer = shared_mutex_write_coro(mutex, manual_executor);
+    assert_equal(writer.status(), result_status::idle);
+
+    assert_false(mutex.try_lock_shared().run().get());
+    auto reader = shared_mutex_read_coro(mutex, manual_executor);
+    assert_equal(reader.status(), result_status::idle);
+
+    mutex.unlock_shared();
+    assert_equal(manual_executor->size(), static_cast<size_t>(1));
+    assert_false(mutex.try_lock().run().get());
+    assert_false(mutex.try_lock_shared().run().get());
+
+    // the writer releases the mutex, which is handed to the parked reader
+    assert_true(manual_executor->loop_once());
+    assert_equal(writer.status(), result_status::value);
+    assert_false(mutex.try_lock().run().get());
+    assert_equal(manual_executor->size(), static_cast<size_t>(1));
+
+    assert_true(manual_executor->loop_once());
+    assert_equal(reader.status(), result_status::value);
+
+    assert_true(mutex.try_lock().run().get());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_reader_batch() {
+    // readers that parked behind a writer are granted together, before the next writer
+    async_shared_mutex mutex;
+    const auto manual_executor = std::make_shared<concurrencpp::manual_executor>();
+    executor_shutdowner es(manual_executor);
+
+    assert_true(mutex.try_lock().run().get());
+
+    auto reader0 = shared_mutex_read_coro(mutex, manual_executor);
+    auto writer = shared_mutex_write_coro(mutex, manual_executor);
+    auto reader1 = shared_mutex_read_coro(mutex, manual_executor);
+    auto reader2 = shared_mutex_read_coro(mutex, manual_executor);
+
+    mutex.unlock();
+    assert_equal(manual_executor->size(), static_cast<size_t>(3));
+    assert_false(mutex.try_lock().run().get());
+
+    assert_equal(manual_executor->loop(3), static_cast<size_t>(3));
+    assert_equal(reader0.status(), result_status::value);
+    assert_equal(reader1.status(), result_status::value);
+    assert_equal(reader2.status(), result_status::value);
+
+    // the last reader handed the mutex to the writer
+    assert_equal(manual_executor->size(), static_cast<size_t>(1));
+    assert_true(manual_executor->loop_once());
+    assert_equal(writer.status(), result_status::value);
+
+    assert_true(mutex.try_lock().run().get());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_unlock() {
+    test_async_shared_mutex_unlock_invalid();
+    test_async_shared_mutex_unlock_resumption_fails();
+    test_async_shared_mutex_writer_preference();
+    test_async_shared_mutex_reader_batch();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_scoped_locks() {
+    async_shared_mutex mutex;
+    const auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+
+    {
+        auto unique_guard = mutex.lock(inline_executor).run().get();
+        assert_true(static_cast<bool>(unique_guard));
+
+        scoped_async_unique_lock moved(std::move(unique_guard));
+        assert_false(unique_guard.owns_lock());
+        assert_equal(unique_guard.mutex(), static_cast<async_shared_mutex*>(nullptr));
+        assert_true(moved.owns_lock());
+        assert_false(mutex.try_lock_shared().run().get());
+    }
+
+    // the destructor released the mutex
+    {
+        auto shared_guard0 = mutex.lock_shared(inline_executor).run().get();
+        auto shared_guard1 = mutex.lock_shared(inline_executor).run().get();
+
+        shared_guard0 = std::move(shared_guard1);
+        assert_false(shared_guard1.owns_lock());
+        assert_true(shared_guard0.owns_lock());
+        assert_false(mutex.try_lock().run().get());
+
+        const auto released = shared_guard0.release();
+        assert_equal(released, &mutex);
+        assert_false(shared_guard0.owns_lock());
+        assert_false(mutex.try_lock().run().get());
+
+        mutex.unlock_shared();
+    }
+
+    assert_true(mutex.try_lock().run().get());
+    mutex.unlock();
+}
+
+namespace concurrencpp::tests {
+    result<void> shared_mutex_worker(executor_tag,
+                                     std::shared_ptr<executor> ex,
+                                     async_shared_mutex& mutex,
+                                     std::vector<size_t>& values,
+                                     std::atomic_size_t& readers_inside,
+                                     std::atomic_size_t& writers_inside,
+                                     size_t worker_index,
+                                     size_t cycles) {
+        for (size_t i = 0; i < cycles; i++) {
+            if (i % 8 == 0) {
+                auto guard = co_await mutex.lock(ex);
+                assert_equal(writers_inside.fetch_add(1), static_cast<size_t>(0));
+                assert_equal(readers_inside.load(), static_cast<size_t>(0));
+
+                values.emplace_back(worker_index * cycles + i);
+
+                writers_inside.fetch_sub(1);
+                continue;
+            }
+
+            auto guard = co_await mutex.lock_shared(ex);
+            readers_inside.fetch_add(1);
+            assert_equal(writers_inside.load(), static_cast<size_t>(0));
+
+            const volatile auto size = values.size();
+            (void)size;
+
+            readers_inside.fetch_sub(1);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_shared_mutex_mini_load_test() {
+    async_shared_mutex mutex;
+    std::vector<size_t> values;
+    std::atomic_size_t readers_inside {0}, writers_inside {0};
+
+    const size_t worker_count = std::max(concurrencpp::details::thread::hardware_concurrency(), size_t(4));
+    constexpr size_t cycles = 80'000;
+
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    std::vector<result<void>> results(worker_count);
+
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = shared_mutex_worker({}, workers[i], mutex, values, readers_inside, writers_inside, i, cycles);
+    }
+
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i].get();
+    }
+
+    {
+        auto lock = mutex.lock(workers[0]).run().get();
+        assert_equal(values.size(), worker_count * cycles / 8);
+
+        std::sort(values.begin(), values.end());
+        for (size_t i = 1; i < values.size(); i++) {
+            assert_smaller(values[i - 1], values[i]);
+        }
+    }
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_shared_mutex test");
+
+    tester.add_step("lock + lock_shared", test_async_shared_mutex_lock);
+    tester.add_step("try_lock + try_lock_shared", test_async_shared_mutex_try_lock);
+    tester.add_step("unlock + unlock_shared", test_async_shared_mutex_unlock);
+    tester.add_step("scoped locks", test_async_shared_mutex_scoped_locks);
+    tester.add_step("mini load test", test_async_shared_mutex_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
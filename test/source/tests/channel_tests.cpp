@@ -0,0 +1,464 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+#include "utils/recording_executor.h"
+
+#include "concurrencpp/threads/constants.h"
+
+#include <numeric>
+
+namespace concurrencpp::tests {
+    void test_channel_constructor();
+    void test_channel_null_resume_executor();
+
+    void test_channel_try_send_try_receive_bounded();
+    void test_channel_try_send_try_receive_unbounded();
+    void test_channel_try_send_try_receive();
+
+    void test_channel_receiver_handoff();
+    void test_channel_sender_parks_when_full();
+    void test_channel_resumption_fails();
+    void test_channel_resumption_fails_keeps_order();
+    void test_channel_send_receive();
+
+    void test_channel_close();
+    void test_channel_batch();
+
+    template<channel_mode mode>
+    void test_channel_load_test(size_t producers, size_t consumers, size_t capacity);
+    void test_channel_load_tests();
+
+    template<class channel_type>
+    result<void> send_coro(channel_type& channel, std::shared_ptr<executor> ex, int value, bool& accepted) {
+        accepted = co_await channel.send(ex, value);
+    }
+
+    template<class channel_type>
+    result<std::optional<int>> receive_coro(channel_type& channel, std::shared_ptr<executor> ex) {
+        co_return co_await channel.receive(ex);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_channel_constructor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            channel<int> channel(0);
+        },
+        concurrencpp::details::consts::k_channel_invalid_capacity_err_msg);
+
+    channel<int> bounded(5);
+    assert_true(bounded.bounded());
+    assert_equal(bounded.capacity(), static_cast<size_t>(8));
+    assert_false(bounded.closed());
+
+    channel<int> unbounded;
+    assert_false(unbounded.bounded());
+    assert_equal(unbounded.capacity(), concurrencpp::details::consts::k_default_unbounded_channel_ring_capacity);
+}
+
+void concurrencpp::tests::test_channel_null_resume_executor() {
+    channel<int> channel(1);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&channel] {
+            channel.send({}, 1);
+        },
+        concurrencpp::details::consts::k_channel_send_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&channel] {
+            channel.receive({});
+        },
+        concurrencpp::details::consts::k_channel_receive_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&channel] {
+            channel.send_batch({}, {});
+        },
+        concurrencpp::details::consts::k_channel_send_batch_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&channel] {
+            channel.receive_batch({}, 1);
+        },
+        concurrencpp::details::consts::k_channel_receive_batch_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&channel] {
+            channel.receive_batch(std::make_shared<inline_executor>(), 0);
+        },
+        concurrencpp::details::consts::k_channel_receive_batch_invalid_count_err_msg);
+}
+
+void concurrencpp::tests::test_channel_try_send_try_receive_bounded() {
+    channel<std::string> channel(4);
+
+    for (size_t i = 0; i < 4; i++) {
+        assert_true(channel.try_send(std::to_string(i)));
+    }
+
+    // a value that is not accepted is not moved from
+    std::string rejected = "rejected";
+    assert_false(channel.try_send(rejected));
+    assert_equal(rejected, std::string("rejected"));
+
+    for (size_t i = 0; i < 4; i++) {
+        const auto value = channel.try_receive();
+        assert_true(value.has_value());
+        assert_equal(*value, std::to_string(i));
+    }
+
+    assert_false(channel.try_receive().has_value());
+}
+
+void concurrencpp::tests::test_channel_try_send_try_receive_unbounded() {
+    // values that don't fit the ring are kept in order
+    const size_t count = concurrencpp::details::consts::k_default_unbounded_channel_ring_capacity * 3 + 7;
+    channel<size_t, channel_mode::spsc> channel;
+
+    for (size_t i = 0; i < count; i++) {
+        assert_true(channel.try_send(i));
+
+        if (i % 5 == 0) {
+            // interleaving receives makes the producer move the overflow back to the ring
+            const auto value = channel.try_receive();
+            assert_true(value.has_value());
+            assert_equal(*value, i / 5);
+        }
+    }
+
+    for (size_t i = (count - 1) / 5 + 1; i < count; i++) {
+        const auto value = channel.try_receive();
+        assert_true(value.has_value());
+        assert_equal(*value, i);
+    }
+
+    assert_false(channel.try_receive().has_value());
+}
+
+void concurrencpp::tests::test_channel_try_send_try_receive() {
+    test_channel_try_send_try_receive_bounded();
+    test_channel_try_send_try_receive_unbounded();
+}
+
+void concurrencpp::tests::test_channel_receiver_handoff() {
+    // a value sent while receivers wait is handed directly to the first one, all of them are resumed in bulk
+    channel<int> channel(2);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    auto receiver0 = receive_coro(channel, executor);
+    auto receiver1 = receive_coro(channel, executor);
+    assert_equal(receiver0.status(), result_status::idle);
+
+    assert_true(channel.try_send(1));
+    assert_true(channel.try_send(2));
+    assert_false(channel.try_receive().has_value());
+
+    assert_equal(executor->run_all(), static_cast<size_t>(2));
+    assert_equal(*receiver0.get(), 1);
+    assert_equal(*receiver1.get(), 2);
+}
+
+void concurrencpp::tests::test_channel_sender_parks_when_full() {
+    channel<int> channel(2);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    bool accepted[4] = {};
+    auto sender0 = send_coro(channel, executor, 0, accepted[0]);
+    auto sender1 = send_coro(channel, executor, 1, accepted[1]);
+    assert_equal(sender1.status(), result_status::value);
+
+    auto sender2 = send_coro(channel, executor, 2, accepted[2]);
+    auto sender3 = send_coro(channel, executor, 3, accepted[3]);
+    assert_equal(sender2.status(), result_status::idle);
+    assert_equal(sender3.status(), result_status::idle);
+
+    // new values queue behind the parked senders
+    assert_false(channel.try_send(4));
+
+    for (int i = 0; i < 4; i++) {
+        const auto value = channel.try_receive();
+        assert_true(value.has_value());
+        assert_equal(*value, i);
+    }
+
+    assert_equal(executor->run_all(), static_cast<size_t>(2));
+    for (auto value : accepted) {
+        assert_true(value);
+    }
+}
+
+void concurrencpp::tests::test_channel_resumption_fails() {
+    // a value that was handed to a receiver whose resume executor was shut down is given back to the channel
+    channel<int> channel(2);
+    const auto dead_executor = std::make_shared<recording_executor>();
+
+    auto receiver = receive_coro(channel, dead_executor);
+    dead_executor->shutdown();
+
+    assert_true(channel.try_send(123));
+
+    assert_throws<errors::broken_task>([&receiver] {
+        receiver.get();
+    });
+
+    const auto value = channel.try_receive();
+    assert_true(value.has_value());
+    assert_equal(*value, 123);
+}
+
+void concurrencpp::tests::test_channel_resumption_fails_keeps_order() {
+    for (const auto bounded : {true, false}) {
+        // the receiver is interrupted only after more values were queued behind its value
+        auto channel = bounded ? std::make_unique<concurrencpp::channel<int>>(2) : std::make_unique<concurrencpp::channel<int>>();
+        const auto ring_capacity = static_cast<int>(channel->capacity());
+        const auto dying_executor = std::make_shared<recording_executor>();
+
+        auto receiver = receive_coro(*channel, dying_executor);
+        assert_true(channel->try_send(0));
+        for (int i = 1; i <= ring_capacity; i++) {
+            assert_true(channel->try_send(i));
+        }
+
+        assert_equal(channel->try_send(ring_capacity + 1), !bounded);
+
+        dying_executor->shutdown();
+        assert_throws<errors::broken_task>([&receiver] {
+            receiver.get();
+        });
+
+        std::vector<int> expected(ring_capacity);
+        std::iota(expected.begin(), expected.end(), 1);
+        expected.emplace_back(0);
+
+        if (bounded) {
+            // the given back value is over capacity, no new value is accepted until there's room for it
+            assert_false(channel->try_send(-1));
+            assert_equal(*channel->try_receive(), 1);
+            assert_false(channel->try_send(-1));
+            expected.erase(expected.begin());
+        } else {
+            expected.emplace_back(ring_capacity + 1);
+        }
+
+        for (const auto value : expected) {
+            const auto received = channel->try_receive();
+            assert_true(received.has_value());
+            assert_equal(*received, value);
+        }
+
+        assert_false(channel->try_receive().has_value());
+        assert_true(channel->try_send(-1));
+    }
+}
+
+void concurrencpp::tests::test_channel_send_receive() {
+    test_channel_receiver_handoff();
+    test_channel_sender_parks_when_full();
+    test_channel_resumption_fails();
+    test_channel_resumption_fails_keeps_order();
+}
+
+void concurrencpp::tests::test_channel_close() {
+    channel<int> channel(2);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    bool accepted[3] = {};
+    auto sender0 = send_coro(channel, executor, 0, accepted[0]);
+    auto sender1 = send_coro(channel, executor, 1, accepted[1]);
+    auto sender2 = send_coro(channel, executor, 2, accepted[2]);
+    assert_equal(sender2.status(), result_status::idle);
+
+    channel.close();
+    assert_true(channel.closed());
+    assert_false(channel.try_send(3));
+
+    // the parked sender is rejected, values that are already in the channel can still be received
+    assert_equal(executor->run_all(), static_cast<size_t>(1));
+    assert_true(accepted[0]);
+    assert_true(accepted[1]);
+    assert_false(accepted[2]);
+
+    assert_equal(*receive_coro(channel, executor).get(), 0);
+    assert_equal(*receive_coro(channel, executor).get(), 1);
+
+    auto receiver = receive_coro(channel, executor);
+    assert_equal(receiver.status(), result_status::value);
+    assert_false(receiver.get().has_value());
+
+    // receivers that wait when the channel is closed are resumed with an empty optional
+    concurrencpp::channel<int> other(2);
+    auto waiting_receiver = receive_coro(other, executor);
+    other.close();
+    assert_equal(executor->run_all(), static_cast<size_t>(1));
+    assert_false(waiting_receiver.get().has_value());
+}
+
+namespace concurrencpp::tests {
+    template<class type>
+    result<size_t> send_batch_coro(channel<type>& channel, std::shared_ptr<executor> ex, std::vector<type>& values) {
+        co_return co_await channel.send_batch(ex, values);
+    }
+
+    result<std::vector<int>> receive_batch_coro(channel<int>& channel, std::shared_ptr<executor> ex, size_t max_count) {
+        co_return co_await channel.receive_batch(ex, max_count);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_channel_batch() {
+    channel<int> channel(4);
+    const auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+
+    std::vector<int> values(10);
+    std::iota(values.begin(), values.end(), 0);
+
+    assert_equal(channel.try_send_batch(values), static_cast<size_t>(4));
+
+    std::vector<int> received;
+    assert_equal(channel.try_receive_batch(std::back_inserter(received), 3), static_cast<size_t>(3));
+    assert_equal(received, std::vector<int> {0, 1, 2});
+
+    auto sender = send_batch_coro(channel, executor, values);
+    assert_equal(sender.status(), result_status::idle);
+
+    size_t expected = 3;
+    while (expected < values.size() + 4) {
+        auto batch = receive_batch_coro(channel, executor, 3);
+        while (batch.status() == result_status::idle) {
+            executor->run_all();
+        }
+
+        for (auto value : batch.get()) {
+            assert_equal(static_cast<size_t>(value), expected < 4 ? expected : expected - 4);
+            ++expected;
+        }
+    }
+
+    executor->run_all();
+    assert_equal(sender.get(), values.size());
+
+    // values that are not sent because the channel was closed are not moved from
+    concurrencpp::channel<std::unique_ptr<int>> ptr_channel(2);
+    std::vector<std::unique_ptr<int>> ptrs;
+    for (int i = 0; i < 4; i++) {
+        ptrs.emplace_back(std::make_unique<int>(i));
+    }
+
+    auto ptr_sender = send_batch_coro(ptr_channel, executor, ptrs);
+    assert_equal(ptr_sender.status(), result_status::idle);
+
+    ptr_channel.close();
+    executor->run_all();
+
+    assert_equal(ptr_sender.get(), static_cast<size_t>(2));
+    assert_false(static_cast<bool>(ptrs[0]));
+    assert_false(static_cast<bool>(ptrs[1]));
+    assert_true(static_cast<bool>(ptrs[2]));
+    assert_true(static_cast<bool>(ptrs[3]));
+    assert_equal(*ptrs[2], 2);
+    assert_equal(*ptrs[3], 3);
+}
+
+namespace concurrencpp::tests {
+    template<channel_mode mode>
+    result<void> produce(executor_tag, std::shared_ptr<executor> ex, channel<size_t, mode>& channel, size_t begin, size_t end) {
+        for (auto i = begin; i < end; i++) {
+            const auto accepted = co_await channel.send(ex, i);
+            assert_true(accepted);
+        }
+    }
+
+    template<channel_mode mode>
+    result<void> consume(executor_tag, std::shared_ptr<executor> ex, channel<size_t, mode>& channel, std::vector<size_t>& received) {
+        while (true) {
+            auto value = co_await channel.receive(ex);
+            if (!value.has_value()) {
+                co_return;
+            }
+
+            received.emplace_back(*value);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+template<concurrencpp::channel_mode mode>
+void concurrencpp::tests::test_channel_load_test(size_t producers, size_t consumers, size_t capacity) {
+    constexpr size_t values_per_producer = 20'000;
+
+    auto channel = capacity == 0 ? std::make_unique<concurrencpp::channel<size_t, mode>>() :
+                                   std::make_unique<concurrencpp::channel<size_t, mode>>(capacity);
+
+    const auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner es(executor);
+
+    std::vector<std::vector<size_t>> received(consumers);
+    std::vector<result<void>> consumer_results;
+    for (size_t i = 0; i < consumers; i++) {
+        consumer_results.emplace_back(consume<mode>({}, executor, *channel, received[i]));
+    }
+
+    std::vector<result<void>> producer_results;
+    for (size_t i = 0; i < producers; i++) {
+        producer_results.emplace_back(produce<mode>({}, executor, *channel, i * values_per_producer, (i + 1) * values_per_producer));
+    }
+
+    for (auto& result : producer_results) {
+        result.get();
+    }
+
+    channel->close();
+
+    for (auto& result : consumer_results) {
+        result.get();
+    }
+
+    std::vector<size_t> all;
+    for (auto& values : received) {
+        // every consumer sees the values of every producer in order
+        for (size_t i = 1; i < values.size(); i++) {
+            if (values[i - 1] / values_per_producer == values[i] / values_per_producer) {
+                assert_smaller(values[i - 1], values[i]);
+            }
+        }
+
+        all.insert(all.end(), values.begin(), values.end());
+    }
+
+    std::sort(all.begin(), all.end());
+    assert_equal(all.size(), producers * values_per_producer);
+    for (size_t i = 0; i < all.size(); i++) {
+        assert_equal(all[i], i);
+    }
+}
+
+void concurrencpp::tests::test_channel_load_tests() {
+    test_channel_load_test<channel_mode::spsc>(1, 1, 16);
+    test_channel_load_test<channel_mode::spsc>(1, 1, 0);
+    test_channel_load_test<channel_mode::mpsc>(4, 1, 16);
+    test_channel_load_test<channel_mode::mpsc>(4, 1, 0);
+    test_channel_load_test<channel_mode::mpmc>(4, 4, 16);
+    test_channel_load_test<channel_mode::mpmc>(4, 4, 0);
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("channel test");
+
+    tester.add_step("constructor", test_channel_constructor);
+    tester.add_step("null resume executor", test_channel_null_resume_executor);
+    tester.add_step("try_send + try_receive", test_channel_try_send_try_receive);
+    tester.add_step("send + receive", test_channel_send_receive);
+    tester.add_step("close", test_channel_close);
+    tester.add_step("batch", test_channel_batch);
+    tester.add_step("load tests", test_channel_load_tests);
+
+    tester.launch_test();
+    return 0;
+}
@@ -39,6 +39,8 @@ namespace concurrencpp::tests {
 
     void test_lazy_combo_coroutine();
 
+    result<size_t> await_chain_link(result<size_t> inner_result);
+    void test_deep_await_chain();
 }  // namespace concurrencpp::tests
 
 template<class type>
@@ -212,6 +214,30 @@ void concurrencpp::tests::test_lazy_combo_coroutine() {
     }
 }
 
+concurrencpp::result<size_t> concurrencpp::tests::await_chain_link(result<size_t> inner_result) {
+    co_return co_await inner_result + 1;
+}
+
+void concurrencpp::tests::test_deep_await_chain() {
+    // every link is suspended on the previous one, completing the first link resumes the whole chain
+    // by transferring control from each completed link to its awaiter.
+    constexpr size_t chain_length = 10'000;
+
+    result_promise<size_t> rp;
+    auto chain = rp.get_result();
+
+    for (size_t i = 0; i < chain_length; i++) {
+        chain = await_chain_link(std::move(chain));
+    }
+
+    assert_equal(chain.status(), result_status::idle);
+
+    rp.set_result(0);
+
+    assert_equal(chain.status(), result_status::value);
+    assert_equal(chain.get(), chain_length);
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -221,6 +247,7 @@ int main() {
     tester.add_step("combo coroutine", test_combo_coroutine);
     tester.add_step("lazy recursive coroutines", test_lazy_recursive_coroutines);
     tester.add_step("lazy combo coroutine", test_lazy_combo_coroutine);
+    tester.add_step("deep await chain", test_deep_await_chain);
 
     tester.launch_test();
     return 0;
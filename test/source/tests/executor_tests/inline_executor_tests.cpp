@@ -7,6 +7,8 @@
 #include "utils/test_ready_result.h"
 #include "utils/executor_shutdowner.h"
 
+#include <type_traits>
+
 namespace concurrencpp::tests {
     void test_inline_executor_name();
 
@@ -34,6 +36,12 @@ namespace concurrencpp::tests {
     void test_inline_executor_bulk_submit_inline();
     void test_inline_executor_bulk_submit();
 
+    void test_inline_executor_trampolined_deferred_execution();
+    void test_inline_executor_trampolined_fifo_order();
+    void test_inline_executor_trampolined_deep_recursion();
+    void test_inline_executor_trampolined_bulk();
+    void test_inline_executor_trampolined();
+
     void assert_executed_inline(const std::unordered_map<size_t, size_t>& execution_map) noexcept {
         assert_equal(execution_map.size(), static_cast<size_t>(1));
         assert_equal(execution_map.begin()->first, ::concurrencpp::details::thread::get_current_virtual_id());
@@ -335,6 +343,124 @@ void concurrencpp::tests::test_inline_executor_bulk_submit() {
     test_inline_executor_bulk_submit_inline();
 }
 
+void concurrencpp::tests::test_inline_executor_trampolined_deferred_execution() {
+    static_assert(!std::is_convertible_v<bool, inline_executor>, "the trampolined mode must be selected explicitly");
+
+    auto executor = std::make_shared<inline_executor>(true);
+    executor_shutdowner shutdown(executor);
+    assert_true(executor->trampolined());
+    assert_false(inline_executor {}.trampolined());
+
+    auto inner_executed = false;
+    auto inner_executed_before_outer_returned = true;
+
+    executor->post([executor, &inner_executed, &inner_executed_before_outer_returned] {
+        executor->post([&inner_executed] {
+            inner_executed = true;
+        });
+
+        inner_executed_before_outer_returned = inner_executed;
+    });
+
+    assert_true(inner_executed);
+    assert_false(inner_executed_before_outer_returned);
+
+    // a non-nested enqueue still executes inline
+    auto executed = false;
+    executor->post([&executed] {
+        executed = true;
+    });
+
+    assert_true(executed);
+}
+
+void concurrencpp::tests::test_inline_executor_trampolined_fifo_order() {
+    auto executor = std::make_shared<inline_executor>(true);
+    executor_shutdowner shutdown(executor);
+
+    std::vector<size_t> order;
+
+    executor->post([executor, &order] {
+        order.emplace_back(0);
+
+        executor->post([executor, &order] {
+            order.emplace_back(2);
+            executor->post([&order] {
+                order.emplace_back(4);
+            });
+        });
+
+        executor->post([&order] {
+            order.emplace_back(3);
+        });
+
+        order.emplace_back(1);
+    });
+
+    assert_equal(order.size(), static_cast<size_t>(5));
+    for (size_t i = 0; i < order.size(); i++) {
+        assert_equal(order[i], i);
+    }
+}
+
+namespace concurrencpp::tests {
+    struct recursive_poster {
+        std::shared_ptr<inline_executor> executor;
+        size_t& counter;
+        const size_t depth;
+
+        void operator()() const {
+            if (++counter == depth) {
+                return;
+            }
+
+            executor->post(*this);
+        }
+    };
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_inline_executor_trampolined_deep_recursion() {
+    // a direct inline_executor would overflow the stack with this depth
+    constexpr size_t depth = 1'000'000;
+    auto executor = std::make_shared<inline_executor>(true);
+    executor_shutdowner shutdown(executor);
+
+    size_t counter = 0;
+    executor->post(recursive_poster {executor, counter, depth});
+
+    assert_equal(counter, depth);
+}
+
+void concurrencpp::tests::test_inline_executor_trampolined_bulk() {
+    object_observer observer;
+    constexpr size_t task_count = 1'024;
+    auto executor = std::make_shared<inline_executor>(true);
+    executor_shutdowner shutdown(executor);
+
+    executor->post([executor, &observer]() mutable {
+        std::vector<testing_stub> stubs;
+        stubs.reserve(task_count);
+
+        for (size_t i = 0; i < task_count; i++) {
+            stubs.emplace_back(observer.get_testing_stub());
+        }
+
+        executor->bulk_post<testing_stub>(stubs);
+        assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+    });
+
+    assert_equal(observer.get_execution_count(), task_count);
+    assert_equal(observer.get_destruction_count(), task_count);
+    assert_executed_inline(observer.get_execution_map());
+}
+
+void concurrencpp::tests::test_inline_executor_trampolined() {
+    test_inline_executor_trampolined_deferred_execution();
+    test_inline_executor_trampolined_fifo_order();
+    test_inline_executor_trampolined_deep_recursion();
+    test_inline_executor_trampolined_bulk();
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -347,6 +473,7 @@ int main() {
     tester.add_step("submit", test_inline_executor_submit);
     tester.add_step("bulk_post", test_inline_executor_bulk_post);
     tester.add_step("bulk_submit", test_inline_executor_bulk_submit);
+    tester.add_step("trampolined", test_inline_executor_trampolined);
 
     tester.launch_test();
     return 0;
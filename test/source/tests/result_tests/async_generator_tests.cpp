@@ -0,0 +1,333 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/test_generators.h"
+#include "utils/executor_shutdowner.h"
+
+using namespace concurrencpp::tests;
+
+namespace concurrencpp::tests {
+    void test_async_generator_move_constructor();
+    void test_async_generator_destructor();
+
+    template<class type>
+    void test_async_generator_next_impl();
+    void test_async_generator_next_empty();
+    void test_async_generator_next_exception();
+    void test_async_generator_next();
+
+    void test_async_generator_begin_end_empty();
+    void test_async_generator_begin_end_exception();
+    void test_async_generator_begin_end();
+
+    void test_async_generator_co_await_in_body();
+    void test_async_generator_backpressure();
+    void test_async_generator_symmetric_transfer();
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_generator_move_constructor() {
+    auto gen0 = []() -> async_generator<int> {
+        co_yield 1;
+    }();
+
+    assert_true(static_cast<bool>(gen0));
+
+    async_generator<int> gen1(std::move(gen0));
+    assert_false(static_cast<bool>(gen0));
+    assert_true(static_cast<bool>(gen1));
+}
+
+void concurrencpp::tests::test_async_generator_destructor() {
+    auto gen_fn = [](testing_stub stub) -> async_generator<int> {
+        co_yield 1;
+        co_yield 2;
+    };
+
+    object_observer observer;
+
+    {
+        auto gen0 = gen_fn(observer.get_testing_stub());
+        auto gen1(std::move(gen0));  // check to see that empty generator d.tor is benign
+    }
+
+    assert_equal(observer.get_destruction_count(), 1);
+
+    // a generator which is destroyed while suspended on co_yield
+    {
+        auto gen = gen_fn(observer.get_testing_stub());
+        auto consumer = [&gen]() -> result<int> {
+            co_return *(co_await gen.next());
+        };
+
+        assert_equal(consumer().get(), 1);
+        assert_equal(observer.get_destruction_count(), 1);
+    }
+
+    assert_equal(observer.get_destruction_count(), 2);
+}
+
+template<class type>
+void concurrencpp::tests::test_async_generator_next_impl() {
+    value_gen<type> val_gen;
+    auto gen_fn = [&val_gen]() -> async_generator<type> {
+        for (size_t i = 0; i < 1024; i++) {
+            co_yield val_gen.value_of(i);
+        }
+    };
+
+    auto gen = gen_fn();
+
+    auto consumer = [&]() -> result<size_t> {
+        size_t counter = 0;
+        while (auto value = co_await gen.next()) {
+            if constexpr (std::is_reference_v<type>) {
+                assert_equal(value, &val_gen.value_of(counter));
+            } else {
+                assert_equal(*value, val_gen.value_of(counter));
+            }
+
+            counter++;
+        }
+
+        // a finished generator keeps returning nullptr
+        assert_equal(co_await gen.next(), nullptr);
+        co_return counter;
+    };
+
+    assert_equal(consumer().get(), static_cast<size_t>(1024));
+}
+
+void concurrencpp::tests::test_async_generator_next_empty() {
+    auto gen0 = []() -> async_generator<int> {
+        co_yield 1;
+    }();
+
+    auto gen1(std::move(gen0));
+    assert_throws_with_error_message<errors::empty_generator>(
+        [&gen0] {
+            gen0.next();
+        },
+        concurrencpp::details::consts::k_empty_async_generator_next_err_msg);
+}
+
+void concurrencpp::tests::test_async_generator_next_exception() {
+    auto gen = []() -> async_generator<int> {
+        for (auto i = 0; i < 10; i++) {
+            if (i != 0 && i % 3 == 0) {
+                throw custom_exception(i);
+            }
+
+            co_yield i;
+        }
+    }();
+
+    auto consumer = [&]() -> result<void> {
+        for (auto i = 0; i < 3; i++) {
+            const auto value = co_await gen.next();
+            assert_equal(*value, i);
+        }
+
+        try {
+            co_await gen.next();
+            assert_false(true);
+        } catch (const custom_exception& ce) {
+            assert_equal(ce.id, 3);
+        }
+
+        // the exception is re-thrown once
+        assert_equal(co_await gen.next(), nullptr);
+    };
+
+    consumer().get();
+}
+
+void concurrencpp::tests::test_async_generator_next() {
+    test_async_generator_next_empty();
+    test_async_generator_next_exception();
+
+    test_async_generator_next_impl<int>();
+    test_async_generator_next_impl<std::string>();
+    test_async_generator_next_impl<int&>();
+    test_async_generator_next_impl<std::string&>();
+}
+
+void concurrencpp::tests::test_async_generator_begin_end_empty() {
+    auto gen0 = []() -> async_generator<int> {
+        co_yield 1;
+    }();
+
+    auto gen1(std::move(gen0));
+    assert_throws_with_error_message<errors::empty_generator>(
+        [&gen0] {
+            gen0.begin();
+        },
+        concurrencpp::details::consts::k_empty_async_generator_begin_err_msg);
+}
+
+void concurrencpp::tests::test_async_generator_begin_end_exception() {
+    auto gen0 = []() -> async_generator<int> {
+        throw custom_exception(1234567);
+        co_yield 1;
+    }();
+
+    auto consumer0 = [&]() -> result<void> {
+        co_await gen0.begin();
+    };
+
+    assert_throws<custom_exception>([&] {
+        consumer0().get();
+    });
+
+    auto gen1 = []() -> async_generator<int> {
+        co_yield 0;
+        co_yield 1;
+        throw custom_exception(2);
+    }();
+
+    auto consumer1 = [&]() -> result<int> {
+        auto it = co_await gen1.begin();
+        assert_equal(*it, 0);
+
+        auto& res = co_await ++it;
+        assert_equal(&res, &it);
+        assert_equal(*it, 1);
+
+        co_await ++it;
+        co_return 0;
+    };
+
+    assert_throws<custom_exception>([&] {
+        consumer1().get();
+    });
+}
+
+void concurrencpp::tests::test_async_generator_begin_end() {
+    test_async_generator_begin_end_empty();
+    test_async_generator_begin_end_exception();
+
+    auto gen = []() -> async_generator<std::string> {
+        for (auto i = 0; i < 1024; i++) {
+            co_yield std::to_string(i);
+        }
+    }();
+
+    auto consumer = [&]() -> result<int> {
+        auto counter = 0;
+        for (auto it = co_await gen.begin(); it != gen.end(); co_await ++it) {
+            assert_equal(*it, std::to_string(counter));
+            assert_equal(it->size(), std::to_string(counter).size());
+            ++counter;
+        }
+
+        co_return counter;
+    };
+
+    assert_equal(consumer().get(), 1024);
+}
+
+void concurrencpp::tests::test_async_generator_co_await_in_body() {
+    const auto executor = std::make_shared<worker_thread_executor>();
+    executor_shutdowner es(executor);
+
+    const auto executor_thread_id = executor->submit([] {
+                                                 return std::this_thread::get_id();
+                                             })
+                                        .get();
+
+    auto gen_fn = [executor]() -> async_generator<int> {
+        for (auto i = 0; i < 256; i++) {
+            auto value = co_await executor->submit([i] {
+                return i * 2;
+            });
+
+            co_yield value;
+        }
+    };
+
+    auto gen = gen_fn();
+
+    auto consumer = [&]() -> result<int> {
+        auto counter = 0;
+        while (const auto value = co_await gen.next()) {
+            // the consumer continues in the thread the producer yielded from
+            assert_equal(std::this_thread::get_id(), executor_thread_id);
+            assert_equal(*value, counter * 2);
+            ++counter;
+        }
+
+        co_return counter;
+    };
+
+    assert_equal(consumer().get(), 256);
+}
+
+void concurrencpp::tests::test_async_generator_backpressure() {
+    size_t produced = 0;
+    auto gen_fn = [&produced]() -> async_generator<size_t> {
+        while (true) {
+            co_yield ++produced;
+        }
+    };
+
+    auto gen = gen_fn();
+
+    assert_equal(produced, static_cast<size_t>(0));
+
+    auto consumer = [&](size_t count) -> result<void> {
+        for (size_t i = 0; i < count; i++) {
+            co_await gen.next();
+        }
+    };
+
+    consumer(10).get();
+    assert_equal(produced, static_cast<size_t>(10));
+
+    consumer(5).get();
+    assert_equal(produced, static_cast<size_t>(15));
+}
+
+void concurrencpp::tests::test_async_generator_symmetric_transfer() {
+    // producer and consumer resume each other synchronously, which must not grow the stack
+#if defined(__OPTIMIZE__) && !defined(__SANITIZE_THREAD__) && !defined(__SANITIZE_ADDRESS__)
+    constexpr size_t count = 1'000'000;
+#else
+    // symmetric transfer is only compiled to a tail call in optimized, uninstrumented builds
+    constexpr size_t count = 10'000;
+#endif
+
+    auto gen = []() -> async_generator<size_t> {
+        for (size_t i = 0; i < count; i++) {
+            co_yield i;
+        }
+    }();
+
+    auto consumer = [&]() -> result<size_t> {
+        size_t sum = 0;
+        while (const auto value = co_await gen.next()) {
+            sum += *value;
+        }
+
+        co_return sum;
+    };
+
+    assert_equal(consumer().get(), count * (count - 1) / 2);
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_generator test");
+
+    tester.add_step("move constructor", test_async_generator_move_constructor);
+    tester.add_step("destructor", test_async_generator_destructor);
+    tester.add_step("next", test_async_generator_next);
+    tester.add_step("begin + end", test_async_generator_begin_end);
+    tester.add_step("co_await in body", test_async_generator_co_await_in_body);
+    tester.add_step("backpressure", test_async_generator_backpressure);
+    tester.add_step("symmetric transfer", test_async_generator_symmetric_transfer);
+
+    tester.launch_test();
+    return 0;
+}
@@ -0,0 +1,473 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/test_generators.h"
+#include "utils/executor_shutdowner.h"
+
+#include <numeric>
+#include <sstream>
+#include <algorithm>
+
+namespace concurrencpp::tests {
+    void test_concurrent_algorithms_null_executor();
+    void test_concurrent_algorithms_zero_concurrency(std::shared_ptr<thread_pool_executor> executor);
+
+    void test_concurrent_for_each_empty_range(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_for_each_concurrency_limit(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_for_each_async_callable(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_for_each_async_callable_resumes_on_executor();
+    void test_concurrent_for_each_exception(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_for_each_input_iterator(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_for_each();
+
+    void test_concurrent_transform_completion_order(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_transform_input_order(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_transform_input_order_window(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_transform_async_callable(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_transform_async_callable_resumes_on_executor();
+    void test_concurrent_transform_exception(std::shared_ptr<thread_pool_executor> executor);
+    void test_concurrent_transform();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    class concurrency_probe {
+
+       private:
+        std::atomic_size_t m_in_flight {0};
+        std::atomic_size_t m_max_in_flight {0};
+
+       public:
+        void enter() noexcept {
+            const auto in_flight = m_in_flight.fetch_add(1, std::memory_order_acq_rel) + 1;
+            auto max_in_flight = m_max_in_flight.load(std::memory_order_relaxed);
+            while (in_flight > max_in_flight &&
+                   !m_max_in_flight.compare_exchange_weak(max_in_flight, in_flight, std::memory_order_relaxed)) {
+            }
+        }
+
+        void leave() noexcept {
+            m_in_flight.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        size_t max_in_flight() const noexcept {
+            return m_max_in_flight.load(std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<size_t> make_sequence(size_t count) {
+        std::vector<size_t> sequence(count);
+        std::iota(sequence.begin(), sequence.end(), 0);
+        return sequence;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_concurrent_algorithms_null_executor() {
+    const auto sequence = make_sequence(8);
+    std::vector<size_t> output;
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            concurrent_for_each(std::shared_ptr<thread_pool_executor> {}, sequence.begin(), sequence.end(), 4, [](size_t) {
+            });
+        },
+        concurrencpp::details::consts::k_concurrent_algorithm_null_executor_error_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            concurrent_transform(std::shared_ptr<thread_pool_executor> {},
+                                 sequence.begin(),
+                                 sequence.end(),
+                                 std::back_inserter(output),
+                                 4,
+                                 [](size_t i) {
+                                     return i;
+                                 });
+        },
+        concurrencpp::details::consts::k_concurrent_algorithm_null_executor_error_msg);
+}
+
+void concurrencpp::tests::test_concurrent_algorithms_zero_concurrency(std::shared_ptr<thread_pool_executor> executor) {
+    const auto sequence = make_sequence(8);
+    std::vector<size_t> output;
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            concurrent_for_each(executor, sequence.begin(), sequence.end(), 0, [](size_t) {
+            });
+        },
+        concurrencpp::details::consts::k_concurrent_algorithm_zero_concurrency_error_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            concurrent_transform(executor, sequence.begin(), sequence.end(), std::back_inserter(output), 0, [](size_t i) {
+                return i;
+            });
+        },
+        concurrencpp::details::consts::k_concurrent_algorithm_zero_concurrency_error_msg);
+}
+
+void concurrencpp::tests::test_concurrent_for_each_empty_range(std::shared_ptr<thread_pool_executor> executor) {
+    std::vector<size_t> sequence;
+    std::atomic_size_t counter = 0;
+
+    concurrent_for_each(executor, sequence.begin(), sequence.end(), 4, [&counter](size_t) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    })
+        .run()
+        .get();
+
+    assert_equal(counter.load(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_concurrent_for_each_concurrency_limit(std::shared_ptr<thread_pool_executor> executor) {
+    constexpr size_t item_count = 1'024;
+    constexpr size_t max_concurrency = 3;
+
+    const auto sequence = make_sequence(item_count);
+    std::vector<std::atomic_size_t> visits(item_count);
+    concurrency_probe probe;
+
+    concurrent_for_each(executor, sequence.begin(), sequence.end(), max_concurrency, [&](size_t i) {
+        probe.enter();
+        visits[i].fetch_add(1, std::memory_order_relaxed);
+        std::this_thread::yield();
+        probe.leave();
+    })
+        .run()
+        .get();
+
+    assert_smaller_equal(probe.max_in_flight(), max_concurrency);
+
+    for (const auto& visit : visits) {
+        assert_equal(visit.load(), static_cast<size_t>(1));
+    }
+}
+
+void concurrencpp::tests::test_concurrent_for_each_async_callable(std::shared_ptr<thread_pool_executor> executor) {
+    constexpr size_t item_count = 256;
+    constexpr size_t max_concurrency = 8;
+
+    auto te = std::make_shared<thread_executor>();
+    executor_shutdowner es(te);
+
+    const auto sequence = make_sequence(item_count);
+    std::atomic_size_t sum = 0;
+    concurrency_probe probe;
+
+    concurrent_for_each(executor, sequence.begin(), sequence.end(), max_concurrency, [&](size_t i) {
+        probe.enter();
+        return te->submit([&probe, &sum, i] {
+            sum.fetch_add(i, std::memory_order_relaxed);
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            probe.leave();
+        });
+    })
+        .run()
+        .get();
+
+    assert_smaller_equal(probe.max_in_flight(), max_concurrency);
+    assert_equal(sum.load(), item_count * (item_count - 1) / 2);
+}
+
+void concurrencpp::tests::test_concurrent_for_each_async_callable_resumes_on_executor() {
+    constexpr size_t item_count = 8;
+
+    auto wte = std::make_shared<worker_thread_executor>();
+    executor_shutdowner es0(wte);
+
+    auto te = std::make_shared<thread_executor>();
+    executor_shutdowner es1(te);
+
+    const auto executor_thread_id = wte->submit([] {
+                                           return std::this_thread::get_id();
+                                       })
+                                        .get();
+
+    // the awaited results complete on threads of te, every invocation must still happen inside wte.
+    const auto sequence = make_sequence(item_count);
+    std::vector<std::thread::id> invoking_threads;
+
+    concurrent_for_each(wte, sequence.begin(), sequence.end(), 1, [&](size_t) {
+        invoking_threads.emplace_back(std::this_thread::get_id());
+        return te->submit([] {
+        });
+    })
+        .run()
+        .get();
+
+    assert_equal(invoking_threads.size(), item_count);
+    for (const auto invoking_thread : invoking_threads) {
+        assert_equal(invoking_thread, executor_thread_id);
+    }
+}
+
+void concurrencpp::tests::test_concurrent_for_each_exception(std::shared_ptr<thread_pool_executor> executor) {
+    constexpr size_t item_count = 10'000;
+    const auto sequence = make_sequence(item_count);
+    std::atomic_size_t counter = 0;
+
+    auto for_each = concurrent_for_each(executor, sequence.begin(), sequence.end(), 4, [&counter](size_t i) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+        if (i == 16) {
+            throw custom_exception(i);
+        }
+    });
+
+    try {
+        for_each.run().get();
+        assert_false(true);
+    } catch (const custom_exception& e) {
+        assert_equal(e.id, static_cast<intptr_t>(16));
+    }
+
+    // once the exception was thrown, no new elements are processed
+    assert_smaller(counter.load(), item_count);
+}
+
+void concurrencpp::tests::test_concurrent_for_each_input_iterator(std::shared_ptr<thread_pool_executor> executor) {
+    std::stringstream stream;
+    for (size_t i = 0; i < 1'000; i++) {
+        stream << i << ' ';
+    }
+
+    std::atomic_size_t sum = 0;
+    concurrent_for_each(executor, std::istream_iterator<size_t>(stream), std::istream_iterator<size_t>(), 4, [&sum](size_t i) {
+        sum.fetch_add(i, std::memory_order_relaxed);
+    })
+        .run()
+        .get();
+
+    assert_equal(sum.load(), static_cast<size_t>(1'000 * 999 / 2));
+}
+
+void concurrencpp::tests::test_concurrent_for_each() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner es(executor);
+
+    test_concurrent_for_each_empty_range(executor);
+    test_concurrent_for_each_concurrency_limit(executor);
+    test_concurrent_for_each_async_callable(executor);
+    test_concurrent_for_each_async_callable_resumes_on_executor();
+    test_concurrent_for_each_exception(executor);
+    test_concurrent_for_each_input_iterator(executor);
+}
+
+void concurrencpp::tests::test_concurrent_transform_completion_order(std::shared_ptr<thread_pool_executor> executor) {
+    constexpr size_t item_count = 1'024;
+    const auto sequence = make_sequence(item_count);
+    std::vector<size_t> output;
+
+    concurrent_transform(executor, sequence.begin(), sequence.end(), std::back_inserter(output), 4, [](size_t i) {
+        return i * 2;
+    })
+        .run()
+        .get();
+
+    assert_equal(output.size(), item_count);
+    std::sort(output.begin(), output.end());
+
+    for (size_t i = 0; i < item_count; i++) {
+        assert_equal(output[i], i * 2);
+    }
+}
+
+void concurrencpp::tests::test_concurrent_transform_input_order(std::shared_ptr<thread_pool_executor> executor) {
+    constexpr size_t item_count = 1'024;
+    const auto sequence = make_sequence(item_count);
+    std::vector<std::string> output(item_count);
+
+    const auto end = concurrent_transform(
+                         executor,
+                         sequence.begin(),
+                         sequence.end(),
+                         output.begin(),
+                         4,
+                         [](size_t i) {
+                             if (i % 7 == 0) {
+                                 std::this_thread::sleep_for(std::chrono::microseconds(100));
+                             }
+
+                             return std::to_string(i);
+                         },
+                         transform_order::input)
+                         .run()
+                         .get();
+
+    assert_true(end == output.end());
+
+    for (size_t i = 0; i < item_count; i++) {
+        assert_equal(output[i], std::to_string(i));
+    }
+}
+
+void concurrencpp::tests::test_concurrent_transform_input_order_window(std::shared_ptr<thread_pool_executor> executor) {
+    constexpr size_t item_count = 64;
+    constexpr size_t max_concurrency = 4;
+
+    // the first element is slow, the others must not run further ahead than the reorder window allows.
+    const auto sequence = make_sequence(item_count);
+    std::atomic_size_t furthest_started = 0;
+    std::atomic_size_t furthest_started_before_head = 0;
+    std::vector<size_t> output;
+
+    concurrent_transform(
+        executor,
+        sequence.begin(),
+        sequence.end(),
+        std::back_inserter(output),
+        max_concurrency,
+        [&](size_t i) {
+            auto furthest = furthest_started.load(std::memory_order_relaxed);
+            while (i > furthest && !furthest_started.compare_exchange_weak(furthest, i, std::memory_order_relaxed)) {
+            }
+
+            if (i == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                furthest_started_before_head.store(furthest_started.load(std::memory_order_relaxed));
+            }
+
+            return i;
+        },
+        transform_order::input)
+        .run()
+        .get();
+
+    assert_smaller(furthest_started_before_head.load(), max_concurrency);
+    assert_equal(output, sequence);
+}
+
+void concurrencpp::tests::test_concurrent_transform_async_callable(std::shared_ptr<thread_pool_executor> executor) {
+    constexpr size_t item_count = 256;
+    constexpr size_t max_concurrency = 8;
+
+    auto te = std::make_shared<thread_executor>();
+    executor_shutdowner es(te);
+
+    const auto sequence = make_sequence(item_count);
+    std::vector<size_t> output;
+    concurrency_probe probe;
+
+    auto transform = [&](size_t i) -> lazy_result<size_t> {
+        probe.enter();
+        co_await resume_on(te);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        probe.leave();
+        co_return i + 1;
+    };
+
+    concurrent_transform(executor, sequence.begin(), sequence.end(), std::back_inserter(output), max_concurrency, transform, transform_order::input)
+        .run()
+        .get();
+
+    assert_smaller_equal(probe.max_in_flight(), max_concurrency);
+    assert_equal(output.size(), item_count);
+
+    for (size_t i = 0; i < item_count; i++) {
+        assert_equal(output[i], i + 1);
+    }
+}
+
+void concurrencpp::tests::test_concurrent_transform_async_callable_resumes_on_executor() {
+    constexpr size_t item_count = 8;
+
+    auto wte = std::make_shared<worker_thread_executor>();
+    executor_shutdowner es0(wte);
+
+    auto te = std::make_shared<thread_executor>();
+    executor_shutdowner es1(te);
+
+    const auto executor_thread_id = wte->submit([] {
+                                           return std::this_thread::get_id();
+                                       })
+                                        .get();
+
+    const auto sequence = make_sequence(item_count);
+    std::vector<std::thread::id> invoking_threads;
+    std::vector<size_t> output;
+
+    auto transform = [&](size_t i) -> lazy_result<size_t> {
+        invoking_threads.emplace_back(std::this_thread::get_id());
+        co_await resume_on(te);
+        co_return i;
+    };
+
+    for (const auto order : {transform_order::completion, transform_order::input}) {
+        invoking_threads.clear();
+        output.clear();
+
+        concurrent_transform(wte, sequence.begin(), sequence.end(), std::back_inserter(output), 1, transform, order).run().get();
+
+        assert_equal(output, sequence);
+        assert_equal(invoking_threads.size(), item_count);
+        for (const auto invoking_thread : invoking_threads) {
+            assert_equal(invoking_thread, executor_thread_id);
+        }
+    }
+}
+
+void concurrencpp::tests::test_concurrent_transform_exception(std::shared_ptr<thread_pool_executor> executor) {
+    constexpr size_t item_count = 10'000;
+    const auto sequence = make_sequence(item_count);
+
+    for (const auto order : {transform_order::completion, transform_order::input}) {
+        std::vector<size_t> output;
+
+        auto transform = concurrent_transform(
+            executor,
+            sequence.begin(),
+            sequence.end(),
+            std::back_inserter(output),
+            4,
+            [](size_t i) {
+                if (i == 16) {
+                    throw custom_exception(i);
+                }
+
+                return i;
+            },
+            order);
+
+        try {
+            transform.run().get();
+            assert_false(true);
+        } catch (const custom_exception& e) {
+            assert_equal(e.id, static_cast<intptr_t>(16));
+        }
+
+        assert_smaller(output.size(), item_count);
+    }
+}
+
+void concurrencpp::tests::test_concurrent_transform() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner es(executor);
+
+    test_concurrent_transform_completion_order(executor);
+    test_concurrent_transform_input_order(executor);
+    test_concurrent_transform_input_order_window(executor);
+    test_concurrent_transform_async_callable(executor);
+    test_concurrent_transform_async_callable_resumes_on_executor();
+    test_concurrent_transform_exception(executor);
+}
+
+using namespace concurrencpp;
+using namespace concurrencpp::tests;
+
+int main() {
+    tester test("concurrent algorithms test");
+
+    test.add_step("invalid arguments", [] {
+        test_concurrent_algorithms_null_executor();
+
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", 1, std::chrono::seconds(10));
+        executor_shutdowner es(executor);
+        test_concurrent_algorithms_zero_concurrency(executor);
+    });
+
+    test.add_step("concurrent_for_each", test_concurrent_for_each);
+    test.add_step("concurrent_transform", test_concurrent_transform);
+
+    test.launch_test();
+    return 0;
+}
@@ -5,10 +5,15 @@
 #include "utils/object_observer.h"
 #include "utils/test_generators.h"
 
+#include <ranges>
+#include <vector>
+#include <numeric>
+
 using namespace concurrencpp::tests;
 
 namespace concurrencpp::tests {
     void test_generator_move_constructor();
+    void test_generator_move_assignment();
     void test_generator_destructor();
     void test_generator_begin();
 
@@ -26,6 +31,12 @@ namespace concurrencpp::tests {
 
     void test_generator_iterator_dereferencing_operators();
     void test_generator_iterator_comparison_operators();
+
+    void test_generator_span_yield_empty_spans();
+    void test_generator_span_yield_exception();
+    void test_generator_span_yield();
+
+    void test_generator_ranges();
 }  // namespace concurrencpp::tests
 
 void concurrencpp::tests::test_generator_move_constructor() {
@@ -40,6 +51,31 @@ void concurrencpp::tests::test_generator_move_constructor() {
     assert_true(static_cast<bool>(gen1));
 }
 
+void concurrencpp::tests::test_generator_move_assignment() {
+    auto gen_fn = [](testing_stub stub) -> generator<int> {
+        co_yield 1;
+    };
+
+    object_observer observer;
+
+    auto gen0 = gen_fn(observer.get_testing_stub());
+    auto gen1 = gen_fn(observer.get_testing_stub());
+
+    gen0 = std::move(gen1);
+    assert_equal(observer.get_destruction_count(), 1);
+    assert_true(static_cast<bool>(gen0));
+    assert_false(static_cast<bool>(gen1));
+
+    gen0 = std::move(gen0);
+    assert_true(static_cast<bool>(gen0));
+    assert_equal(observer.get_destruction_count(), 1);
+
+    // assigning an empty generator
+    gen0 = std::move(gen1);
+    assert_false(static_cast<bool>(gen0));
+    assert_equal(observer.get_destruction_count(), 2);
+}
+
 void concurrencpp::tests::test_generator_destructor() {
     auto gen_fn = [](testing_stub stub) -> generator<int> {
         co_yield 1;
@@ -281,14 +317,159 @@ void concurrencpp::tests::test_generator_iterator_comparison_operators() {
     }
 }
 
+void concurrencpp::tests::test_generator_span_yield_empty_spans() {
+    // empty batches are skipped, including a trailing one
+    auto gen_fn = []() -> generator<int> {
+        std::vector<int> empty;
+        co_yield std::span<int>(empty);
+
+        int values[] = {1, 2};
+        co_yield std::span<int>(values);
+        co_yield std::span<int>(empty);
+        co_yield std::span<int>(empty);
+
+        co_yield 3;
+        co_yield std::span<int>(empty);
+    };
+
+    std::vector<int> received;
+    for (auto value : gen_fn()) {
+        received.emplace_back(value);
+    }
+
+    assert_equal(received, std::vector<int> {1, 2, 3});
+
+    auto empty_gen_fn = []() -> generator<int> {
+        std::vector<int> empty;
+        co_yield std::span<int>(empty);
+    };
+
+    auto empty_gen = empty_gen_fn();
+    assert_true(empty_gen.begin() == empty_gen.end());
+}
+
+void concurrencpp::tests::test_generator_span_yield_exception() {
+    auto gen_fn = []() -> generator<int> {
+        int values[] = {0, 1, 2};
+        co_yield std::span<int>(values);
+        throw custom_exception(3);
+    };
+
+    auto gen = gen_fn();
+    auto it = gen.begin();
+
+    for (auto i = 0; i < 3; i++) {
+        assert_equal(*it, i);
+        if (i != 2) {
+            ++it;
+        }
+    }
+
+    // the exception is only thrown once the batch is consumed
+    assert_throws<custom_exception>([&it] {
+        ++it;
+    });
+}
+
+void concurrencpp::tests::test_generator_span_yield() {
+    test_generator_span_yield_empty_spans();
+    test_generator_span_yield_exception();
+
+    size_t resumptions = 0;
+    auto gen_fn = [&resumptions]() -> generator<size_t> {
+        std::vector<size_t> batch(100);
+
+        for (size_t i = 0; i < 10; i++) {
+            ++resumptions;
+            std::iota(batch.begin(), batch.end(), i * 100);
+            co_yield std::span<size_t>(batch);
+        }
+
+        // single values and batches can be mixed
+        ++resumptions;
+        co_yield 1000;
+        ++resumptions;
+        co_yield batch;  // containers convert to std::span
+    };
+
+    size_t counter = 0;
+    auto gen = gen_fn();
+    for (auto it = gen.begin(); it != gen.end(); ++it) {
+        if (counter < 1001) {
+            assert_equal(*it, counter);
+        } else {
+            assert_equal(*it, 900 + counter - 1001);
+        }
+
+        ++counter;
+    }
+
+    assert_equal(counter, static_cast<size_t>(1101));
+    assert_equal(resumptions, static_cast<size_t>(12));
+
+    // values of a batch are yielded by reference
+    std::vector<std::string> strings {"a", "b", "c"};
+    auto ref_gen_fn = [&strings]() -> generator<std::string&> {
+        co_yield std::span<std::string>(strings);
+    };
+
+    size_t index = 0;
+    for (auto& str : ref_gen_fn()) {
+        assert_equal(&str, &strings[index]);
+        ++index;
+    }
+
+    assert_equal(index, strings.size());
+}
+
+void concurrencpp::tests::test_generator_ranges() {
+    static_assert(std::ranges::input_range<generator<int>>);
+    static_assert(std::ranges::input_range<generator<std::string&>>);
+    static_assert(std::ranges::viewable_range<generator<int>>);
+    static_assert(std::input_iterator<generator<int>::iterator>);
+    static_assert(std::sentinel_for<concurrencpp::details::generator_end_iterator, generator<int>::iterator>);
+
+    auto gen_fn = []() -> generator<int> {
+        std::vector<int> batch(10);
+        for (int i = 0; i < 100; i += 10) {
+            std::iota(batch.begin(), batch.end(), i);
+            co_yield std::span<int>(batch);
+        }
+    };
+
+    // an rvalue generator is piped to a view
+    std::vector<int> received;
+    for (const auto value : gen_fn() | std::views::filter([](int i) {
+                                return i % 2 == 0;
+                            }) | std::views::transform([](int i) {
+                                return i * 3;
+                            }) | std::views::take(5)) {
+        received.emplace_back(value);
+    }
+
+    assert_equal(received, std::vector<int> {0, 6, 12, 18, 24});
+
+    // an lvalue generator is piped to a view
+    auto gen = gen_fn();
+    auto sum = 0;
+    for (const auto value : gen | std::views::drop(90)) {
+        sum += value;
+    }
+
+    assert_equal(sum, 945);
+}
+
 int main() {
     {
         tester tester("generator test");
 
         tester.add_step("move constructor", test_generator_move_constructor);
+        tester.add_step("move assignment", test_generator_move_assignment);
         tester.add_step("destructor", test_generator_destructor);
         tester.add_step("begin", test_generator_begin);
         tester.add_step("begin + end", test_generator_begin_end);
+        tester.add_step("co_yield std::span", test_generator_span_yield);
+        tester.add_step("std::ranges", test_generator_ranges);
 
         tester.launch_test();
     }
@@ -338,6 +338,37 @@ void concurrencpp::tests::test_result_wait_impl() {
         test_ready_result(std::move(result));
         thread.join();
     }
+
+    // wait is correct whether the spin phase is disabled, ends before the result is ready or outlasts the producer
+    {
+        const auto spin_limit_0 = concurrencpp::wait_spin_limit();
+
+        for (const size_t spin_limit : {size_t(0), size_t(16), size_t(1'024), size_t(1) << 20}) {
+            concurrencpp::set_wait_spin_limit(spin_limit);
+            assert_equal(concurrencpp::wait_spin_limit(), spin_limit);
+
+            for (size_t i = 0; i < 64; i++) {
+                result_promise<type> rp;
+                auto result = rp.get_result();
+
+                std::thread thread([rp = std::move(rp), i]() mutable {
+                    if (i % 2 == 0) {
+                        std::this_thread::yield();
+                    } else {
+                        std::this_thread::sleep_for(microseconds(i));
+                    }
+
+                    rp.set_from_function(value_gen<type>::default_value);
+                });
+
+                result.wait();
+                test_ready_result(std::move(result));
+                thread.join();
+            }
+        }
+
+        concurrencpp::set_wait_spin_limit(spin_limit_0);
+    }
 }
 
 void concurrencpp::tests::test_result_wait() {
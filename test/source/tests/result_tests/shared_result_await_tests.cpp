@@ -12,6 +12,10 @@ namespace concurrencpp::tests {
     template<class type>
     void test_shared_result_await_impl();
     void test_shared_result_await();
+
+    void test_shared_result_await_via_executor_resumes_in_executor();
+    void test_shared_result_await_via_executor_shutdown();
+    void test_shared_result_await_via_executor();
 }  // namespace concurrencpp::tests
 
 using concurrencpp::result;
@@ -130,11 +134,14 @@ namespace concurrencpp::tests {
 
             auto result = inner_task(manual_executor);
 
-            co_await thread_executor->submit([this, manual_executor] {
+            // keep the capturing lambda out of the co_await expression: GCC 12 destroys such temporaries twice
+            auto setting_result = thread_executor->submit([this, manual_executor] {
                 m_setting_thread_id = concurrencpp::details::thread::get_current_virtual_id();
                 assert_true(manual_executor->loop_once());
             });
 
+            co_await setting_result;
+
             co_await result;
 
             assert_equal(m_setting_thread_id, m_resuming_thread_id);
@@ -173,11 +180,14 @@ namespace concurrencpp::tests {
 
             auto result = inner_task(manual_executor);
 
-            co_await thread_executor->submit([this, manual_executor] {
+            // keep the capturing lambda out of the co_await expression: GCC 12 destroys such temporaries twice
+            auto setting_result = thread_executor->submit([this, manual_executor] {
                 m_setting_thread_id = concurrencpp::details::thread::get_current_virtual_id();
                 assert_true(manual_executor->loop_once());
             });
 
+            co_await setting_result;
+
             co_await result;
 
             assert_equal(m_setting_thread_id, m_resuming_thread_id);
@@ -225,12 +235,91 @@ void concurrencpp::tests::test_shared_result_await() {
     test_shared_result_await_impl<std::string&>();
 }
 
+namespace concurrencpp::tests {
+    result<size_t> await_shared_result_via(shared_result<int> sr, std::atomic_size_t& resumed_in_caller_thread, uintptr_t caller_thread_id) {
+        const auto value = co_await sr;
+
+        if (thread::get_current_virtual_id() == caller_thread_id) {
+            resumed_in_caller_thread.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        co_return static_cast<size_t>(value);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_shared_result_await_via_executor_resumes_in_executor() {
+    constexpr size_t awaiter_count = 1'024;
+
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner es(executor);
+
+    result_promise<int> rp;
+    shared_result<int> sr(rp.get_result(), executor);
+
+    const auto caller_thread_id = thread::get_current_virtual_id();
+    std::atomic_size_t resumed_in_caller_thread = 0;
+    std::vector<result<size_t>> results;
+    results.reserve(awaiter_count);
+
+    for (size_t i = 0; i < awaiter_count; i++) {
+        results.emplace_back(await_shared_result_via(sr, resumed_in_caller_thread, caller_thread_id));
+    }
+
+    rp.set_result(123);
+
+    for (auto& result : results) {
+        assert_equal(result.get(), static_cast<size_t>(123));
+    }
+
+    assert_equal(resumed_in_caller_thread.load(), static_cast<size_t>(0));
+
+    // a shared result which is already ready resumes the awaiter inline
+    results.clear();
+    results.emplace_back(await_shared_result_via(sr, resumed_in_caller_thread, caller_thread_id));
+
+    assert_equal(results[0].get(), static_cast<size_t>(123));
+    assert_equal(resumed_in_caller_thread.load(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_shared_result_await_via_executor_shutdown() {
+    constexpr size_t awaiter_count = 16;
+
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+
+    result_promise<int> rp;
+    shared_result<int> sr(rp.get_result(), executor);
+
+    std::atomic_size_t resumed_in_caller_thread = 0;
+    std::vector<result<size_t>> results;
+
+    for (size_t i = 0; i < awaiter_count; i++) {
+        results.emplace_back(await_shared_result_via(sr, resumed_in_caller_thread, thread::get_current_virtual_id()));
+    }
+
+    executor->shutdown();
+    rp.set_result(123);
+
+    for (auto& result : results) {
+        assert_throws_with_error_message<concurrencpp::errors::broken_task>(
+            [&result] {
+                result.get();
+            },
+            concurrencpp::details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
+void concurrencpp::tests::test_shared_result_await_via_executor() {
+    test_shared_result_await_via_executor_resumes_in_executor();
+    test_shared_result_await_via_executor_shutdown();
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
     tester tester("shared_result::await");
 
     tester.add_step("await", test_shared_result_await);
+    tester.add_step("await via resume executor", test_shared_result_await_via_executor);
 
     tester.launch_test();
     return 0;
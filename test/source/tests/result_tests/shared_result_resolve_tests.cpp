@@ -105,11 +105,14 @@ namespace concurrencpp::tests {
 
             auto result = inner_task(manual_executor);
 
-            co_await thread_executor->submit([this, manual_executor] {
+            // keep the capturing lambda out of the co_await expression: GCC 12 destroys such temporaries twice
+            auto setting_result = thread_executor->submit([this, manual_executor] {
                 m_setting_thread_id = thread::get_current_virtual_id();
                 assert_true(manual_executor->loop_once());
             });
 
+            co_await setting_result;
+
             co_await result;
 
             assert_equal(m_setting_thread_id, m_resuming_thread_id);
@@ -144,11 +147,14 @@ namespace concurrencpp::tests {
 
             auto result = inner_task(manual_executor);
 
-            co_await thread_executor->submit([this, manual_executor] {
+            // keep the capturing lambda out of the co_await expression: GCC 12 destroys such temporaries twice
+            auto setting_result = thread_executor->submit([this, manual_executor] {
                 m_setting_thread_id = concurrencpp::details::thread::get_current_virtual_id();
                 assert_true(manual_executor->loop_once());
             });
 
+            co_await setting_result;
+
             co_await result;
 
             assert_equal(m_setting_thread_id, m_resuming_thread_id);
@@ -86,6 +86,21 @@ void concurrencpp::tests::test_shared_result_constructor_impl() {
     assert_false(static_cast<bool>(sr));
     assert_true(static_cast<bool>(new_result));
     assert_equal(new_result.status(), result_status::idle);
+
+    // from result, with a null resume executor
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            result_promise<type> rp;
+            shared_result<type> sr(rp.get_result(), std::shared_ptr<inline_executor> {});
+        },
+        concurrencpp::details::consts::k_shared_result_null_resume_executor_error_msg);
+
+    // from result, with a resume executor
+    result_promise<type> rp1;
+    shared_result<type> sr1(rp1.get_result(), std::make_shared<inline_executor>());
+
+    assert_true(static_cast<bool>(sr1));
+    assert_equal(sr1.status(), result_status::idle);
 }
 
 void concurrencpp::tests::test_shared_result_constructor() {
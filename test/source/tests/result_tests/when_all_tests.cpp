@@ -26,6 +26,9 @@ namespace concurrencpp::tests {
     template<class type>
     void test_when_all_vector_resuming_mechanism(std::shared_ptr<worker_thread_executor> resume_executor);
 
+    template<class type>
+    void test_when_all_vector_partially_ready(std::shared_ptr<inline_executor> resume_executor);
+
     template<class type>
     void test_when_all_vector_impl();
     void test_when_all_vector();
@@ -188,6 +191,37 @@ void concurrencpp::tests::test_when_all_vector_resuming_mechanism(std::shared_pt
     assert_not_equal(this_thread_id.load(), resuming_thread_id.load());
 }
 
+template<class type>
+void concurrencpp::tests::test_when_all_vector_partially_ready(std::shared_ptr<inline_executor> resume_executor) {
+    constexpr size_t task_count = 64;
+    std::vector<result_promise<type>> result_promises(task_count / 2);
+    std::vector<result<type>> results;
+    results.reserve(task_count);
+
+    // ready and pending results are interleaved, the pending ones are completed out of order
+    for (size_t i = 0; i < task_count / 2; i++) {
+        results.emplace_back(result_gen<type>::ready());
+        results.emplace_back(result_promises[i].get_result());
+    }
+
+    auto all = when_all(resume_executor, results.begin(), results.end()).run();
+
+    for (size_t i = result_promises.size(); i > 1; i--) {
+        result_promises[i - 1].set_from_function(value_gen<type>::default_value);
+        assert_equal(all.status(), result_status::idle);
+    }
+
+    result_promises[0].set_from_function(value_gen<type>::default_value);
+    assert_equal(all.status(), result_status::value);
+
+    auto done_results = all.get();
+    assert_equal(done_results.size(), task_count);
+
+    for (auto& done_result : done_results) {
+        test_ready_result(std::move(done_result));
+    }
+}
+
 template<class type>
 void concurrencpp::tests::test_when_all_vector_impl() {
     const auto wte = std::make_shared<concurrencpp::worker_thread_executor>();
@@ -202,6 +236,11 @@ void concurrencpp::tests::test_when_all_vector_impl() {
 
     test_when_all_vector_valid<type>(wte, ex).get();
     test_when_all_vector_resuming_mechanism<type>(wte);
+
+    const auto ie = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner shutdown2(ie);
+
+    test_when_all_vector_partially_ready<type>(ie);
 }
 
 void concurrencpp::tests::test_when_all_vector() {
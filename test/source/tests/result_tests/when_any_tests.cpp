@@ -40,6 +40,13 @@ namespace concurrencpp::tests {
     void test_when_any_tuple_resuming_mechanism(std::shared_ptr<worker_thread_executor> wte);
 
     void test_when_any_tuple();
+
+    void test_when_any_stop_source_vector(std::shared_ptr<inline_executor> resume_executor);
+    void test_when_any_stop_source_tuple(std::shared_ptr<inline_executor> resume_executor);
+    void test_when_any_stop_source_ready_result(std::shared_ptr<inline_executor> resume_executor);
+    result<void> test_when_any_stop_source_cooperative_producers(std::shared_ptr<inline_executor> resume_executor,
+                                                                 std::shared_ptr<thread_executor> ex);
+    void test_when_any_stop_source();
 }  // namespace concurrencpp::tests
 
 template<class type>
@@ -453,6 +460,117 @@ void concurrencpp::tests::test_when_any_tuple() {
     test_when_any_tuple_resuming_mechanism(wte);
 }
 
+void concurrencpp::tests::test_when_any_stop_source_vector(std::shared_ptr<inline_executor> resume_executor) {
+    constexpr size_t task_count = 16;
+    std::vector<result_promise<int>> result_promises(task_count);
+    std::vector<result<int>> results;
+
+    for (auto& rp : result_promises) {
+        results.emplace_back(rp.get_result());
+    }
+
+    std::stop_source stop_source;
+    auto any = when_any(stop_source, resume_executor, results.begin(), results.end()).run();
+
+    assert_false(stop_source.stop_requested());
+    assert_equal(any.status(), result_status::idle);
+
+    result_promises[7].set_result(7);
+
+    assert_true(stop_source.stop_requested());
+    assert_equal(any.status(), result_status::value);
+
+    auto done = any.get();
+    assert_equal(done.index, static_cast<size_t>(7));
+    assert_equal(done.results[7].get(), 7);
+
+    // the losers were unsubscribed and can be consumed normally.
+    result_promises[3].set_result(3);
+    assert_equal(done.results[3].get(), 3);
+}
+
+void concurrencpp::tests::test_when_any_stop_source_tuple(std::shared_ptr<inline_executor> resume_executor) {
+    result_promise<int> rp_int;
+    result_promise<std::string> rp_str;
+
+    std::stop_source stop_source;
+    auto any = when_any(stop_source, resume_executor, rp_int.get_result(), rp_str.get_result()).run();
+
+    assert_false(stop_source.stop_requested());
+
+    rp_str.set_result("winner");
+
+    assert_true(stop_source.stop_requested());
+
+    auto done = any.get();
+    assert_equal(done.index, static_cast<size_t>(1));
+    assert_equal(std::get<1>(done.results).get(), std::string("winner"));
+
+    rp_int.set_result(1);
+    assert_equal(std::get<0>(done.results).get(), 1);
+}
+
+void concurrencpp::tests::test_when_any_stop_source_ready_result(std::shared_ptr<inline_executor> resume_executor) {
+    result_promise<int> rp;
+    std::vector<result<int>> results;
+    results.emplace_back(rp.get_result());
+    results.emplace_back(make_ready_result<int>(1));
+
+    std::stop_source stop_source;
+    auto any = when_any(stop_source, resume_executor, results.begin(), results.end()).run();
+
+    assert_true(stop_source.stop_requested());
+    assert_equal(any.get().index, static_cast<size_t>(1));
+
+    rp.set_result(0);
+}
+
+concurrencpp::result<void> concurrencpp::tests::test_when_any_stop_source_cooperative_producers(
+    std::shared_ptr<inline_executor> resume_executor,
+    std::shared_ptr<thread_executor> ex) {
+    constexpr size_t task_count = 8;
+    constexpr size_t winner_index = 5;
+
+    std::stop_source stop_source;
+    std::vector<result<size_t>> results;
+
+    for (size_t i = 0; i < task_count; i++) {
+        results.emplace_back(ex->submit([i, stop_token = stop_source.get_token()] {
+            if (i == winner_index) {
+                return i;
+            }
+
+            while (!stop_token.stop_requested()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            return task_count;
+        }));
+    }
+
+    auto any = co_await when_any(stop_source, resume_executor, results.begin(), results.end());
+    assert_equal(any.index, winner_index);
+
+    // the losers only return once they observed the stop request.
+    auto all = co_await when_all(resume_executor, any.results.begin(), any.results.end());
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(all[i].get(), i == winner_index ? winner_index : task_count);
+    }
+}
+
+void concurrencpp::tests::test_when_any_stop_source() {
+    auto ie = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es0(ie);
+
+    test_when_any_stop_source_vector(ie);
+    test_when_any_stop_source_tuple(ie);
+    test_when_any_stop_source_ready_result(ie);
+
+    auto ex = std::make_shared<concurrencpp::thread_executor>();
+    executor_shutdowner es1(ex);
+    test_when_any_stop_source_cooperative_producers(ie, ex).get();
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -460,6 +578,7 @@ int main() {
 
     test.add_step("when_any(begin, end)", test_when_any_vector);
     test.add_step("when_any(result_types&& ... results)", test_when_any_tuple);
+    test.add_step("when_any(stop_source, ...)", test_when_any_stop_source);
 
     test.launch_test();
     return 0;
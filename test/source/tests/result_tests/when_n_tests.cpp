@@ -0,0 +1,267 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/test_generators.h"
+#include "utils/test_ready_result.h"
+#include "utils/executor_shutdowner.h"
+
+#include <algorithm>
+
+namespace concurrencpp::tests {
+    void test_when_n_empty_result(std::shared_ptr<inline_executor> resume_executor);
+    void test_when_n_null_resume_executor();
+    void test_when_n_count_out_of_range(std::shared_ptr<inline_executor> resume_executor);
+    void test_when_n_zero_count(std::shared_ptr<inline_executor> resume_executor);
+    void test_when_n_completed_policy(std::shared_ptr<inline_executor> resume_executor);
+    void test_when_n_ready_results(std::shared_ptr<inline_executor> resume_executor);
+    void test_when_n_succeeded_policy(std::shared_ptr<inline_executor> resume_executor);
+    void test_when_n_succeeded_policy_not_enough_values(std::shared_ptr<inline_executor> resume_executor);
+    result<void> test_when_n_concurrent_producers(std::shared_ptr<worker_thread_executor> resume_executor,
+                                                  std::shared_ptr<thread_executor> ex);
+    void test_when_n();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    std::vector<result<int>> make_pending_results(std::vector<result_promise<int>>& result_promises) {
+        std::vector<result<int>> results;
+        results.reserve(result_promises.size());
+
+        for (auto& rp : result_promises) {
+            results.emplace_back(rp.get_result());
+        }
+
+        return results;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_when_n_empty_result(std::shared_ptr<inline_executor> resume_executor) {
+    std::vector<result_promise<int>> result_promises(4);
+    auto results = make_pending_results(result_promises);
+    results.emplace_back();
+
+    assert_throws_with_error_message<errors::empty_result>(
+        [&] {
+            when_n(resume_executor, 1, results.begin(), results.end());
+        },
+        concurrencpp::details::consts::k_when_n_empty_result_error_msg);
+
+    const auto all_valid = std::all_of(results.begin(), results.end() - 1, [](const auto& result) {
+        return static_cast<bool>(result);
+    });
+
+    assert_true(all_valid);
+}
+
+void concurrencpp::tests::test_when_n_null_resume_executor() {
+    std::vector<result_promise<int>> result_promises(4);
+    auto results = make_pending_results(result_promises);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            when_n(std::shared_ptr<inline_executor> {}, 1, results.begin(), results.end());
+        },
+        concurrencpp::details::consts::k_when_n_null_resume_executor_error_msg);
+}
+
+void concurrencpp::tests::test_when_n_count_out_of_range(std::shared_ptr<inline_executor> resume_executor) {
+    std::vector<result_promise<int>> result_promises(4);
+    auto results = make_pending_results(result_promises);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            when_n(resume_executor, 5, results.begin(), results.end());
+        },
+        concurrencpp::details::consts::k_when_n_count_out_of_range_error_msg);
+
+    const auto all_valid = std::all_of(results.begin(), results.end(), [](const auto& result) {
+        return static_cast<bool>(result);
+    });
+
+    assert_true(all_valid);
+}
+
+void concurrencpp::tests::test_when_n_zero_count(std::shared_ptr<inline_executor> resume_executor) {
+    std::vector<result_promise<int>> result_promises(4);
+    auto results = make_pending_results(result_promises);
+
+    auto some = when_n(resume_executor, 0, results.begin(), results.end()).run();
+    assert_equal(some.status(), result_status::value);
+
+    auto done = some.get();
+    assert_true(done.indices.empty());
+    assert_equal(done.results.size(), static_cast<size_t>(4));
+}
+
+void concurrencpp::tests::test_when_n_completed_policy(std::shared_ptr<inline_executor> resume_executor) {
+    constexpr size_t task_count = 16;
+    std::vector<result_promise<int>> result_promises(task_count);
+    auto results = make_pending_results(result_promises);
+
+    auto some = when_n(resume_executor, 3, results.begin(), results.end()).run();
+
+    result_promises[12].set_result(12);
+    result_promises[4].set_exception(std::make_exception_ptr(custom_exception(4)));
+    assert_equal(some.status(), result_status::idle);
+
+    result_promises[9].set_result(9);
+    assert_equal(some.status(), result_status::value);
+
+    auto done = some.get();
+    assert_equal(done.indices.size(), static_cast<size_t>(3));
+    assert_equal(done.indices[0], static_cast<size_t>(4));
+    assert_equal(done.indices[1], static_cast<size_t>(9));
+    assert_equal(done.indices[2], static_cast<size_t>(12));
+
+    test_ready_result(std::move(done.results[9]), 9);
+    test_ready_result(std::move(done.results[12]), 12);
+    test_ready_result_custom_exception(std::move(done.results[4]), 4);
+
+    // the remaining results were unsubscribed and can be consumed normally.
+    result_promises[0].set_result(0);
+    test_ready_result(std::move(done.results[0]), 0);
+}
+
+void concurrencpp::tests::test_when_n_ready_results(std::shared_ptr<inline_executor> resume_executor) {
+    std::vector<result_promise<int>> result_promises(4);
+    auto results = make_pending_results(result_promises);
+    results.emplace_back(make_ready_result<int>(4));
+    results.emplace_back(make_ready_result<int>(5));
+
+    // enough results are ready up front
+    {
+        auto some = when_n(resume_executor, 2, results.begin(), results.end()).run();
+        assert_equal(some.status(), result_status::value);
+
+        auto done = some.get();
+        assert_equal(done.indices.size(), static_cast<size_t>(2));
+        assert_equal(done.indices[0], static_cast<size_t>(4));
+        assert_equal(done.indices[1], static_cast<size_t>(5));
+
+        results = std::move(done.results);
+    }
+
+    // ready results count towards the total
+    {
+        auto some = when_n(resume_executor, 3, results.begin(), results.end()).run();
+        assert_equal(some.status(), result_status::idle);
+
+        result_promises[1].set_result(1);
+        assert_equal(some.status(), result_status::value);
+
+        auto done = some.get();
+        assert_equal(done.indices.size(), static_cast<size_t>(3));
+        assert_equal(done.indices[0], static_cast<size_t>(1));
+    }
+}
+
+void concurrencpp::tests::test_when_n_succeeded_policy(std::shared_ptr<inline_executor> resume_executor) {
+    constexpr size_t task_count = 8;
+    std::vector<result_promise<int>> result_promises(task_count);
+    auto results = make_pending_results(result_promises);
+
+    auto some = when_n(resume_executor, 2, results.begin(), results.end(), when_n_policy::succeeded).run();
+
+    result_promises[0].set_exception(std::make_exception_ptr(custom_exception(0)));
+    result_promises[1].set_result(1);
+    result_promises[2].set_exception(std::make_exception_ptr(custom_exception(2)));
+    assert_equal(some.status(), result_status::idle);
+
+    result_promises[6].set_result(6);
+    assert_equal(some.status(), result_status::value);
+
+    auto done = some.get();
+    assert_equal(done.indices.size(), static_cast<size_t>(2));
+    assert_equal(done.indices[0], static_cast<size_t>(1));
+    assert_equal(done.indices[1], static_cast<size_t>(6));
+
+    test_ready_result_custom_exception(std::move(done.results[0]), 0);
+}
+
+void concurrencpp::tests::test_when_n_succeeded_policy_not_enough_values(std::shared_ptr<inline_executor> resume_executor) {
+    constexpr size_t task_count = 4;
+    std::vector<result_promise<int>> result_promises(task_count);
+    auto results = make_pending_results(result_promises);
+
+    auto some = when_n(resume_executor, 3, results.begin(), results.end(), when_n_policy::succeeded).run();
+
+    result_promises[0].set_result(0);
+    result_promises[1].set_exception(std::make_exception_ptr(custom_exception(1)));
+    result_promises[2].set_exception(std::make_exception_ptr(custom_exception(2)));
+    assert_equal(some.status(), result_status::idle);
+
+    // a quorum can't be reached anymore, but the lazy result still becomes ready once all results are done.
+    result_promises[3].set_result(3);
+    assert_equal(some.status(), result_status::value);
+
+    auto done = some.get();
+    assert_equal(done.indices.size(), static_cast<size_t>(2));
+    assert_equal(done.indices[0], static_cast<size_t>(0));
+    assert_equal(done.indices[1], static_cast<size_t>(3));
+}
+
+concurrencpp::result<void> concurrencpp::tests::test_when_n_concurrent_producers(std::shared_ptr<worker_thread_executor> resume_executor,
+                                                                               std::shared_ptr<thread_executor> ex) {
+    constexpr size_t task_count = 512;
+    constexpr size_t quorum = 128;
+
+    for (size_t round = 0; round < 8; round++) {
+        std::vector<result<size_t>> results;
+        results.reserve(task_count);
+
+        for (size_t i = 0; i < task_count; i++) {
+            results.emplace_back(ex->submit([i]() -> size_t {
+                if (i % 2 == 0) {
+                    throw custom_exception(i);
+                }
+
+                return i;
+            }));
+        }
+
+        auto done = co_await when_n(resume_executor, quorum, results.begin(), results.end(), when_n_policy::succeeded);
+        assert_true(done.indices.size() >= quorum);
+
+        for (const auto index : done.indices) {
+            assert_equal(index % 2, static_cast<size_t>(1));
+            assert_equal(done.results[index].status(), result_status::value);
+        }
+
+        for (auto& result : done.results) {
+            co_await result.resolve();
+        }
+    }
+}
+
+void concurrencpp::tests::test_when_n() {
+    auto ie = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es0(ie);
+
+    test_when_n_empty_result(ie);
+    test_when_n_null_resume_executor();
+    test_when_n_count_out_of_range(ie);
+    test_when_n_zero_count(ie);
+    test_when_n_completed_policy(ie);
+    test_when_n_ready_results(ie);
+    test_when_n_succeeded_policy(ie);
+    test_when_n_succeeded_policy_not_enough_values(ie);
+
+    auto wte = std::make_shared<concurrencpp::worker_thread_executor>();
+    executor_shutdowner es1(wte);
+
+    auto ex = std::make_shared<concurrencpp::thread_executor>();
+    executor_shutdowner es2(ex);
+
+    test_when_n_concurrent_producers(wte, ex).get();
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester test("when_n test");
+
+    test.add_step("when_n(count, begin, end)", test_when_n);
+
+    test.launch_test();
+    return 0;
+}
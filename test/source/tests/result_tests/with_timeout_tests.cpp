@@ -0,0 +1,315 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/custom_exception.h"
+#include "utils/test_ready_result.h"
+#include "utils/executor_shutdowner.h"
+
+#include <stop_token>
+
+using namespace std::chrono_literals;
+
+namespace concurrencpp::tests {
+    void test_with_timeout_null_arguments();
+    void test_with_timeout_ready_result();
+    void test_with_timeout_result_completes_first();
+    void test_with_timeout_timeout_expires_first();
+    void test_with_deadline();
+    void test_with_timeout_timer_queue_shutdown();
+    void test_with_timeout_concurrent_producers();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    template<class type>
+    result<timeout_result<type>> await_with_timeout(std::stop_source stop_source,
+                                                    result<type> result,
+                                                    std::shared_ptr<timer_queue> timer_queue,
+                                                    std::chrono::nanoseconds timeout,
+                                                    std::shared_ptr<executor> executor) {
+        co_return co_await with_timeout(std::move(stop_source), std::move(result), std::move(timer_queue), timeout, std::move(executor));
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_with_timeout_null_arguments() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    assert_throws_with_error_message<errors::empty_result>(
+        [&] {
+            with_timeout(result<int> {}, timer_queue, 100ms, executor);
+        },
+        concurrencpp::details::consts::k_with_timeout_empty_result_error_msg);
+
+    assert_throws_with_error_message<errors::empty_result>(
+        [&] {
+            with_deadline(lazy_result<int> {}, timer_queue, timer_queue::clock_type::now() + 100ms, executor);
+        },
+        concurrencpp::details::consts::k_with_timeout_empty_result_error_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            result_promise<int> rp;
+            with_timeout(rp.get_result(), {}, 100ms, executor);
+        },
+        concurrencpp::details::consts::k_with_timeout_null_timer_queue_error_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            result_promise<int> rp;
+            with_timeout(rp.get_result(), timer_queue, 100ms, {});
+        },
+        concurrencpp::details::consts::k_with_timeout_null_executor_error_msg);
+
+    // the arguments are checked before a lazy result is started.
+    bool started = false;
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            with_timeout(
+                [](bool& started) -> lazy_result<void> {
+                    started = true;
+                    co_return;
+                }(started),
+                timer_queue,
+                100ms,
+                {});
+        },
+        concurrencpp::details::consts::k_with_timeout_null_executor_error_msg);
+
+    assert_false(started);
+}
+
+void concurrencpp::tests::test_with_timeout_ready_result() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    std::stop_source stop_source;
+    auto value = await_with_timeout(stop_source, make_ready_result<int>(123), timer_queue, 1h, executor).get();
+    assert_false(value.timed_out());
+    assert_true(static_cast<bool>(value));
+    assert_equal(value.get(), 123);
+    assert_false(stop_source.stop_requested());
+
+    auto error = await_with_timeout(stop_source,
+                                    make_exceptional_result<int>(std::make_exception_ptr(custom_exception(7))),
+                                    timer_queue,
+                                    1h,
+                                    executor)
+                     .get();
+    assert_false(error.timed_out());
+    test_ready_result_custom_exception(error.release(), 7);
+
+    // lazy results are started and awaited like the results they return.
+    auto lazy = [](std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                   std::shared_ptr<concurrencpp::executor> executor) -> result<std::string> {
+        auto outcome = co_await with_timeout(
+            []() -> lazy_result<std::string> {
+                co_return "lazy";
+            }(),
+            timer_queue,
+            1h,
+            executor);
+
+        co_return outcome.get();
+    }(timer_queue, executor);
+
+    assert_equal(lazy.get(), std::string("lazy"));
+}
+
+void concurrencpp::tests::test_with_timeout_result_completes_first() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    std::stop_source stop_source;
+    result_promise<int> rp;
+    auto outcome = await_with_timeout(stop_source, rp.get_result(), timer_queue, 1h, executor);
+    assert_equal(outcome.status(), result_status::idle);
+
+    // resumes the awaiting coroutine inline.
+    rp.set_result(42);
+    assert_equal(outcome.status(), result_status::value);
+
+    auto value = outcome.get();
+    assert_false(value.timed_out());
+    assert_equal(value.get(), 42);
+    assert_false(stop_source.stop_requested());
+
+    result_promise<void> error_rp;
+    auto error = await_with_timeout(stop_source, error_rp.get_result(), timer_queue, 1h, executor);
+    error_rp.set_exception(std::make_exception_ptr(custom_exception(3)));
+
+    auto error_outcome = error.get();
+    assert_false(error_outcome.timed_out());
+    assert_throws<custom_exception>([&error_outcome] {
+        error_outcome.get();
+    });
+
+    // the timers of the results above were cancelled, shutting down doesn't interrupt anything.
+    timer_queue->shutdown();
+}
+
+void concurrencpp::tests::test_with_timeout_timeout_expires_first() {
+    for (const auto backend : {timer_queue_backend::ordered_set, timer_queue_backend::timing_wheel}) {
+        auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s, nullptr, nullptr, backend);
+        auto executor = std::make_shared<inline_executor>();
+        executor_shutdowner es(executor);
+
+        std::stop_source stop_source;
+        result_promise<int> rp;
+
+        const auto before = timer_queue::clock_type::now();
+        auto outcome = await_with_timeout(stop_source, rp.get_result(), timer_queue, 50ms, executor).get();
+        assert_bigger_equal(timer_queue::clock_type::now() - before, 50ms);
+
+        assert_true(outcome.timed_out());
+        assert_false(static_cast<bool>(outcome));
+        assert_true(stop_source.stop_requested());
+
+        assert_throws_with_error_message<errors::timeout>(
+            [&outcome] {
+                outcome.get();
+            },
+            concurrencpp::details::consts::k_timeout_result_get_timed_out_error_msg);
+
+        // the result was unsubscribed and can be consumed normally.
+        auto result = outcome.release();
+        assert_equal(result.status(), result_status::idle);
+
+        rp.set_result(1);
+        test_ready_result(std::move(result), 1);
+    }
+}
+
+void concurrencpp::tests::test_with_deadline() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto thread_pool_executor = std::make_shared<concurrencpp::thread_pool_executor>("threadpool", 2, 10s);
+    executor_shutdowner es(thread_pool_executor);
+
+    auto awaiter = [](std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                      std::shared_ptr<concurrencpp::executor> executor,
+                      result<int> result,
+                      timer_queue::time_point deadline) -> concurrencpp::result<bool> {
+        auto outcome = co_await with_deadline(std::move(result), timer_queue, deadline, executor);
+        co_return outcome.timed_out();
+    };
+
+    // a deadline that already passed times out right away, on the given executor.
+    result_promise<int> rp0, rp1;
+    assert_true(awaiter(timer_queue, thread_pool_executor, rp0.get_result(), timer_queue::clock_type::now() - 1s).get());
+
+    const auto deadline = timer_queue::clock_type::now() + 30ms;
+    assert_true(awaiter(timer_queue, thread_pool_executor, rp1.get_result(), deadline).get());
+    assert_bigger_equal(timer_queue::clock_type::now(), deadline);
+
+    // a result that is ready wins even if the deadline passed.
+    assert_false(awaiter(timer_queue, thread_pool_executor, make_ready_result<int>(0), timer_queue::clock_type::now() - 1s).get());
+
+    // a producer that observes the stop token abandons its work once the deadline passes.
+    std::stop_source stop_source;
+    auto producer = thread_pool_executor->submit([stop_token = stop_source.get_token()] {
+        while (!stop_token.stop_requested()) {
+            std::this_thread::sleep_for(1ms);
+        }
+    });
+
+    auto stoppable = [](std::stop_source stop_source,
+                        result<void> producer,
+                        std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                        std::shared_ptr<concurrencpp::executor> executor) -> result<void> {
+        auto outcome = co_await with_deadline(std::move(stop_source),
+                                              std::move(producer),
+                                              timer_queue,
+                                              timer_queue::clock_type::now() + 20ms,
+                                              executor);
+
+        assert_true(outcome.timed_out());
+        co_await outcome.release();
+    }(stop_source, std::move(producer), timer_queue, thread_pool_executor);
+
+    stoppable.get();
+    assert_true(stop_source.stop_requested());
+}
+
+void concurrencpp::tests::test_with_timeout_timer_queue_shutdown() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    std::stop_source stop_source;
+    result_promise<int> rp;
+    auto interrupted = await_with_timeout(stop_source, rp.get_result(), timer_queue, 1h, executor);
+
+    std::this_thread::sleep_for(50ms);
+    timer_queue->shutdown();
+
+    assert_throws_with_error_message<errors::broken_task>(
+        [&interrupted] {
+            interrupted.get();
+        },
+        concurrencpp::details::consts::k_broken_task_exception_error_msg);
+
+    assert_true(stop_source.stop_requested());
+
+    result_promise<int> late_rp;
+    auto after_shutdown = await_with_timeout(std::stop_source(std::nostopstate), late_rp.get_result(), timer_queue, 1h, executor);
+    assert_throws_with_error_message<errors::runtime_shutdown>(
+        [&after_shutdown] {
+            after_shutdown.get();
+        },
+        concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
+}
+
+void concurrencpp::tests::test_with_timeout_concurrent_producers() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto producers = std::make_shared<concurrencpp::thread_pool_executor>("producers", 4, 10s);
+    auto consumers = std::make_shared<concurrencpp::thread_pool_executor>("consumers", 4, 10s);
+    executor_shutdowner es0(producers), es1(consumers);
+
+    constexpr size_t task_count = 1'024;
+    std::vector<result<size_t>> consumer_results;
+    consumer_results.reserve(task_count);
+
+    // producers and timers that complete at about the same time, whichever wins, the outcome is consistent.
+    for (size_t i = 0; i < task_count; i++) {
+        auto producer = producers->submit([i] {
+            std::this_thread::sleep_for(std::chrono::microseconds(i % 200));
+            return i;
+        });
+
+        consumer_results.emplace_back([](result<size_t> producer,
+                                         std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                                         std::shared_ptr<concurrencpp::executor> executor,
+                                         size_t i) -> result<size_t> {
+            auto outcome = co_await with_timeout(std::move(producer), timer_queue, std::chrono::microseconds(i % 300), executor);
+            if (outcome.timed_out()) {
+                co_return co_await outcome.release();
+            }
+
+            co_return outcome.get();
+        }(std::move(producer), timer_queue, consumers, i));
+    }
+
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(consumer_results[i].get(), i);
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester test("with_timeout test");
+
+    test.add_step("null arguments", test_with_timeout_null_arguments);
+    test.add_step("ready result", test_with_timeout_ready_result);
+    test.add_step("result completes first", test_with_timeout_result_completes_first);
+    test.add_step("timeout expires first", test_with_timeout_timeout_expires_first);
+    test.add_step("with_deadline", test_with_deadline);
+    test.add_step("timer_queue shutdown", test_with_timeout_timer_queue_shutdown);
+    test.add_step("concurrent producers", test_with_timeout_concurrent_producers);
+
+    test.launch_test();
+    return 0;
+}
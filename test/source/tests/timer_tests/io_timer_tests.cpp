@@ -0,0 +1,390 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace concurrencpp::tests {
+    void test_io_timer_one_shot_timer();
+    void test_io_timer_periodic_timer();
+    void test_io_timer_cancel_on_io_thread();
+    void test_io_timer_cancel_from_other_thread();
+    void test_io_timer_destructor();
+    void test_io_timer_delay_object();
+    void test_io_timer_socket_timeout();
+    void test_io_timer_connection_idle_timeout();
+}  // namespace concurrencpp::tests
+
+using std::chrono::steady_clock;
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using concurrencpp::net::io_timer;
+using concurrencpp::net::io_timer_queue;
+
+namespace concurrencpp::tests {
+    // an io_context that is run by a single thread, like the io_contexts of io_context_pool.
+    class io_context_thread {
+
+       private:
+        asio::io_context m_io_context;
+        asio::executor_work_guard<asio::io_context::executor_type> m_work_guard;
+        std::thread m_thread;
+
+       public:
+        io_context_thread() : m_work_guard(asio::make_work_guard(m_io_context)) {
+            m_thread = std::thread([this] {
+                m_io_context.run();
+            });
+        }
+
+        ~io_context_thread() noexcept {
+            m_work_guard.reset();
+            m_io_context.stop();
+            m_thread.join();
+        }
+
+        asio::io_context& get() noexcept {
+            return m_io_context;
+        }
+
+        std::thread::id get_id() const noexcept {
+            return m_thread.get_id();
+        }
+
+        // runs callable on the io thread and waits for its result.
+        template<class callable_type>
+        auto run_on(callable_type callable) {
+            std::packaged_task<decltype(callable())()> task(std::move(callable));
+            auto future = task.get_future();
+            asio::post(m_io_context, [&task] {
+                task();
+            });
+
+            return future.get();
+        }
+
+        // waits until every handler that was posted before the call has run.
+        void sync() {
+            run_on([] {
+            });
+        }
+    };
+
+    template<class predicate_type>
+    bool wait_until(predicate_type predicate, std::chrono::milliseconds timeout) {
+        const auto deadline = steady_clock::now() + timeout;
+        while (steady_clock::now() < deadline) {
+            if (predicate()) {
+                return true;
+            }
+
+            std::this_thread::sleep_for(5ms);
+        }
+
+        return predicate();
+    }
+
+    lazy_result<std::thread::id> delay_and_get_thread_id(io_timer_queue& timers, io_timer_queue::duration due_time) {
+        co_await timers.make_delay_object(due_time);
+        co_return std::this_thread::get_id();
+    }
+
+    lazy_result<std::error_code> read_with_timeout(io_timer_queue& timers,
+                                                   std::shared_ptr<asio::ip::tcp::socket> socket,
+                                                   io_timer_queue::duration timeout) {
+        char buffer[64];
+        auto read_timeout = timers.make_socket_timeout(socket, timeout);
+        auto [error, bytes_transferred] = co_await concurrencpp::net::async_read_some(*socket, asio::buffer(buffer));
+        co_return error;
+    }
+
+    lazy_result<void> serve_connection(asio::ip::tcp::socket socket) {
+        connection session(std::move(socket), std::string("."));
+        co_await session.start();
+    }
+
+    // a connected pair of sockets, the server side belongs to io_context.
+    std::pair<asio::ip::tcp::socket, asio::ip::tcp::socket> make_connected_sockets(asio::io_context& io_context,
+                                                                                   asio::io_context& client_context) {
+        asio::ip::tcp::acceptor acceptor(io_context, asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+        asio::ip::tcp::socket client_socket(client_context);
+        client_socket.connect(acceptor.local_endpoint());
+
+        asio::ip::tcp::socket server_socket(io_context);
+        acceptor.accept(server_socket);
+        return {std::move(server_socket), std::move(client_socket)};
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_io_timer_one_shot_timer() {
+    io_context_thread io_thread;
+    io_timer_queue timers(io_thread.get());
+    const auto io_thread_id = io_thread.get_id();
+    const auto due_time = 100ms;
+
+    std::atomic_size_t invocation_count = 0;
+    std::atomic_bool fired_on_io_thread = false;
+
+    const auto before = steady_clock::now();
+    std::atomic<steady_clock::time_point> fired_at = before;
+
+    auto timer = timers.make_one_shot_timer(due_time, [&] {
+        fired_at = steady_clock::now();
+        fired_on_io_thread = (std::this_thread::get_id() == io_thread_id);
+        ++invocation_count;
+    });
+
+    assert_true(static_cast<bool>(timer));
+    assert_true(wait_until(
+        [&] {
+            return invocation_count.load() != 0;
+        },
+        5s));
+
+    std::this_thread::sleep_for(due_time * 3);
+    assert_equal(invocation_count.load(), size_t(1));
+    assert_true(fired_on_io_thread.load());
+    assert_bigger_equal(duration_cast<milliseconds>(fired_at.load() - before).count(), due_time.count());
+}
+
+void concurrencpp::tests::test_io_timer_periodic_timer() {
+    io_context_thread io_thread;
+    io_timer_queue timers(io_thread.get());
+    const auto io_thread_id = io_thread.get_id();
+    const auto due_time = 100ms, frequency = 50ms;
+    const size_t expected_ticks = 5;
+
+    std::atomic_size_t invocation_count = 0;
+    std::atomic_bool fired_on_io_thread = true;
+
+    const auto before = steady_clock::now();
+    auto timer = timers.make_timer(due_time, frequency, [&] {
+        if (std::this_thread::get_id() != io_thread_id) {
+            fired_on_io_thread = false;
+        }
+
+        ++invocation_count;
+    });
+
+    assert_true(wait_until(
+        [&] {
+            return invocation_count.load() >= expected_ticks;
+        },
+        10s));
+
+    // the first tick expires after due_time, every following tick one frequency after the previous one.
+    const auto elapsed = duration_cast<milliseconds>(steady_clock::now() - before);
+    assert_bigger_equal(elapsed.count(), (due_time + frequency * (expected_ticks - 1)).count());
+
+    timer.cancel();
+    assert_false(static_cast<bool>(timer));
+
+    io_thread.sync();
+    const auto count_after_cancel = invocation_count.load();
+
+    std::this_thread::sleep_for(frequency * 4);
+    assert_equal(invocation_count.load(), count_after_cancel);
+    assert_true(fired_on_io_thread.load());
+}
+
+void concurrencpp::tests::test_io_timer_cancel_on_io_thread() {
+    io_context_thread io_thread;
+    io_timer_queue timers(io_thread.get());
+    std::atomic_size_t invocation_count = 0;
+
+    // cancelling on the io thread is immediate, even if the timer has already expired.
+    io_thread.run_on([&] {
+        auto timer = timers.make_one_shot_timer(0ms, [&] {
+            ++invocation_count;
+        });
+
+        std::this_thread::sleep_for(20ms);
+        timer.cancel();
+    });
+
+    auto timer = timers.make_timer(100ms, 50ms, [&] {
+        ++invocation_count;
+    });
+
+    io_thread.run_on([&timer] {
+        timer.cancel();
+    });
+
+    std::this_thread::sleep_for(300ms);
+    assert_equal(invocation_count.load(), size_t(0));
+}
+
+void concurrencpp::tests::test_io_timer_cancel_from_other_thread() {
+    io_context_thread io_thread;
+    io_timer_queue timers(io_thread.get());
+    std::atomic_size_t invocation_count = 0;
+
+    auto timer = timers.make_one_shot_timer(100ms, [&invocation_count] {
+        ++invocation_count;
+    });
+
+    auto observed_token = std::make_shared<int>(0);
+    std::weak_ptr<int> weak_token = observed_token;
+    auto observed_timer = timers.make_timer(100ms, 50ms, [&invocation_count, observed_token] {
+        ++invocation_count;
+    });
+
+    observed_token.reset();
+    assert_false(weak_token.expired());
+
+    // the cancellation is posted to the io thread, which releases the callable once it has run.
+    timer.cancel();
+    observed_timer.cancel();
+    io_thread.sync();
+    io_thread.sync();
+
+    assert_true(weak_token.expired());
+
+    std::this_thread::sleep_for(300ms);
+    assert_equal(invocation_count.load(), size_t(0));
+}
+
+void concurrencpp::tests::test_io_timer_destructor() {
+    io_context_thread io_thread;
+    io_timer_queue timers(io_thread.get());
+    std::atomic_size_t invocation_count = 0;
+
+    {
+        auto timer = timers.make_timer(100ms, 50ms, [&] {
+            ++invocation_count;
+        });
+    }
+
+    io_thread.run_on([&] {
+        auto timer = timers.make_one_shot_timer(0ms, [&] {
+            ++invocation_count;
+        });
+    });
+
+    // moving a timer over another timer cancels the overwritten one.
+    auto timer = timers.make_one_shot_timer(100ms, [&] {
+        ++invocation_count;
+    });
+
+    timer = io_timer();
+    assert_false(static_cast<bool>(timer));
+
+    std::this_thread::sleep_for(300ms);
+    assert_equal(invocation_count.load(), size_t(0));
+}
+
+void concurrencpp::tests::test_io_timer_delay_object() {
+    io_context_thread io_thread;
+    io_timer_queue timers(io_thread.get());
+    const auto due_time = 100ms;
+
+    for (size_t i = 0; i < 5; i++) {
+        const auto before = steady_clock::now();
+        auto delay_result = io_thread.run_on([&] {
+            return delay_and_get_thread_id(timers, due_time).run();
+        });
+
+        const auto resuming_thread_id = delay_result.get();
+        const auto elapsed = duration_cast<milliseconds>(steady_clock::now() - before);
+
+        assert_equal(resuming_thread_id, io_thread.get_id());
+        assert_bigger_equal(elapsed.count(), due_time.count());
+        assert_smaller(elapsed.count(), (due_time + 2s).count());
+    }
+}
+
+void concurrencpp::tests::test_io_timer_socket_timeout() {
+    io_context_thread io_thread;
+    io_timer_queue timers(io_thread.get());
+    asio::io_context client_context;
+    const auto timeout = 100ms;
+
+    auto sockets = make_connected_sockets(io_thread.get(), client_context);
+    auto shared_socket = std::make_shared<asio::ip::tcp::socket>(std::move(sockets.first));
+
+    // the peer sends nothing, so the timeout aborts the pending read.
+    const auto before = steady_clock::now();
+    auto read_result = io_thread.run_on([&] {
+        return read_with_timeout(timers, shared_socket, timeout).run();
+    });
+
+    assert_equal(read_result.get(), std::error_code(asio::error::operation_aborted));
+    assert_bigger_equal(duration_cast<milliseconds>(steady_clock::now() - before).count(), timeout.count());
+
+    // a pending timeout keeps the socket alive until its cancellation reaches the io thread.
+    auto timeout_timer = timers.make_socket_timeout(shared_socket, 10s);
+    std::weak_ptr<asio::ip::tcp::socket> weak_socket = shared_socket;
+    shared_socket.reset();
+    assert_false(weak_socket.expired());
+
+    timeout_timer.cancel();
+    io_thread.sync();
+    io_thread.sync();
+
+    assert_true(weak_socket.expired());
+}
+
+void concurrencpp::tests::test_io_timer_connection_idle_timeout() {
+    io_context_thread io_thread;
+    asio::io_context client_context;
+    const auto idle_timeout = concurrencpp::net::constants::default_header_read_timeout;
+
+    auto sockets = make_connected_sockets(io_thread.get(), client_context);
+    auto& client_socket = sockets.second;
+    auto session_result = io_thread.run_on([&sockets] {
+        return serve_connection(std::move(sockets.first)).run();
+    });
+
+    const std::string request = "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    asio::write(client_socket, asio::buffer(request));
+
+    std::string response;
+    char buffer[1024];
+    std::error_code error;
+    auto size = client_socket.read_some(asio::buffer(buffer), error);
+    assert_false(static_cast<bool>(error));
+    response.append(buffer, size);
+
+    const auto response_received = steady_clock::now();
+
+    // the session is kept alive, and closed once no request header arrives within the idle timeout.
+    while (!error) {
+        size = client_socket.read_some(asio::buffer(buffer), error);
+        response.append(buffer, size);
+    }
+
+    const auto elapsed = duration_cast<milliseconds>(steady_clock::now() - response_received);
+
+    assert_equal(error, std::error_code(asio::error::eof));
+    assert_equal(response.rfind("HTTP/1.1 200 OK", 0), size_t(0));
+    assert_true(response.find("Connection: keep-alive") != std::string::npos);
+    assert_bigger_equal(elapsed.count(), (idle_timeout - 100ms).count());
+    assert_smaller(elapsed.count(), (idle_timeout + 2s).count());
+
+    session_result.get();
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester test("io_timer test");
+
+    test.add_step("one shot timer", test_io_timer_one_shot_timer);
+    test.add_step("periodic timer", test_io_timer_periodic_timer);
+    test.add_step("cancel on io thread", test_io_timer_cancel_on_io_thread);
+    test.add_step("cancel from other thread", test_io_timer_cancel_from_other_thread);
+    test.add_step("destructor", test_io_timer_destructor);
+    test.add_step("delay_object", test_io_timer_delay_object);
+    test.add_step("socket timeout", test_io_timer_socket_timeout);
+    test.add_step("connection idle timeout", test_io_timer_connection_idle_timeout);
+
+    test.launch_test();
+    return 0;
+}
@@ -0,0 +1,832 @@
+#include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/timers/timer_queue_internal.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/random.h"
+#include "utils/recording_executor.h"
+#include "utils/executor_shutdowner.h"
+
+#include <set>
+#include <chrono>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace concurrencpp::tests {
+    void test_timer_queue_backend_oneshot_timers(timer_queue_backend backend);
+    void test_timer_queue_backend_cancellation(timer_queue_backend backend);
+    void test_timer_queue_backend_random_timers(timer_queue_backend backend);
+    void test_timer_queue_backend_overdue_timers(timer_queue_backend backend);
+    void test_timer_queue_backend_periodic_timer(timer_queue_backend backend);
+    void test_timer_queue_backend_delay_object(timer_queue_backend backend);
+    void test_timer_queue_backend_batch_dispatch(timer_queue_backend backend);
+    void test_timer_queue_backend_coalescing(timer_queue_backend backend);
+    void test_timer_queue_backend_fixed_rate_timer(timer_queue_backend backend);
+    void test_timer_queue_backend_timer_under_load(timer_queue_backend backend);
+    void test_timer_queue_backend_cancelled_timers(timer_queue_backend backend);
+
+    void test_timer_queue_coalesce_deadline();
+
+    void test_timer_queue_backend_options();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    namespace {
+        using clock_type = concurrencpp::timer_queue::clock_type;
+        using time_point = concurrencpp::timer_queue::time_point;
+
+        struct counting_callable {
+            std::vector<size_t>* counts;
+            size_t id;
+
+            void operator()() const {
+                ++(*counts)[id];
+            }
+        };
+
+        using counting_timer = concurrencpp::details::timer_state<counting_callable>;
+
+        // every copy of a token_callable shares its token, so the timers that are alive can be counted.
+        struct token_callable {
+            std::shared_ptr<int> token;
+
+            void operator()() const noexcept {}
+        };
+
+        /*
+            Drives a timer container directly with made up "now" values and checks that a timer fires once its deadline
+            is in the past and not before. the timing wheel has a resolution of a millisecond, so a timer is allowed to
+            fire up to a millisecond after its deadline.
+        */
+        class container_driver {
+
+           private:
+            std::unique_ptr<concurrencpp::details::timer_queue_internal> m_container;
+            std::shared_ptr<concurrencpp::manual_executor> m_executor;
+            executor_shutdowner m_shutdowner;
+            std::vector<concurrencpp::timer_queue::timer_ptr> m_timers;
+            std::vector<bool> m_removed;
+            std::vector<size_t> m_counts;
+            time_point m_latest_now;
+
+           public:
+            container_driver(timer_queue_backend backend, size_t capacity) :
+                m_container(concurrencpp::details::timer_queue_internal::make(backend)),
+                m_executor(std::make_shared<concurrencpp::manual_executor>()), m_shutdowner(m_executor), m_latest_now(clock_type::now()) {
+                m_counts.reserve(capacity);  // callables point into m_counts
+            }
+
+            size_t add(size_t due_time_ms, size_t slack_ms = 0) {
+                const auto id = m_timers.size();
+                assert_true(id < m_counts.capacity());
+                m_counts.emplace_back(0);
+                m_removed.emplace_back(false);
+
+                auto timer = concurrencpp::details::make_timer_state<counting_timer>(
+                    std::chrono::milliseconds(due_time_ms),
+                    0ms,
+                    std::chrono::milliseconds(slack_ms),
+                    m_executor,
+                    std::weak_ptr<concurrencpp::timer_queue> {},
+                    true,
+                    counting_callable {&m_counts, id});
+
+                m_timers.emplace_back(timer);
+                m_container->add(std::move(timer));
+                return id;
+            }
+
+            void remove(size_t id) {
+                m_removed[id] = true;
+                m_timers[id]->cancel();
+                m_container->remove_cancelled();  // like the timer_queue does for a cancelled timer
+            }
+
+            size_t fired(size_t id) const {
+                return m_counts[id];
+            }
+
+            time_point deadline(size_t id) const {
+                return m_timers[id]->get_deadline();
+            }
+
+            bool removed(size_t id) const {
+                return m_removed[id];
+            }
+
+            size_t timer_count() const noexcept {
+                return m_timers.size();
+            }
+
+            bool empty() const noexcept {
+                return m_container->empty();
+            }
+
+            size_t container_size() const noexcept {
+                return m_container->size();
+            }
+
+            time_point process(time_point now) {
+                m_latest_now = std::max(m_latest_now, now);
+
+                const auto next_deadline = m_container->process_expired(now);
+                m_executor->loop(m_executor->size());
+
+                auto closest_pending = time_point::max();
+
+                for (size_t i = 0; i < m_timers.size(); i++) {
+                    const auto deadline = m_timers[i]->get_deadline();
+
+                    if (m_removed[i]) {
+                        assert_equal(m_counts[i], 0);
+                        continue;
+                    }
+
+                    if (deadline > m_latest_now) {
+                        assert_equal(m_counts[i], 0);
+                    } else if (deadline + 1ms <= m_latest_now) {
+                        assert_equal(m_counts[i], 1);
+                    } else {
+                        assert_smaller_equal(m_counts[i], 1);
+                    }
+
+                    if (m_counts[i] == 0) {
+                        closest_pending = std::min(closest_pending, deadline);
+                    }
+                }
+
+                if (m_container->empty()) {
+                    assert_equal(closest_pending, time_point::max());
+                    assert_bigger_equal(next_deadline, now + 1h);
+                } else {
+                    assert_bigger(next_deadline, now);
+                    assert_smaller_equal(next_deadline, closest_pending + 1ms);
+                }
+
+                return next_deadline;
+            }
+        };
+    }  // namespace
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_timer_queue_backend_oneshot_timers(timer_queue_backend backend) {
+    // due times that land on every level of the wheel, on the edges between levels and beyond the range of the wheel.
+    const size_t due_times[] = {0,     1,     2,     7,          255,            256,        257,          511,
+                                512,   4'000, 65'535, 65'536,    65'537,         100'000,    (1 << 24) - 1, 1 << 24,
+                                (1 << 24) + 3,  (size_t(1) << 32) - 1,   size_t(1) << 32, (size_t(1) << 32) + 5, size_t(1) << 40};
+
+    container_driver driver(backend, std::size(due_times));
+    const auto before = clock_type::now();
+
+    for (const auto due_time : due_times) {
+        driver.add(due_time);
+    }
+
+    assert_equal(driver.container_size(), std::size(due_times));
+
+    const auto after = clock_type::now();
+
+    std::vector<time_point> checkpoints;
+    for (const auto due_time : due_times) {
+        const auto due = std::chrono::milliseconds(due_time);
+        checkpoints.emplace_back(before + due - 1ms);
+        checkpoints.emplace_back(before + due);
+        checkpoints.emplace_back(after + due + 1ms);
+        checkpoints.emplace_back(after + due + 2ms);
+    }
+
+    std::sort(checkpoints.begin(), checkpoints.end());
+
+    for (const auto checkpoint : checkpoints) {
+        driver.process(checkpoint);
+    }
+
+    assert_equal(driver.container_size(), 0);
+    for (size_t i = 0; i < std::size(due_times); i++) {
+        assert_equal(driver.fired(i), 1);
+    }
+}
+
+void concurrencpp::tests::test_timer_queue_backend_cancellation(timer_queue_backend backend) {
+    constexpr size_t timer_count = 4'096;
+    random randomizer;
+
+    container_driver driver(backend, timer_count);
+    const auto before = clock_type::now();
+
+    for (size_t i = 0; i < timer_count; i++) {
+        driver.add(static_cast<size_t>(randomizer(0, 100'000)));
+    }
+
+    // removes timers from the middle of their buckets, in a random order.
+    std::vector<size_t> to_remove;
+    for (size_t i = 0; i < timer_count; i += 3) {
+        to_remove.emplace_back(i);
+    }
+
+    for (size_t i = 0; i < to_remove.size(); i++) {
+        std::swap(to_remove[i], to_remove[static_cast<size_t>(randomizer(0, static_cast<int64_t>(to_remove.size() - 1)))]);
+    }
+
+    for (const auto id : to_remove) {
+        driver.remove(id);
+    }
+
+    assert_equal(driver.container_size(), timer_count - to_remove.size());
+
+    for (auto now = before; now < before + 101'000ms; now += 997ms) {
+        driver.process(now);
+    }
+
+    driver.process(before + 101'000ms);
+    assert_equal(driver.container_size(), 0);
+
+    for (size_t i = 0; i < timer_count; i++) {
+        assert_equal(driver.fired(i), (i % 3 == 0) ? 0 : 1);
+    }
+}
+
+void concurrencpp::tests::test_timer_queue_backend_random_timers(timer_queue_backend backend) {
+    constexpr size_t timer_count = 2'048;
+    random randomizer;
+
+    container_driver driver(backend, timer_count);
+    auto now = clock_type::now();
+
+    // timers are added, cancelled and expire while time goes forward in uneven steps.
+    for (size_t round = 0; round < 5'000; round++) {
+        const auto to_add = randomizer(0, 16);
+        for (int64_t i = 0; i < to_add && driver.timer_count() < timer_count; i++) {
+            const int64_t max_due_times[] = {10, 1'000, 70'000, 150'000};
+            const auto max_due_time = max_due_times[randomizer(0, 3)];
+
+            // deadlines are relative to the real clock, while the container is driven ahead of it.
+            const auto ahead = std::chrono::duration_cast<std::chrono::milliseconds>(now - clock_type::now()).count();
+            driver.add(static_cast<size_t>(std::max<int64_t>(ahead, 0) + randomizer(0, max_due_time)));
+        }
+
+        const auto to_remove = randomizer(0, 4);
+        for (int64_t i = 0; i < to_remove && driver.timer_count() != 0; i++) {
+            const auto id = static_cast<size_t>(randomizer(0, static_cast<int64_t>(driver.timer_count() - 1)));
+            if (!driver.removed(id) && driver.fired(id) == 0) {
+                driver.remove(id);
+            }
+        }
+
+        now += std::chrono::milliseconds(randomizer(0, 3) == 0 ? randomizer(0, 3'000) : randomizer(0, 5));
+        driver.process(now);
+    }
+
+    driver.process(now + 200'000ms);
+    assert_equal(driver.container_size(), 0);
+}
+
+void concurrencpp::tests::test_timer_queue_backend_overdue_timers(timer_queue_backend backend) {
+    container_driver driver(backend, 3);
+    auto now = clock_type::now();
+
+    driver.process(now + 10'000ms);
+
+    // the timers below are due "in the past" of the container, they are fired by the next call.
+    const auto first = driver.add(0);
+    const auto second = driver.add(1);
+    const auto third = driver.add(5'000);
+
+    driver.process(now + 10'000ms);
+    assert_equal(driver.fired(first), 1);
+    assert_equal(driver.fired(second), 1);
+    assert_equal(driver.fired(third), 1);
+    assert_equal(driver.container_size(), 0);
+}
+
+void concurrencpp::tests::test_timer_queue_backend_periodic_timer(timer_queue_backend backend) {
+    constexpr auto due_time = 40ms;
+    constexpr auto frequency = 25ms;
+
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s, nullptr, nullptr, backend);
+    assert_equal(timer_queue->backend(), backend);
+
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es(inline_executor);
+
+    std::mutex lock;
+    std::vector<time_point> invocations;
+    std::atomic_size_t oneshot_invocations = 0;
+
+    const auto start = clock_type::now();
+    auto timer = timer_queue->make_timer(due_time, frequency, inline_executor, [&] {
+        std::unique_lock<std::mutex> guard(lock);
+        invocations.emplace_back(clock_type::now());
+    });
+
+    auto oneshot_timer = timer_queue->make_one_shot_timer(10ms, inline_executor, [&] {
+        ++oneshot_invocations;
+    });
+
+    auto cancelled_timer = timer_queue->make_one_shot_timer(100ms, inline_executor, [] {
+        assert_true(false);
+    });
+
+    cancelled_timer.cancel();
+
+    std::this_thread::sleep_for(400ms);
+    timer.cancel();
+    timer_queue->shutdown();
+
+    assert_equal(oneshot_invocations.load(), 1);
+
+    std::unique_lock<std::mutex> guard(lock);
+    assert_bigger_equal(invocations.size(), 3);
+
+    assert_bigger_equal(invocations[0] - start, due_time);
+    for (size_t i = 1; i < invocations.size(); i++) {
+        assert_bigger_equal(invocations[i] - invocations[i - 1], frequency - 1ms);
+    }
+}
+
+void concurrencpp::tests::test_timer_queue_backend_delay_object(timer_queue_backend backend) {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s, nullptr, nullptr, backend);
+    auto thread_executor = std::make_shared<concurrencpp::thread_executor>();
+    executor_shutdowner es(thread_executor);
+
+    const auto start = clock_type::now();
+    timer_queue->make_delay_object(50ms, thread_executor).run().get();
+    assert_bigger_equal(clock_type::now() - start, 50ms);
+
+    timer_queue->shutdown();
+}
+
+void concurrencpp::tests::test_timer_queue_backend_batch_dispatch(timer_queue_backend backend) {
+    constexpr size_t timer_count = 300;
+
+    auto container = concurrencpp::details::timer_queue_internal::make(backend);
+    auto executors = std::array {std::make_shared<recording_executor>(), std::make_shared<recording_executor>()};
+    executor_shutdowner es0(executors[0]), es1(executors[1]);
+
+    std::vector<size_t> counts(timer_count + 1);
+    std::vector<concurrencpp::timer_queue::timer_ptr> timers;
+
+    for (size_t i = 0; i < timer_count; i++) {
+        timers.emplace_back(concurrencpp::details::make_timer_state<counting_timer>(10ms,
+                                                                                    0ms,
+                                                                                    0ms,
+                                                                                    executors[i % 2],
+                                                                                    std::weak_ptr<concurrencpp::timer_queue> {},
+                                                                                    true,
+                                                                                    counting_callable {&counts, i}));
+        container->add(timers.back());
+    }
+
+    // cancelled timers don't take part in the batch.
+    for (size_t i = 0; i < timer_count; i += 10) {
+        timers[i]->cancel();
+    }
+
+    container->process_expired(clock_type::now() + 1s);
+
+    // every executor receives the timers that expired together in one enqueue call. the cancelled ones are all even.
+    assert_equal(executors[0]->size(), timer_count / 2 - timer_count / 10);
+    assert_equal(executors[1]->size(), timer_count / 2);
+
+    for (const auto& executor : executors) {
+        assert_equal(executor->enqueue_calls(), 1);
+        executor->run_all();
+    }
+
+    for (size_t i = 0; i < timer_count; i++) {
+        assert_equal(counts[i], (i % 10 == 0) ? 0 : 1);
+    }
+
+    // an executor that was shut down drops its batch, the other executors are not affected.
+    timers.clear();
+    for (size_t i = 0; i < 4; i++) {
+        timers.emplace_back(concurrencpp::details::make_timer_state<counting_timer>(0ms,
+                                                                                    0ms,
+                                                                                    0ms,
+                                                                                    executors[i % 2],
+                                                                                    std::weak_ptr<concurrencpp::timer_queue> {},
+                                                                                    true,
+                                                                                    counting_callable {&counts, timer_count}));
+        container->add(timers.back());
+    }
+
+    executors[0]->shutdown();
+    container->process_expired(clock_type::now() + 2s);
+    assert_true(container->empty());
+    assert_equal(executors[1]->run_all(), 2);
+    assert_equal(counts[timer_count], 2);
+}
+
+void concurrencpp::tests::test_timer_queue_backend_coalescing(timer_queue_backend backend) {
+    constexpr size_t timer_count = 1'000;
+    constexpr size_t slack = 65;
+    random randomizer;
+
+    // timers that are due within 100ms of each other.
+    for (const auto timer_slack : {size_t(0), slack}) {
+        container_driver driver(backend, timer_count);
+        std::vector<size_t> due_times;
+
+        const auto before = clock_type::now();
+        for (size_t i = 0; i < timer_count; i++) {
+            due_times.emplace_back(static_cast<size_t>(randomizer(100, 199)));
+            driver.add(due_times.back(), timer_slack);
+        }
+        const auto after = clock_type::now();
+
+        std::set<time_point> distinct_deadlines;
+        for (size_t i = 0; i < timer_count; i++) {
+            const auto due_time = std::chrono::milliseconds(due_times[i]);
+            assert_bigger_equal(driver.deadline(i), before + due_time);
+            assert_smaller_equal(driver.deadline(i), after + due_time + std::chrono::milliseconds(timer_slack));
+            distinct_deadlines.emplace(driver.deadline(i));
+        }
+
+        if (timer_slack == 0) {
+            assert_bigger(distinct_deadlines.size(), 50);
+        } else {
+            // a window of more than 64ms contains a whole multiple of 64ms, so the timers are coalesced into three points at most.
+            assert_smaller_equal(distinct_deadlines.size(), 3);
+        }
+
+        for (auto now = before; !driver.empty(); now += 1ms) {
+            driver.process(now);
+        }
+    }
+}
+
+void concurrencpp::tests::test_timer_queue_backend_fixed_rate_timer(timer_queue_backend backend) {
+    constexpr auto frequency = 10ms;
+
+    for (const auto policy : {missed_tick_policy::skip, missed_tick_policy::catch_up, missed_tick_policy::burst}) {
+        auto container = concurrencpp::details::timer_queue_internal::make(backend);
+        auto executor = std::make_shared<recording_executor>();
+        executor_shutdowner es(executor);
+
+        std::vector<size_t> counts(1);
+        auto timer = concurrencpp::details::make_timer_state<counting_timer>(10ms,
+                                                                             frequency,
+                                                                             0ms,
+                                                                             executor,
+                                                                             std::weak_ptr<concurrencpp::timer_queue> {},
+                                                                             false,
+                                                                             counting_callable {&counts, 0});
+
+        timer->set_policy({timer_schedule::fixed_rate, policy});
+        const auto first_deadline = timer->get_deadline();
+        container->add(timer);
+
+        // on time, up to a millisecond late on the timing wheel.
+        container->process_expired(first_deadline + 1ms);
+        assert_equal(executor->size(), 1);
+        assert_equal(timer->get_deadline(), first_deadline + frequency);
+        assert_equal(timer->get_missed_ticks(), 0);
+
+        // 35ms after the second deadline, the third, fourth and fifth deadlines passed as well.
+        container->process_expired(first_deadline + frequency + 35ms);
+        assert_equal(timer->get_missed_ticks(), 3);
+
+        // the schedule stays anchored to the first deadline, whatever the policy.
+        assert_equal(timer->get_deadline(), first_deadline + 5 * frequency);
+
+        switch (policy) {
+            case missed_tick_policy::skip: {
+                assert_equal(executor->size(), 2);
+                assert_equal(executor->run_all(), 2);
+                assert_equal(counts[0], 2);
+                break;
+            }
+
+            case missed_tick_policy::catch_up: {
+                assert_equal(executor->size(), 2);
+                assert_equal(executor->run_all(), 2);
+                assert_equal(counts[0], 5);
+                break;
+            }
+
+            case missed_tick_policy::burst: {
+                assert_equal(executor->size(), 5);
+                assert_equal(executor->run_all(), 5);
+                assert_equal(counts[0], 5);
+                break;
+            }
+        }
+
+        // a new frequency applies from the last deadline of the schedule.
+        timer->set_new_frequency(20ms);
+        container->process_expired(first_deadline + 5 * frequency + 1ms);
+        assert_equal(timer->get_deadline(), first_deadline + 5 * frequency + 20ms);
+        assert_equal(timer->get_missed_ticks(), 3);
+
+        // a timer that is late by less than a frequency didn't miss a tick.
+        container->process_expired(first_deadline + 5 * frequency + 20ms + 19ms);
+        assert_equal(timer->get_deadline(), first_deadline + 5 * frequency + 40ms);
+        assert_equal(timer->get_missed_ticks(), 3);
+
+        timer->cancel();
+        container->remove_cancelled();
+        assert_true(container->empty());
+    }
+}
+
+void concurrencpp::tests::test_timer_queue_backend_timer_under_load(timer_queue_backend backend) {
+    static constexpr auto due_time = 50ms;
+    static constexpr auto frequency = 50ms;
+    static constexpr auto stall = 130ms;
+    static constexpr auto run_time = 650ms;
+
+    struct tick_log {
+        std::mutex lock;
+        std::vector<time_point> ticks;
+    };
+
+    const auto run = [backend](timer_policy policy) {
+        auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s, nullptr, nullptr, backend);
+        auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+        executor_shutdowner es(inline_executor);
+
+        tick_log log;
+        const auto start = clock_type::now();
+
+        // the callable runs on the timer_queue thread, the second tick blocks it, like a timer_queue thread under load.
+        auto timer = timer_queue->make_timer(due_time, frequency, policy, inline_executor, [&log] {
+            std::unique_lock<std::mutex> guard(log.lock);
+            log.ticks.emplace_back(clock_type::now());
+            if (log.ticks.size() == 2) {
+                std::this_thread::sleep_for(stall);
+            }
+        });
+
+        std::this_thread::sleep_for(run_time);
+        const auto missed_ticks = timer.get_missed_ticks();
+        timer.cancel();
+        timer_queue->shutdown();
+
+        std::unique_lock<std::mutex> guard(log.lock);
+        return std::make_tuple(start, std::move(log.ticks), missed_ticks);
+    };
+
+    // the deadlines that passed while the timer ran: 50ms, 100ms, ... 600ms, one may or may not have fired at 650ms.
+    constexpr size_t scheduled_ticks = run_time / frequency - 1;
+
+    // fixed rate, skip: the ticks that passed during the stall are dropped, the other ones fire on schedule.
+    {
+        auto [start, ticks, missed_ticks] = run({timer_schedule::fixed_rate, missed_tick_policy::skip});
+        assert_bigger_equal(missed_ticks, 1);
+        assert_bigger_equal(ticks.size() + missed_ticks, scheduled_ticks);
+        assert_smaller_equal(ticks.size() + missed_ticks, scheduled_ticks + 1);
+
+        // the ticks after the stall are anchored to the original start, they don't drift by the stall.
+        const auto last_offset = ticks.back() - start - due_time;
+        assert_smaller_equal(last_offset % frequency, 20ms);
+    }
+
+    // fixed rate, catch up and burst: every scheduled tick runs.
+    for (const auto policy : {missed_tick_policy::catch_up, missed_tick_policy::burst}) {
+        auto [start, ticks, missed_ticks] = run({timer_schedule::fixed_rate, policy});
+        assert_bigger_equal(missed_ticks, 1);
+        assert_bigger_equal(ticks.size(), scheduled_ticks);
+        assert_smaller_equal(ticks.size(), scheduled_ticks + 1);
+    }
+
+    // fixed delay: the schedule restarts after the stall, and the ticks a fixed rate timer would have had are counted.
+    {
+        auto [start, ticks, missed_ticks] = run({});
+        assert_bigger_equal(missed_ticks, 1);
+        assert_smaller_equal(ticks.size(), scheduled_ticks - 1);
+    }
+}
+
+void concurrencpp::tests::test_timer_queue_backend_cancelled_timers(timer_queue_backend backend) {
+    using token_timer = concurrencpp::details::timer_state<token_callable>;
+    using concurrencpp::details::timer_queue_internal;
+
+    auto container = timer_queue_internal::make(backend);
+    auto executor = std::make_shared<recording_executor>();
+    executor_shutdowner es(executor);
+    auto token = std::make_shared<int>(0);
+
+    const auto make_timer = [&] {
+        return concurrencpp::details::make_timer_state<token_timer>(1h,
+                                                                    0ms,
+                                                                    0ms,
+                                                                    executor,
+                                                                    std::weak_ptr<concurrencpp::timer_queue> {},
+                                                                    true,
+                                                                    token_callable {token});
+    };
+
+    // timers that are cancelled before they reach the container are dropped right away.
+    timer_queue_internal::request_queue requests;
+    for (size_t i = 0; i < 8; i++) {
+        requests.emplace_back(make_timer());
+    }
+
+    for (size_t i = 0; i < 4; i++) {
+        requests[i]->cancel();
+    }
+
+    container->process_requests(requests);
+    requests.clear();
+    assert_equal(container->size(), 4);
+    assert_equal(token.use_count(), 5);
+
+    // timers that are cancelled inside the container stay there until they are swept.
+    for (size_t i = 0; i < 4; i++) {
+        requests.emplace_back(make_timer());
+    }
+
+    auto live_timers = requests;
+    container->process_requests(requests);
+    requests.clear();
+    assert_equal(container->size(), 8);
+
+    live_timers[0]->cancel();
+    live_timers[1]->cancel();
+    live_timers.erase(live_timers.begin(), live_timers.begin() + 2);
+    assert_equal(container->size(), 8);
+
+    container->remove_cancelled();
+    assert_equal(container->size(), 6);
+    assert_equal(token.use_count(), 7);
+
+    // timeouts that are cancelled right after they are added, like results that complete in time.
+    // the container sweeps them as it goes, so it doesn't grow with the timers that were ever added.
+    constexpr size_t batch_size = 100;
+    for (size_t round = 0; round < 100; round++) {
+        for (size_t i = 0; i < batch_size; i++) {
+            requests.emplace_back(make_timer());
+        }
+
+        auto batch = requests;
+        container->process_requests(requests);
+        requests.clear();
+
+        for (auto& timer : batch) {
+            timer->cancel();
+        }
+
+        batch.clear();
+        assert_smaller_equal(container->size(), 6 + timer_queue_internal::k_min_sweep_interval + batch_size);
+        assert_equal(static_cast<size_t>(token.use_count()), container->size() + 1);
+    }
+
+    // a swept timer that is still referenced elsewhere lives on, only the container drops it.
+    live_timers[0]->cancel();
+    container->remove_cancelled();
+    assert_equal(container->size(), 5);
+    assert_equal(token.use_count(), 7);
+
+    live_timers.clear();
+    assert_equal(token.use_count(), 6);
+
+    container->process_expired(clock_type::now() + 2h);
+    assert_true(container->empty());
+    assert_equal(executor->size(), 5);
+}
+
+void concurrencpp::tests::test_timer_queue_coalesce_deadline() {
+    using concurrencpp::details::timer_state_base;
+
+    random randomizer;
+    const auto base = clock_type::now();
+
+    for (size_t i = 0; i < 10'000; i++) {
+        const auto deadline = base + std::chrono::microseconds(randomizer(0, 1'000'000'000));
+        const auto slack = std::chrono::milliseconds(randomizer(0, 5'000));
+        const auto coalesced = timer_state_base::coalesce_deadline(deadline, slack);
+
+        assert_bigger_equal(coalesced, deadline);
+        assert_smaller_equal(coalesced, deadline + slack);
+
+        if (slack == 0ms) {
+            assert_equal(coalesced, deadline);
+        }
+    }
+
+    // windows shorter than a millisecond are aligned to nanoseconds.
+    for (size_t i = 0; i < 10'000; i++) {
+        const auto deadline = base + std::chrono::nanoseconds(randomizer(0, 1'000'000));
+        const auto slack = std::chrono::microseconds(randomizer(1, 999));
+        const auto coalesced = timer_state_base::coalesce_deadline(deadline, slack);
+
+        assert_bigger_equal(coalesced, deadline);
+        assert_smaller_equal(coalesced, deadline + slack);
+    }
+
+    // a window inside the first one that contains its coalesced deadline gets the same deadline. both windows lie
+    // inside the same millisecond, so neither of them is aligned to a millisecond.
+    const time_point us_base = std::chrono::floor<std::chrono::milliseconds>(base);
+    const auto first_us = timer_state_base::coalesce_deadline(us_base + 100us, 300us);
+    const auto second_start = std::max(first_us - 10us, us_base + 100us);
+    const auto second_end = std::min(first_us + 10us, us_base + 400us);
+    const auto second_us = timer_state_base::coalesce_deadline(second_start, second_end - second_start);
+    assert_equal(first_us, second_us);
+
+    // overlapping windows share the coarsest point in them.
+    const auto aligned = time_point(std::chrono::duration_cast<time_point::duration>(
+        std::chrono::ceil<std::chrono::milliseconds>(base.time_since_epoch()) / 1024 * 1024 + 1024ms));
+    const auto first = timer_state_base::coalesce_deadline(aligned - 300ms, 500ms);
+    const auto second = timer_state_base::coalesce_deadline(aligned - 10ms, 40ms);
+    assert_equal(first, second);
+    assert_equal(first.time_since_epoch() % 1024ms, 0ms);
+}
+
+void concurrencpp::tests::test_timer_queue_backend_options() {
+    {
+        auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+        assert_equal(timer_queue->backend(), timer_queue_backend::ordered_set);
+    }
+
+    concurrencpp::runtime_options options;
+    assert_equal(options.timer_backend, timer_queue_backend::ordered_set);
+
+    options.timer_backend = timer_queue_backend::timing_wheel;
+    concurrencpp::runtime runtime(options);
+    assert_equal(runtime.timer_queue()->backend(), timer_queue_backend::timing_wheel);
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester test("timer_queue backend test");
+
+    test.add_step("ordered_set oneshot timers", [] {
+        test_timer_queue_backend_oneshot_timers(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set cancellation", [] {
+        test_timer_queue_backend_cancellation(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set random timers", [] {
+        test_timer_queue_backend_random_timers(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set overdue timers", [] {
+        test_timer_queue_backend_overdue_timers(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set periodic timer", [] {
+        test_timer_queue_backend_periodic_timer(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set delay object", [] {
+        test_timer_queue_backend_delay_object(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set batch dispatch", [] {
+        test_timer_queue_backend_batch_dispatch(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set coalescing", [] {
+        test_timer_queue_backend_coalescing(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set fixed rate timer", [] {
+        test_timer_queue_backend_fixed_rate_timer(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set timer under load", [] {
+        test_timer_queue_backend_timer_under_load(concurrencpp::timer_queue_backend::ordered_set);
+    });
+    test.add_step("ordered_set cancelled timers", [] {
+        test_timer_queue_backend_cancelled_timers(concurrencpp::timer_queue_backend::ordered_set);
+    });
+
+    test.add_step("timing_wheel oneshot timers", [] {
+        test_timer_queue_backend_oneshot_timers(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel cancellation", [] {
+        test_timer_queue_backend_cancellation(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel random timers", [] {
+        test_timer_queue_backend_random_timers(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel overdue timers", [] {
+        test_timer_queue_backend_overdue_timers(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel periodic timer", [] {
+        test_timer_queue_backend_periodic_timer(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel delay object", [] {
+        test_timer_queue_backend_delay_object(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel batch dispatch", [] {
+        test_timer_queue_backend_batch_dispatch(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel coalescing", [] {
+        test_timer_queue_backend_coalescing(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel fixed rate timer", [] {
+        test_timer_queue_backend_fixed_rate_timer(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel timer under load", [] {
+        test_timer_queue_backend_timer_under_load(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+    test.add_step("timing_wheel cancelled timers", [] {
+        test_timer_queue_backend_cancelled_timers(concurrencpp::timer_queue_backend::timing_wheel);
+    });
+
+    test.add_step("coalesce_deadline", test_timer_queue_coalesce_deadline);
+    test.add_step("runtime_options", test_timer_queue_backend_options);
+
+    test.launch_test();
+    return 0;
+}
@@ -6,6 +6,8 @@
 #include "utils/executor_shutdowner.h"
 
 #include <chrono>
+#include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -16,6 +18,11 @@ namespace concurrencpp::tests {
     void test_timer_queue_max_worker_idle_time();
     void test_timer_queue_thread_injection();
     void test_timer_queue_thread_callbacks();
+    void test_timer_queue_slack();
+    void test_timer_queue_coalescing_window();
+    void test_timer_queue_worker_local_timers();
+    void test_timer_queue_sub_millisecond();
+    void test_timer_queue_sleep();
 }  // namespace concurrencpp::tests
 
 void concurrencpp::tests::test_timer_queue_make_timer() {
@@ -142,6 +149,412 @@ void concurrencpp::tests::test_timer_queue_thread_callbacks() {
     assert_equal(thread_terminated_callback_invocations_num, 1);
 }
 
+void concurrencpp::tests::test_timer_queue_slack() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es(inline_executor);
+
+    assert_equal(timer_queue->coalescing_window(), 0ms);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            timer_queue->make_timer(100ms, 100ms, 10ms, {}, [] {
+            });
+        },
+        concurrencpp::details::consts::k_timer_queue_make_timer_executor_null_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            timer_queue->make_one_shot_timer(100ms, 10ms, {}, [] {
+            });
+        },
+        concurrencpp::details::consts::k_timer_queue_make_oneshot_timer_executor_null_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            timer_queue->make_delay_object(100ms, 10ms, {});
+        },
+        concurrencpp::details::consts::k_timer_queue_make_delay_object_executor_null_err_msg);
+
+    auto timer = timer_queue->make_timer(100s, 100s, inline_executor, [] {
+    });
+    assert_equal(timer.get_slack(), 0ms);
+
+    auto slack_timer = timer_queue->make_timer(100s, 100s, 25ms, inline_executor, [] {
+    });
+    assert_equal(slack_timer.get_slack(), 25ms);
+
+    std::atomic_bool invoked = false;
+    const auto before = std::chrono::high_resolution_clock::now();
+    auto oneshot_timer = timer_queue->make_one_shot_timer(50ms, 30ms, inline_executor, [&invoked] {
+        invoked = true;
+    });
+    assert_equal(oneshot_timer.get_slack(), 30ms);
+
+    timer_queue->make_delay_object(60ms, 30ms, inline_executor).run().get();
+    assert_bigger_equal(std::chrono::high_resolution_clock::now() - before, 60ms);
+
+    std::this_thread::sleep_for(50ms);
+    assert_true(invoked.load());
+}
+
+void concurrencpp::tests::test_timer_queue_coalescing_window() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s, nullptr, nullptr, timer_queue_backend::ordered_set, 40ms);
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es(inline_executor);
+
+    assert_equal(timer_queue->coalescing_window(), 40ms);
+
+    // the window is the minimal slack of every timer of the queue.
+    auto timer = timer_queue->make_timer(100s, 100s, inline_executor, [] {
+    });
+    assert_equal(timer.get_slack(), 40ms);
+
+    auto small_slack_timer = timer_queue->make_one_shot_timer(100s, 10ms, inline_executor, [] {
+    });
+    assert_equal(small_slack_timer.get_slack(), 40ms);
+
+    auto big_slack_timer = timer_queue->make_one_shot_timer(100s, 100ms, inline_executor, [] {
+    });
+    assert_equal(big_slack_timer.get_slack(), 100ms);
+
+    concurrencpp::runtime_options options;
+    assert_equal(options.timer_coalescing_window, 0ms);
+
+    options.timer_coalescing_window = 15ms;
+    concurrencpp::runtime runtime(options);
+    assert_equal(runtime.timer_queue()->coalescing_window(), 15ms);
+}
+
+void concurrencpp::tests::test_timer_queue_worker_local_timers() {
+    assert_false(std::make_shared<concurrencpp::timer_queue>(120s)->worker_local_timers());
+
+    constexpr size_t task_count = 8;
+    constexpr size_t timers_per_task = 64;
+
+    std::atomic_size_t thread_started_callback_invocations_num = 0;
+    auto thread_started_callback = [&thread_started_callback_invocations_num](std::string_view) {
+        ++thread_started_callback_invocations_num;
+    };
+
+    for (const auto backend : {timer_queue_backend::ordered_set, timer_queue_backend::timing_wheel}) {
+        thread_started_callback_invocations_num = 0;
+
+        auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s, thread_started_callback, nullptr, backend, 0ms, true);
+        assert_true(timer_queue->worker_local_timers());
+
+        auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+        auto thread_pool_executor = std::make_shared<concurrencpp::thread_pool_executor>("threadpool", 4, 10s);
+        executor_shutdowner es0(inline_executor), es1(thread_pool_executor);
+
+        struct worker_timers {
+            std::vector<concurrencpp::timer> timers, cancelled_timers;
+            std::vector<concurrencpp::result<void>> delays;
+        };
+
+        std::atomic_size_t fired_timers = 0, fired_on_creating_thread = 0, fired_cancelled_timers = 0, resumed_delays = 0;
+        std::vector<concurrencpp::result<worker_timers>> results;
+
+        for (size_t i = 0; i < task_count; i++) {
+            results.emplace_back(thread_pool_executor->submit([&] {
+                const auto creating_thread = std::this_thread::get_id();
+                worker_timers task_timers;
+
+                for (size_t j = 0; j < timers_per_task; j++) {
+                    task_timers.timers.emplace_back(timer_queue->make_one_shot_timer(50ms, inline_executor, [&, creating_thread] {
+                        ++fired_timers;
+
+                        if (std::this_thread::get_id() == creating_thread) {
+                            ++fired_on_creating_thread;
+                        }
+                    }));
+
+                    task_timers.cancelled_timers.emplace_back(timer_queue->make_one_shot_timer(150ms, inline_executor, [&] {
+                        ++fired_cancelled_timers;
+                    }));
+
+                    task_timers.delays.emplace_back([](std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                                                   std::shared_ptr<concurrencpp::executor> executor,
+                                                   std::thread::id creating_thread,
+                                                   std::atomic_size_t& resumed_delays) -> concurrencpp::result<void> {
+                        co_await timer_queue->make_delay_object(50ms, executor);
+                        assert_equal(std::this_thread::get_id(), creating_thread);
+                        ++resumed_delays;
+                    }(timer_queue, inline_executor, creating_thread, resumed_delays));
+                }
+
+                return task_timers;
+            }));
+        }
+
+        std::vector<worker_timers> created;
+        for (auto& result : results) {
+            created.emplace_back(result.get());
+        }
+
+        // timers are cancelled by a different thread than the worker that holds them.
+        for (auto& task_timers : created) {
+            for (auto& timer : task_timers.cancelled_timers) {
+                timer.cancel();
+            }
+        }
+
+        for (auto& task_timers : created) {
+            for (auto& delay : task_timers.delays) {
+                delay.get();
+            }
+        }
+
+        std::this_thread::sleep_for(300ms);
+
+        assert_equal(fired_timers.load(), task_count * timers_per_task);
+        assert_equal(fired_on_creating_thread.load(), task_count * timers_per_task);
+        assert_equal(resumed_delays.load(), task_count * timers_per_task);
+        assert_equal(fired_cancelled_timers.load(), 0);
+
+        // the timers expired on the workers, the timer_queue thread was never started.
+        assert_equal(thread_started_callback_invocations_num.load(), 0);
+
+        // threads that aren't thread_pool workers use the timer_queue thread.
+        auto fired_on_queue_thread = std::make_shared<concurrencpp::result_promise<void>>();
+        auto queue_timer_fired = fired_on_queue_thread->get_result();
+        auto queue_timer = timer_queue->make_one_shot_timer(10ms, inline_executor, [fired_on_queue_thread] {
+            fired_on_queue_thread->set_result();
+        });
+
+        queue_timer_fired.get();
+        assert_equal(thread_started_callback_invocations_num.load(), 1);
+
+        // a worker that shuts down hands its timers to the timer_queue thread.
+        {
+            auto short_lived_pool = std::make_shared<concurrencpp::thread_pool_executor>("threadpool", 1, 10s);
+            executor_shutdowner es2(short_lived_pool);
+
+            std::atomic_size_t handed_over_fired = 0;
+            auto handed_over_timer = short_lived_pool
+                                         ->submit([&] {
+                                             return timer_queue->make_one_shot_timer(100ms, inline_executor, [&handed_over_fired] {
+                                                 ++handed_over_fired;
+                                             });
+                                         })
+                                         .get();
+
+            short_lived_pool->shutdown();
+            std::this_thread::sleep_for(300ms);
+            assert_equal(handed_over_fired.load(), 1);
+        }
+
+        // shutting the timer_queue down interrupts the timers the workers hold.
+        auto delays = thread_pool_executor
+                          ->submit([&] {
+                              std::vector<concurrencpp::result<void>> worker_delays;
+                              for (size_t i = 0; i < 16; i++) {
+                                  worker_delays.emplace_back(timer_queue->make_delay_object(1h, inline_executor).run());
+                              }
+
+                              return worker_delays;
+                          })
+                          .get();
+
+        timer_queue->shutdown();
+
+        for (auto& delay : delays) {
+            assert_equal(delay.wait_for(10s), result_status::exception);
+            assert_throws_with_error_message<errors::broken_task>(
+                [&delay] {
+                    delay.get();
+                },
+                concurrencpp::details::consts::k_broken_task_exception_error_msg);
+        }
+
+        auto after_shutdown = thread_pool_executor->submit([&] {
+            timer_queue->make_one_shot_timer(50ms, inline_executor, [] {
+            });
+        });
+
+        assert_throws_with_error_message<errors::runtime_shutdown>(
+            [&after_shutdown] {
+                after_shutdown.get();
+            },
+            concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
+    }
+
+    concurrencpp::runtime_options options;
+    assert_false(options.worker_local_timers);
+
+    options.worker_local_timers = true;
+    concurrencpp::runtime runtime(options);
+    assert_true(runtime.timer_queue()->worker_local_timers());
+
+    auto delayed = runtime.thread_pool_executor()->submit([timer_queue = runtime.timer_queue(), executor = runtime.thread_pool_executor()] {
+        return timer_queue->make_delay_object(20ms, executor).run();
+    });
+
+    delayed.get().get();
+}
+
+void concurrencpp::tests::test_timer_queue_sub_millisecond() {
+    using clock_type = std::chrono::steady_clock;
+
+    assert_equal(std::make_shared<concurrencpp::timer_queue>(120s)->spin_window(), 0us);
+
+    auto timer_queue =
+        std::make_shared<concurrencpp::timer_queue>(120s, nullptr, nullptr, timer_queue_backend::ordered_set, 0ms, false, 200us);
+    assert_equal(timer_queue->spin_window(), 200us);
+
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es(inline_executor);
+
+    // getters keep sub-millisecond precision.
+    auto timer = timer_queue->make_timer(1500us, 2500us, inline_executor, [] {
+    });
+    assert_equal(timer.get_due_time(), 1500us);
+    assert_equal(timer.get_frequency(), 2500us);
+    timer.set_frequency(750us);
+    assert_equal(timer.get_frequency(), 750us);
+    timer.cancel();
+
+    std::atomic<clock_type::time_point> fired_at {};
+    const auto before = clock_type::now();
+    auto oneshot_timer = timer_queue->make_one_shot_timer(300us, inline_executor, [&fired_at] {
+        fired_at = clock_type::now();
+    });
+
+    const auto before_delay = clock_type::now();
+    timer_queue->make_delay_object(250us, inline_executor).run().get();
+    assert_bigger_equal(clock_type::now() - before_delay, 250us);
+
+    std::this_thread::sleep_for(20ms);
+    assert_bigger_equal(fired_at.load() - before, 300us);
+
+    std::atomic_size_t invocation_count = 0;
+    auto periodic_timer = timer_queue->make_timer(500us, 500us, inline_executor, [&invocation_count] {
+        ++invocation_count;
+    });
+
+    std::this_thread::sleep_for(100ms);
+    periodic_timer.cancel();
+
+    // 200 invocations are expected, the bound is loose for loaded machines.
+    assert_bigger(invocation_count.load(), 20);
+    assert_smaller_equal(invocation_count.load(), 201);
+
+    concurrencpp::runtime_options options;
+    assert_equal(options.timer_spin_window, 0us);
+
+    options.timer_spin_window = 50us;
+    concurrencpp::runtime runtime(options);
+    assert_equal(runtime.timer_queue()->spin_window(), 50us);
+}
+
+void concurrencpp::tests::test_timer_queue_sleep() {
+    using clock_type = std::chrono::steady_clock;
+
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            timer_queue->sleep_for(100ms, {});
+        },
+        concurrencpp::details::consts::k_timer_queue_sleep_for_executor_null_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            timer_queue->sleep_until(clock_type::now() + 100ms, 1ms, {});
+        },
+        concurrencpp::details::consts::k_timer_queue_sleep_until_executor_null_err_msg);
+
+    for (const auto backend : {timer_queue_backend::ordered_set, timer_queue_backend::timing_wheel}) {
+        auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s, nullptr, nullptr, backend);
+        auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+        auto thread_pool_executor = std::make_shared<concurrencpp::thread_pool_executor>("threadpool", 4, 10s);
+        executor_shutdowner es0(inline_executor), es1(thread_pool_executor);
+
+        const auto sleeping_thread = [](std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                                        std::shared_ptr<concurrencpp::executor> executor) -> concurrencpp::result<std::thread::id> {
+            const auto before = clock_type::now();
+            co_await timer_queue->sleep_for(50ms, executor);
+            assert_bigger_equal(clock_type::now() - before, 50ms);
+
+            const auto deadline = clock_type::now() + 30ms;
+            co_await timer_queue->sleep_until(deadline, executor);
+            assert_bigger_equal(clock_type::now(), deadline);
+
+            const auto slack_before = clock_type::now();
+            co_await timer_queue->sleep_for(20ms, 5ms, executor);
+            assert_bigger_equal(clock_type::now() - slack_before, 20ms);
+
+            co_await timer_queue->sleep_until(clock_type::now() - 1s, executor);
+            co_return std::this_thread::get_id();
+        };
+
+        // resumes inline on the timer_queue thread.
+        assert_not_equal(sleeping_thread(timer_queue, inline_executor).get(), std::this_thread::get_id());
+
+        // many coroutines that sleep repeatedly on a thread pool.
+        constexpr size_t coroutine_count = 1'000;
+        std::atomic_size_t resumed = 0;
+        std::vector<concurrencpp::result<void>> sleepers;
+        sleepers.reserve(coroutine_count);
+
+        for (size_t i = 0; i < coroutine_count; i++) {
+            sleepers.emplace_back([](std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                                     std::shared_ptr<concurrencpp::executor> executor,
+                                     size_t i,
+                                     std::atomic_size_t& resumed) -> concurrencpp::result<void> {
+                for (size_t j = 0; j < 5; j++) {
+                    co_await timer_queue->sleep_for(std::chrono::milliseconds(1 + (i + j) % 10), executor);
+                    ++resumed;
+                }
+            }(timer_queue, thread_pool_executor, i, resumed));
+        }
+
+        for (auto& sleeper : sleepers) {
+            sleeper.get();
+        }
+
+        assert_equal(resumed.load(), coroutine_count * 5);
+
+        // sleeping coroutines are interrupted when the timer_queue shuts down.
+        auto interrupted = [](std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                              std::shared_ptr<concurrencpp::executor> executor) -> concurrencpp::result<void> {
+            co_await timer_queue->sleep_for(1h, executor);
+        }(timer_queue, inline_executor);
+
+        auto interrupted_until = [](std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                                    std::shared_ptr<concurrencpp::executor> executor) -> concurrencpp::result<void> {
+            co_await timer_queue->sleep_until(clock_type::now() + 1h, executor);
+        }(timer_queue, inline_executor);
+
+        std::this_thread::sleep_for(50ms);
+        timer_queue->shutdown();
+
+        assert_throws_with_error_message<errors::broken_task>(
+            [&interrupted] {
+                interrupted.get();
+            },
+            concurrencpp::details::consts::k_broken_task_exception_error_msg);
+
+        assert_throws_with_error_message<errors::broken_task>(
+            [&interrupted_until] {
+                interrupted_until.get();
+            },
+            concurrencpp::details::consts::k_broken_task_exception_error_msg);
+
+        // a timer_queue that was shut down interrupts new sleeps right away.
+        auto after_shutdown = [](std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                                 std::shared_ptr<concurrencpp::executor> executor) -> concurrencpp::result<void> {
+            co_await timer_queue->sleep_for(10ms, executor);
+        }(timer_queue, inline_executor);
+
+        assert_throws_with_error_message<errors::broken_task>(
+            [&after_shutdown] {
+                after_shutdown.get();
+            },
+            concurrencpp::details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -153,6 +566,11 @@ int main() {
     test.add_step("max_worker_idle_time", test_timer_queue_max_worker_idle_time);
     test.add_step("thread_injection", test_timer_queue_thread_injection);
     test.add_step("thread_callbacks", test_timer_queue_thread_callbacks);
+    test.add_step("slack", test_timer_queue_slack);
+    test.add_step("coalescing_window", test_timer_queue_coalescing_window);
+    test.add_step("worker_local_timers", test_timer_queue_worker_local_timers);
+    test.add_step("sub_millisecond", test_timer_queue_sub_millisecond);
+    test.add_step("sleep", test_timer_queue_sleep);
 
     test.launch_test();
     return 0;
@@ -68,8 +68,11 @@ namespace concurrencpp::tests {
             task();
         }
 
-        void enqueue(std::span<concurrencpp::task>) override {
-            // do nothing
+        void enqueue(std::span<concurrencpp::task> tasks) override {
+            // the timer_queue hands the timers that expire together as one batch
+            for (auto& task : tasks) {
+                enqueue(std::move(task));
+            }
         }
 
         int max_concurrency_level() const noexcept override {
@@ -112,8 +115,11 @@ namespace concurrencpp::tests {
             task();
         }
 
-        void enqueue(std::span<concurrencpp::task>) override {
-            // do nothing
+        void enqueue(std::span<concurrencpp::task> tasks) override {
+            // the timer_queue hands the timers that expire together as one batch
+            for (auto& task : tasks) {
+                enqueue(std::move(task));
+            }
         }
 
         int max_concurrency_level() const noexcept override {